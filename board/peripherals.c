@@ -763,349 +763,233 @@ instance:
  * BE CAREFUL MODIFYING THIS COMMENT - IT IS YAML SETTINGS FOR TOOLS **********/
 /* clang-format on */
 
-static void FLEXIO0_init(void) {
-  /* Software reset of the FLEXIO0 peripheral. */
-  SYSCON0->PRESETCTRL2 |= SYSCON_PRESETCTRL2_FLEXIO_RST_MASK;
-  SYSCON0->PRESETCTRL2 &= ~SYSCON_PRESETCTRL2_FLEXIO_RST_MASK;
-  /* FlexIO initialization */
-  /* Control register initialization, set software reset bit then clear it */
-  FLEXIO0->CTRL |= FLEXIO_CTRL_SWRST_MASK;
-  FLEXIO0->CTRL &= ~FLEXIO_CTRL_SWRST_MASK;
-
-  /* Write 1 to clear all shifter status */
-  FLEXIO0->SHIFTSTAT = 0xFFFFFFFFU;
-
-  /* Write 1 to clear all shifter error */
-  FLEXIO0->SHIFTERR = 0xFFFFFFFFU;
-
-  /* Write 1 to clear all timer status */
-  FLEXIO0->TIMSTAT = 0xFFFFFFFFU;
-
-#ifdef FLEXIO_TRGSTAT_ETSF_MASK
-  /* Write 1 to clear all external trigger status */
-  FLEXIO0->TRGSTAT = 0xFFFFFFFFU;
-#endif /* FLEXIO_TRGSTAT_ETSF_MASK */
-
-#ifdef FLEXIO_PINSTAT_PSF_MASK
-  /* Write 1 to clear all pin status */
-  FLEXIO0->PINSTAT = 0xFFFFFFFFU;
-#endif /* FLEXIO_PINSTAT_PSF_MASK */
-
-  /* FlexIO shifter 0 initialization */
-  /* Shifter buffer register SHIFTBUFn initialization */
-#ifdef FLEXIO0_SHIFTBUF0_INIT
-  FLEXIO0->SHIFTBUF[0] = FLEXIO0_SHIFTBUF0_INIT;
-#endif /* FLEXIO0_SHIFTBUF0_INIT */
-
-  /* Shifter configuration register SHIFTCFGn initialization */
-#ifdef FLEXIO0_SHIFTCFG0_INIT
-  FLEXIO0->SHIFTCFG[0] = FLEXIO0_SHIFTCFG0_INIT;
-#else
-  FLEXIO0->SHIFTCFG[0] = 0x0U;
-#endif /* FLEXIO0_SHIFTCFG0_INIT */
-  
-  /* Shifter control register SHIFTCTLn initialization */
-#ifdef FLEXIO0_SHIFTCTL0_INIT
-  FLEXIO0->SHIFTCTL[0] = FLEXIO0_SHIFTCTL0_INIT;
-#else
-  FLEXIO0->SHIFTCTL[0] = 0x0U;
-#endif /* FLEXIO0_SHIFTCTL0_INIT */
-
-  /* FlexIO shifter 1 initialization */
-  /* Shifter buffer register SHIFTBUFn initialization */
-#ifdef FLEXIO0_SHIFTBUF1_INIT
-  FLEXIO0->SHIFTBUF[1] = FLEXIO0_SHIFTBUF1_INIT;
-#endif /* FLEXIO0_SHIFTBUF1_INIT */
-
-  /* Shifter configuration register SHIFTCFGn initialization */
-#ifdef FLEXIO0_SHIFTCFG1_INIT
-  FLEXIO0->SHIFTCFG[1] = FLEXIO0_SHIFTCFG1_INIT;
-#else
-  FLEXIO0->SHIFTCFG[1] = 0x0U;
-#endif /* FLEXIO0_SHIFTCFG1_INIT */
-  
-  /* Shifter control register SHIFTCTLn initialization */
-#ifdef FLEXIO0_SHIFTCTL1_INIT
-  FLEXIO0->SHIFTCTL[1] = FLEXIO0_SHIFTCTL1_INIT;
-#else
-  FLEXIO0->SHIFTCTL[1] = 0x0U;
-#endif /* FLEXIO0_SHIFTCTL1_INIT */
-
-  /* FlexIO shifter 2 initialization */
-  /* Shifter buffer register SHIFTBUFn initialization */
-#ifdef FLEXIO0_SHIFTBUF2_INIT
-  FLEXIO0->SHIFTBUF[2] = FLEXIO0_SHIFTBUF2_INIT;
-#endif /* FLEXIO0_SHIFTBUF2_INIT */
-
-  /* Shifter configuration register SHIFTCFGn initialization */
-#ifdef FLEXIO0_SHIFTCFG2_INIT
-  FLEXIO0->SHIFTCFG[2] = FLEXIO0_SHIFTCFG2_INIT;
-#else
-  FLEXIO0->SHIFTCFG[2] = 0x0U;
-#endif /* FLEXIO0_SHIFTCFG2_INIT */
-  
-  /* Shifter control register SHIFTCTLn initialization */
-#ifdef FLEXIO0_SHIFTCTL2_INIT
-  FLEXIO0->SHIFTCTL[2] = FLEXIO0_SHIFTCTL2_INIT;
-#else
-  FLEXIO0->SHIFTCTL[2] = 0x0U;
-#endif /* FLEXIO0_SHIFTCTL2_INIT */
-
-  /* FlexIO shifter 3 initialization */
-  /* Shifter buffer register SHIFTBUFn initialization */
-#ifdef FLEXIO0_SHIFTBUF3_INIT
-  FLEXIO0->SHIFTBUF[3] = FLEXIO0_SHIFTBUF3_INIT;
-#endif /* FLEXIO0_SHIFTBUF3_INIT */
-
-  /* Shifter configuration register SHIFTCFGn initialization */
-#ifdef FLEXIO0_SHIFTCFG3_INIT
-  FLEXIO0->SHIFTCFG[3] = FLEXIO0_SHIFTCFG3_INIT;
-#else
-  FLEXIO0->SHIFTCFG[3] = 0x0U;
-#endif /* FLEXIO0_SHIFTCFG3_INIT */
-  
-  /* Shifter control register SHIFTCTLn initialization */
-#ifdef FLEXIO0_SHIFTCTL3_INIT
-  FLEXIO0->SHIFTCTL[3] = FLEXIO0_SHIFTCTL3_INIT;
-#else
-  FLEXIO0->SHIFTCTL[3] = 0x0U;
-#endif /* FLEXIO0_SHIFTCTL3_INIT */
-
-  /* FlexIO shifter 4 initialization */
-  /* Shifter buffer register SHIFTBUFn initialization */
-#ifdef FLEXIO0_SHIFTBUF4_INIT
-  FLEXIO0->SHIFTBUF[4] = FLEXIO0_SHIFTBUF4_INIT;
-#endif /* FLEXIO0_SHIFTBUF4_INIT */
-
-  /* Shifter configuration register SHIFTCFGn initialization */
-#ifdef FLEXIO0_SHIFTCFG4_INIT
-  FLEXIO0->SHIFTCFG[4] = FLEXIO0_SHIFTCFG4_INIT;
-#else
-  FLEXIO0->SHIFTCFG[4] = 0x0U;
-#endif /* FLEXIO0_SHIFTCFG4_INIT */
-  
-  /* Shifter control register SHIFTCTLn initialization */
-#ifdef FLEXIO0_SHIFTCTL4_INIT
-  FLEXIO0->SHIFTCTL[4] = FLEXIO0_SHIFTCTL4_INIT;
-#else
-  FLEXIO0->SHIFTCTL[4] = 0x0U;
-#endif /* FLEXIO0_SHIFTCTL4_INIT */
-
-  /* FlexIO timer 0 initialization */
-  /* Timer control register configuration register TIMCTLn initialization */
-#ifdef FLEXIO0_TIMCTL0_INIT
-  FLEXIO0->TIMCTL[0] = FLEXIO0_TIMCTL0_INIT;
-#else
-  FLEXIO0->TIMCTL[0] = 0x0U;
-#endif /* FLEXIO0_TIMCTL0_INIT */
-
-  /* Timer configuration register TIMCFGn initialization */
-#ifdef FLEXIO0_TIMCFG0_INIT
-  FLEXIO0->TIMCFG[0] = FLEXIO0_TIMCFG0_INIT;
-#else
-  FLEXIO0->TIMCFG[0] = 0x0U;
-#endif /* FLEXIO0_TIMCFG0_INIT */
-
-  /* Timer compare register TIMCMPn initialization */
-#ifdef FLEXIO0_TIMCMP0_INIT
-  FLEXIO0->TIMCMP[0] = FLEXIO0_TIMCMP0_INIT;
-#else
-  FLEXIO0->TIMCMP[0] = 0x0U;
-#endif /* FLEXIO0_TIMCMP0_INIT */
-
-  /* FlexIO timer 1 initialization */
-  /* Timer control register configuration register TIMCTLn initialization */
-#ifdef FLEXIO0_TIMCTL1_INIT
-  FLEXIO0->TIMCTL[1] = FLEXIO0_TIMCTL1_INIT;
-#else
-  FLEXIO0->TIMCTL[1] = 0x0U;
-#endif /* FLEXIO0_TIMCTL1_INIT */
-
-  /* Timer configuration register TIMCFGn initialization */
-#ifdef FLEXIO0_TIMCFG1_INIT
-  FLEXIO0->TIMCFG[1] = FLEXIO0_TIMCFG1_INIT;
-#else
-  FLEXIO0->TIMCFG[1] = 0x0U;
-#endif /* FLEXIO0_TIMCFG1_INIT */
-
-  /* Timer compare register TIMCMPn initialization */
-#ifdef FLEXIO0_TIMCMP1_INIT
-  FLEXIO0->TIMCMP[1] = FLEXIO0_TIMCMP1_INIT;
-#else
-  FLEXIO0->TIMCMP[1] = 0x0U;
-#endif /* FLEXIO0_TIMCMP1_INIT */
-
-  /* FlexIO timer 2 initialization */
-  /* Timer control register configuration register TIMCTLn initialization */
-#ifdef FLEXIO0_TIMCTL2_INIT
-  FLEXIO0->TIMCTL[2] = FLEXIO0_TIMCTL2_INIT;
-#else
-  FLEXIO0->TIMCTL[2] = 0x0U;
-#endif /* FLEXIO0_TIMCTL2_INIT */
-
-  /* Timer configuration register TIMCFGn initialization */
-#ifdef FLEXIO0_TIMCFG2_INIT
-  FLEXIO0->TIMCFG[2] = FLEXIO0_TIMCFG2_INIT;
-#else
-  FLEXIO0->TIMCFG[2] = 0x0U;
-#endif /* FLEXIO0_TIMCFG2_INIT */
-
-  /* Timer compare register TIMCMPn initialization */
-#ifdef FLEXIO0_TIMCMP2_INIT
-  FLEXIO0->TIMCMP[2] = FLEXIO0_TIMCMP2_INIT;
-#else
-  FLEXIO0->TIMCMP[2] = 0x0U;
-#endif /* FLEXIO0_TIMCMP2_INIT */
-
-  /* FlexIO timer 3 initialization */
-  /* Timer control register configuration register TIMCTLn initialization */
-#ifdef FLEXIO0_TIMCTL3_INIT
-  FLEXIO0->TIMCTL[3] = FLEXIO0_TIMCTL3_INIT;
-#else
-  FLEXIO0->TIMCTL[3] = 0x0U;
-#endif /* FLEXIO0_TIMCTL3_INIT */
-
-  /* Timer configuration register TIMCFGn initialization */
-#ifdef FLEXIO0_TIMCFG3_INIT
-  FLEXIO0->TIMCFG[3] = FLEXIO0_TIMCFG3_INIT;
-#else
-  FLEXIO0->TIMCFG[3] = 0x0U;
-#endif /* FLEXIO0_TIMCFG3_INIT */
-
-  /* Timer compare register TIMCMPn initialization */
-#ifdef FLEXIO0_TIMCMP3_INIT
-  FLEXIO0->TIMCMP[3] = FLEXIO0_TIMCMP3_INIT;
-#else
-  FLEXIO0->TIMCMP[3] = 0x0U;
-#endif /* FLEXIO0_TIMCMP3_INIT */
-
-  /* FlexIO timer 4 initialization */
-  /* Timer control register configuration register TIMCTLn initialization */
-#ifdef FLEXIO0_TIMCTL4_INIT
-  FLEXIO0->TIMCTL[4] = FLEXIO0_TIMCTL4_INIT;
-#else
-  FLEXIO0->TIMCTL[4] = 0x0U;
-#endif /* FLEXIO0_TIMCTL4_INIT */
-
-  /* Timer configuration register TIMCFGn initialization */
-#ifdef FLEXIO0_TIMCFG4_INIT
-  FLEXIO0->TIMCFG[4] = FLEXIO0_TIMCFG4_INIT;
-#else
-  FLEXIO0->TIMCFG[4] = 0x0U;
-#endif /* FLEXIO0_TIMCFG4_INIT */
-
-  /* Timer compare register TIMCMPn initialization */
-#ifdef FLEXIO0_TIMCMP4_INIT
-  FLEXIO0->TIMCMP[4] = FLEXIO0_TIMCMP4_INIT;
-#else
-  FLEXIO0->TIMCMP[4] = 0x0U;
-#endif /* FLEXIO0_TIMCMP4_INIT */
-
-  /* Shifter status interrupt register initialization */
-#ifdef FLEXIO0_SHIFTSIEN_INIT
-  FLEXIO0->SHIFTSIEN = FLEXIO0_SHIFTSIEN_INIT;
-#else
-  FLEXIO0->SHIFTSIEN = 0x0U;
-#endif /* FLEXIO0_SHIFTSIEN_INIT */
-
-  /* Shifter error interrupt register initialization */
-#ifdef FLEXIO0_SHIFTEIEN_INIT
-  FLEXIO0->SHIFTEIEN = FLEXIO0_SHIFTEIEN_INIT;
-#else
-  FLEXIO0->SHIFTEIEN = 0x0U;
-#endif /* FLEXIO0_SHIFTEIEN_INIT */
-
-  /* Timer interrupt register initialization */
-#ifdef FLEXIO0_TIMIEN_INIT
-  FLEXIO0->TIMIEN = FLEXIO0_TIMIEN_INIT;
-#else
-  FLEXIO0->TIMIEN = 0x0U;
-#endif /* FLEXIO0_TIMIEN_INIT */
-
-  /* Shifter status DMA register initialization */
-#ifdef FLEXIO0_SHIFTSDEN_INIT
-  FLEXIO0->SHIFTSDEN = FLEXIO0_SHIFTSDEN_INIT;
-#else
-  FLEXIO0->SHIFTSDEN = 0x0U;
-#endif /* FLEXIO0_SHIFTSDEN_INIT */
-
+/* One register write of the FLEXIO0 initialization blob. */
+typedef struct {
+  uint16_t offset; /* Register offset in FLEXIO_Type. */
+  uint32_t value;  /* Register value. */
+} flexio_reg_init_t;
+
+#define FLEXIO0_REG_INIT(reg, value) {(uint16_t)offsetof(FLEXIO_Type, reg), (uint32_t)(value)}
+
+/* Registers whose FLEXIO0_*_INIT value differs from the reset value, in the order the generated code
+ * wrote them. Shifter buffers come before the shifter controls, CTRL is last so FLEXEN is only set
+ * once every shifter and timer is configured. */
+static const flexio_reg_init_t s_flexio0RegInit[] = {
+#if defined(FLEXIO0_SHIFTBUF0_INIT) && (FLEXIO0_SHIFTBUF0_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTBUF[0], FLEXIO0_SHIFTBUF0_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCFG0_INIT) && (FLEXIO0_SHIFTCFG0_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCFG[0], FLEXIO0_SHIFTCFG0_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCTL0_INIT) && (FLEXIO0_SHIFTCTL0_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCTL[0], FLEXIO0_SHIFTCTL0_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTBUF1_INIT) && (FLEXIO0_SHIFTBUF1_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTBUF[1], FLEXIO0_SHIFTBUF1_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCFG1_INIT) && (FLEXIO0_SHIFTCFG1_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCFG[1], FLEXIO0_SHIFTCFG1_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCTL1_INIT) && (FLEXIO0_SHIFTCTL1_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCTL[1], FLEXIO0_SHIFTCTL1_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTBUF2_INIT) && (FLEXIO0_SHIFTBUF2_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTBUF[2], FLEXIO0_SHIFTBUF2_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCFG2_INIT) && (FLEXIO0_SHIFTCFG2_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCFG[2], FLEXIO0_SHIFTCFG2_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCTL2_INIT) && (FLEXIO0_SHIFTCTL2_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCTL[2], FLEXIO0_SHIFTCTL2_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTBUF3_INIT) && (FLEXIO0_SHIFTBUF3_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTBUF[3], FLEXIO0_SHIFTBUF3_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCFG3_INIT) && (FLEXIO0_SHIFTCFG3_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCFG[3], FLEXIO0_SHIFTCFG3_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCTL3_INIT) && (FLEXIO0_SHIFTCTL3_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCTL[3], FLEXIO0_SHIFTCTL3_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTBUF4_INIT) && (FLEXIO0_SHIFTBUF4_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTBUF[4], FLEXIO0_SHIFTBUF4_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCFG4_INIT) && (FLEXIO0_SHIFTCFG4_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCFG[4], FLEXIO0_SHIFTCFG4_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCTL4_INIT) && (FLEXIO0_SHIFTCTL4_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCTL[4], FLEXIO0_SHIFTCTL4_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTBUF5_INIT) && (FLEXIO0_SHIFTBUF5_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTBUF[5], FLEXIO0_SHIFTBUF5_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCFG5_INIT) && (FLEXIO0_SHIFTCFG5_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCFG[5], FLEXIO0_SHIFTCFG5_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCTL5_INIT) && (FLEXIO0_SHIFTCTL5_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCTL[5], FLEXIO0_SHIFTCTL5_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTBUF6_INIT) && (FLEXIO0_SHIFTBUF6_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTBUF[6], FLEXIO0_SHIFTBUF6_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCFG6_INIT) && (FLEXIO0_SHIFTCFG6_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCFG[6], FLEXIO0_SHIFTCFG6_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCTL6_INIT) && (FLEXIO0_SHIFTCTL6_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCTL[6], FLEXIO0_SHIFTCTL6_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTBUF7_INIT) && (FLEXIO0_SHIFTBUF7_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTBUF[7], FLEXIO0_SHIFTBUF7_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCFG7_INIT) && (FLEXIO0_SHIFTCFG7_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCFG[7], FLEXIO0_SHIFTCFG7_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTCTL7_INIT) && (FLEXIO0_SHIFTCTL7_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTCTL[7], FLEXIO0_SHIFTCTL7_INIT),
+#endif
+#if defined(FLEXIO0_TIMCTL0_INIT) && (FLEXIO0_TIMCTL0_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCTL[0], FLEXIO0_TIMCTL0_INIT),
+#endif
+#if defined(FLEXIO0_TIMCFG0_INIT) && (FLEXIO0_TIMCFG0_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCFG[0], FLEXIO0_TIMCFG0_INIT),
+#endif
+#if defined(FLEXIO0_TIMCMP0_INIT) && (FLEXIO0_TIMCMP0_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCMP[0], FLEXIO0_TIMCMP0_INIT),
+#endif
+#if defined(FLEXIO0_TIMCTL1_INIT) && (FLEXIO0_TIMCTL1_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCTL[1], FLEXIO0_TIMCTL1_INIT),
+#endif
+#if defined(FLEXIO0_TIMCFG1_INIT) && (FLEXIO0_TIMCFG1_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCFG[1], FLEXIO0_TIMCFG1_INIT),
+#endif
+#if defined(FLEXIO0_TIMCMP1_INIT) && (FLEXIO0_TIMCMP1_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCMP[1], FLEXIO0_TIMCMP1_INIT),
+#endif
+#if defined(FLEXIO0_TIMCTL2_INIT) && (FLEXIO0_TIMCTL2_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCTL[2], FLEXIO0_TIMCTL2_INIT),
+#endif
+#if defined(FLEXIO0_TIMCFG2_INIT) && (FLEXIO0_TIMCFG2_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCFG[2], FLEXIO0_TIMCFG2_INIT),
+#endif
+#if defined(FLEXIO0_TIMCMP2_INIT) && (FLEXIO0_TIMCMP2_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCMP[2], FLEXIO0_TIMCMP2_INIT),
+#endif
+#if defined(FLEXIO0_TIMCTL3_INIT) && (FLEXIO0_TIMCTL3_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCTL[3], FLEXIO0_TIMCTL3_INIT),
+#endif
+#if defined(FLEXIO0_TIMCFG3_INIT) && (FLEXIO0_TIMCFG3_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCFG[3], FLEXIO0_TIMCFG3_INIT),
+#endif
+#if defined(FLEXIO0_TIMCMP3_INIT) && (FLEXIO0_TIMCMP3_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCMP[3], FLEXIO0_TIMCMP3_INIT),
+#endif
+#if defined(FLEXIO0_TIMCTL4_INIT) && (FLEXIO0_TIMCTL4_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCTL[4], FLEXIO0_TIMCTL4_INIT),
+#endif
+#if defined(FLEXIO0_TIMCFG4_INIT) && (FLEXIO0_TIMCFG4_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCFG[4], FLEXIO0_TIMCFG4_INIT),
+#endif
+#if defined(FLEXIO0_TIMCMP4_INIT) && (FLEXIO0_TIMCMP4_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCMP[4], FLEXIO0_TIMCMP4_INIT),
+#endif
+#if defined(FLEXIO0_TIMCTL5_INIT) && (FLEXIO0_TIMCTL5_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCTL[5], FLEXIO0_TIMCTL5_INIT),
+#endif
+#if defined(FLEXIO0_TIMCFG5_INIT) && (FLEXIO0_TIMCFG5_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCFG[5], FLEXIO0_TIMCFG5_INIT),
+#endif
+#if defined(FLEXIO0_TIMCMP5_INIT) && (FLEXIO0_TIMCMP5_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCMP[5], FLEXIO0_TIMCMP5_INIT),
+#endif
+#if defined(FLEXIO0_TIMCTL6_INIT) && (FLEXIO0_TIMCTL6_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCTL[6], FLEXIO0_TIMCTL6_INIT),
+#endif
+#if defined(FLEXIO0_TIMCFG6_INIT) && (FLEXIO0_TIMCFG6_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCFG[6], FLEXIO0_TIMCFG6_INIT),
+#endif
+#if defined(FLEXIO0_TIMCMP6_INIT) && (FLEXIO0_TIMCMP6_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCMP[6], FLEXIO0_TIMCMP6_INIT),
+#endif
+#if defined(FLEXIO0_TIMCTL7_INIT) && (FLEXIO0_TIMCTL7_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCTL[7], FLEXIO0_TIMCTL7_INIT),
+#endif
+#if defined(FLEXIO0_TIMCFG7_INIT) && (FLEXIO0_TIMCFG7_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCFG[7], FLEXIO0_TIMCFG7_INIT),
+#endif
+#if defined(FLEXIO0_TIMCMP7_INIT) && (FLEXIO0_TIMCMP7_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMCMP[7], FLEXIO0_TIMCMP7_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTSIEN_INIT) && (FLEXIO0_SHIFTSIEN_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTSIEN, FLEXIO0_SHIFTSIEN_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTEIEN_INIT) && (FLEXIO0_SHIFTEIEN_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTEIEN, FLEXIO0_SHIFTEIEN_INIT),
+#endif
+#if defined(FLEXIO0_TIMIEN_INIT) && (FLEXIO0_TIMIEN_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMIEN, FLEXIO0_TIMIEN_INIT),
+#endif
+#if defined(FLEXIO0_SHIFTSDEN_INIT) && (FLEXIO0_SHIFTSDEN_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTSDEN, FLEXIO0_SHIFTSDEN_INIT),
+#endif
 #ifdef FLEXIO_TIMERSDEN_TSDE_MASK
-  /* Timer status DMA register initialization */
-#ifdef FLEXIO0_TIMERSDEN_INIT
-  FLEXIO0->TIMERSDEN = FLEXIO0_TIMERSDEN_INIT;
-#else
-  FLEXIO0->TIMERSDEN = 0x0U;
-#endif /* FLEXIO0_TIMERSDEN_INIT */
+#if defined(FLEXIO0_TIMERSDEN_INIT) && (FLEXIO0_TIMERSDEN_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TIMERSDEN, FLEXIO0_TIMERSDEN_INIT),
+#endif
 #endif /* FLEXIO_TIMERSDEN_TSDE_MASK */
-
 #ifdef FLEXIO_SHIFTSTATE_STATE_MASK
-  /* Shifter state register initialization */
-#ifdef FLEXIO0_SHIFTSTATE_INIT
-  FLEXIO0->SHIFTSTATE = FLEXIO0_SHIFTSTATE_INIT;
-#else
-  FLEXIO0->SHIFTSTATE = 0x0U;
-#endif /* FLEXIO0_SHIFTSTATE_INIT */
+#if defined(FLEXIO0_SHIFTSTATE_INIT) && (FLEXIO0_SHIFTSTATE_INIT != 0x0U)
+  FLEXIO0_REG_INIT(SHIFTSTATE, FLEXIO0_SHIFTSTATE_INIT),
+#endif
 #endif /* FLEXIO_SHIFTSTATE_STATE_MASK */
-
 #ifdef FLEXIO_TRIGIEN_TRIE_MASK
-  /* Trigger interrupt enable register initialization */
-#ifdef FLEXIO0_TRIGIEN_INIT
-  FLEXIO0->TRIGIEN = FLEXIO0_TRIGIEN_INIT;
-#else
-  FLEXIO0->TRIGIEN = 0x0U;
-#endif /* FLEXIO0_TRIGIEN_INIT */
+#if defined(FLEXIO0_TRIGIEN_INIT) && (FLEXIO0_TRIGIEN_INIT != 0x0U)
+  FLEXIO0_REG_INIT(TRIGIEN, FLEXIO0_TRIGIEN_INIT),
+#endif
 #endif /* FLEXIO_TRIGIEN_TRIE_MASK */
-
 #ifdef FLEXIO_PINIEN_PSIE_MASK
-  /* Pin interrupt enable register */
-#ifdef FLEXIO0_PINIEN_INIT
-  FLEXIO0->PINIEN = FLEXIO0_PINIEN_INIT;
-#else
-  FLEXIO0->PINIEN = 0x0U;
-#endif /* FLEXIO0_PINIEN_INIT */
+#if defined(FLEXIO0_PINIEN_INIT) && (FLEXIO0_PINIEN_INIT != 0x0U)
+  FLEXIO0_REG_INIT(PINIEN, FLEXIO0_PINIEN_INIT),
+#endif
 #endif /* FLEXIO_PINIEN_PSIE_MASK */
-
 #ifdef FLEXIO_PINREN_PRE_MASK
-  /* Pin rising edge enable register initialization */
-#ifdef FLEXIO0_PINREN_INIT
-  FLEXIO0->PINREN = FLEXIO0_PINREN_INIT;
-#else
-  FLEXIO0->PINREN = 0x0U;
-#endif /* FLEXIO0_PINREN_INIT */
+#if defined(FLEXIO0_PINREN_INIT) && (FLEXIO0_PINREN_INIT != 0x0U)
+  FLEXIO0_REG_INIT(PINREN, FLEXIO0_PINREN_INIT),
+#endif
 #endif /* FLEXIO_PINREN_PRE_MASK */
-
 #ifdef FLEXIO_PINFEN_PFE_MASK
-  /* Pin falling edge enable register initialization */
-#ifdef FLEXIO0_PINFEN_INIT
-  FLEXIO0->PINFEN = FLEXIO0_PINFEN_INIT;
-#else
-  FLEXIO0->PINFEN = 0x0U;
-#endif /* FLEXIO0_PINFEN_INIT */
+#if defined(FLEXIO0_PINFEN_INIT) && (FLEXIO0_PINFEN_INIT != 0x0U)
+  FLEXIO0_REG_INIT(PINFEN, FLEXIO0_PINFEN_INIT),
+#endif
 #endif /* FLEXIO_PINFEN_PFE_MASK */
-
 #ifdef FLEXIO_PINOUTE_OUTE_MASK
-  /* Pin output enable register initialization */
-#ifdef FLEXIO0_PINOUTE_INIT
-  FLEXIO0->PINOUTE = FLEXIO0_PINOUTE_INIT;
-#else
-  FLEXIO0->PINOUTE = 0x0U;
-#endif /* FLEXIO0_PINOUTE_INIT */
+#if defined(FLEXIO0_PINOUTE_INIT) && (FLEXIO0_PINOUTE_INIT != 0x0U)
+  FLEXIO0_REG_INIT(PINOUTE, FLEXIO0_PINOUTE_INIT),
+#endif
 #endif /* FLEXIO_PINOUTE_OUTE_MASK */
-
 #ifdef FLEXIO_PINOUTD_OUTD_MASK
-  /* Pin output register initialization */
-#ifdef FLEXIO0_PINOUTD_INIT
-  FLEXIO0->PINOUTD = FLEXIO0_PINOUTD_INIT;
-#else
-  FLEXIO0->PINOUTD = 0x0U;
-#endif /* FLEXIO0_PINOUTD_INIT */
+#if defined(FLEXIO0_PINOUTD_INIT) && (FLEXIO0_PINOUTD_INIT != 0x0U)
+  FLEXIO0_REG_INIT(PINOUTD, FLEXIO0_PINOUTD_INIT),
+#endif
 #endif /* FLEXIO_PINOUTD_OUTD_MASK */
-
 #ifdef FLEXIO0_CTRL_INIT
-  FLEXIO0->CTRL = (FLEXIO0_CTRL_INIT & ~FLEXIO_CTRL_SWRST_MASK);
+  FLEXIO0_REG_INIT(CTRL, FLEXIO0_CTRL_INIT & ~FLEXIO_CTRL_SWRST_MASK),
 #else
-  FLEXIO0->CTRL = 0x0U;
+  FLEXIO0_REG_INIT(CTRL, 0x0U),
 #endif /* FLEXIO0_CTRL_INIT */
+};
+
+static void FLEXIO0_init(void) {
+  uint32_t i;
+
+  /* Software reset of the FLEXIO0 peripheral. */
+  SYSCON0->PRESETCTRL2 |= SYSCON_PRESETCTRL2_FLEXIO_RST_MASK;
+  SYSCON0->PRESETCTRL2 &= ~SYSCON_PRESETCTRL2_FLEXIO_RST_MASK;
+  /* The peripheral reset leaves every register and status flag at its reset value, only the
+   * registers listed in the blob need a write. */
+  for (i = 0U; i < (sizeof(s_flexio0RegInit) / sizeof(s_flexio0RegInit[0])); i++)
+  {
+    *(volatile uint32_t *)((uint32_t)FLEXIO0 + s_flexio0RegInit[i].offset) = s_flexio0RegInit[i].value;
+  }
 }
 
 /***********************************************************************************************************************
@@ -56,6 +56,14 @@ void BOARD_InitBootPins(void);
  */
 void BOARD_InitPins(void);
 
+/*!
+ * @brief Configures pin routing and optionally pin electrical features.
+ *
+ * Only routes the FLEXIO0_D24..D28 PWM outputs, for the fast boot path which brings the PWM up
+ * before BOARD_InitPins().
+ */
+void BOARD_InitFlexioPwmPins(void);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,242 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include "fsl_component_lockfree_list.h"
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+********************************************************************************** */
+/*! *********************************************************************************
+ * \brief     Initializes the single-producer/single-consumer queue descriptor.
+ *
+ * \param[in] queue - Queue handle to init.
+ *            ring - Element handle storage.
+ *            size - Entries of the ring, a power of two.
+ *
+ * \return void.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+void LIST_SpscInit(list_spsc_handle_t queue, list_element_handle_t *ring, uint32_t size)
+{
+    assert((size != 0U) && ((size & (size - 1U)) == 0U));
+
+    queue->ring = ring;
+    queue->mask = size - 1U;
+    queue->head = 0U;
+    queue->tail = 0U;
+}
+
+/*! *********************************************************************************
+ * \brief     Links element to the tail of the queue, producer side.
+ *
+ * \param[in] queue - Queue to insert into.
+ *            element - element to add
+ *
+ * \return kLIST_Full if queue is full.
+ *         kLIST_Ok if insertion was successful.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks   The indexes run freely, the ring size divides their wrap around.
+ *
+ ********************************************************************************** */
+list_status_t LIST_SpscAddTail(list_spsc_handle_t queue, list_element_handle_t listElement)
+{
+    uint32_t tail = queue->tail;
+
+    if ((tail - queue->head) > queue->mask)
+    {
+        return kLIST_Full; /* A stale head only makes the queue look fuller */
+    }
+
+    queue->ring[tail & queue->mask] = listElement;
+    LIST_MEMORY_BARRIER(); /* Entry written before it is published */
+    queue->tail = tail + 1U;
+
+    return kLIST_Ok;
+}
+
+/*! *********************************************************************************
+ * \brief     Unlinks element from the head of the queue, consumer side.
+ *
+ * \param[in] queue - Queue to remove from.
+ *
+ * \return NULL if queue is empty.
+ *         ID of removed element(pointer) if removal was successful.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+list_element_handle_t LIST_SpscRemoveHead(list_spsc_handle_t queue)
+{
+    uint32_t head = queue->head;
+    list_element_handle_t listElement;
+
+    if (head == queue->tail)
+    {
+        return NULL;
+    }
+
+    LIST_MEMORY_BARRIER(); /* Tail read before the entry it publishes */
+    listElement = queue->ring[head & queue->mask];
+    LIST_MEMORY_BARRIER(); /* Entry read before the producer may reuse it */
+    queue->head = head + 1U;
+
+    return listElement;
+}
+
+/*! *********************************************************************************
+ * \brief     Gets the current size of the queue.
+ *
+ * \param[in] queue - ID of the queue.
+ *
+ * \return Current size of the queue.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+uint32_t LIST_SpscGetSize(list_spsc_handle_t queue)
+{
+    uint32_t head = queue->head;
+
+    return (queue->tail - head);
+}
+
+/*! *********************************************************************************
+ * \brief     Initializes the multi-producer/single-consumer queue descriptor.
+ *
+ * \param[in] queue - Queue handle to init.
+ *
+ * \return void.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+void LIST_MpscInit(list_mpsc_handle_t queue)
+{
+    queue->pushed = NULL;
+    queue->ready  = NULL;
+}
+
+/*! *********************************************************************************
+ * \brief     Links element to the tail of the queue, from any producer.
+ *
+ * \param[in] queue - Queue to insert into.
+ *            element - element to add
+ *
+ * \return kLIST_Ok, the queue is unbounded.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks   Pushes the element on the producer LIFO. The element is linked to the head before
+ *            the exclusive load, the push is retried when the head moved since then or when the
+ *            exclusive store fails.
+ *
+ ********************************************************************************** */
+list_status_t LIST_MpscAddTail(list_mpsc_handle_t queue, list_element_handle_t listElement)
+{
+    list_element_handle_t head;
+    bool published = false;
+
+    while (!published)
+    {
+        /* No other access between the exclusive load and store, it may clear the monitor */
+        head              = queue->pushed;
+        listElement->next = head;
+        LIST_MEMORY_BARRIER(); /* Element written before it is published */
+        if (LIST_LOAD_EXCLUSIVE(&queue->pushed) != head)
+        {
+            LIST_CLEAR_EXCLUSIVE(); /* Head moved since the element was linked */
+        }
+        else
+        {
+            published = (0U == LIST_STORE_EXCLUSIVE(listElement, &queue->pushed));
+        }
+    }
+
+    return kLIST_Ok;
+}
+
+/*! *********************************************************************************
+ * \brief     Unlinks element from the head of the queue, consumer side.
+ *
+ * \param[in] queue - Queue to remove from.
+ *
+ * \return NULL if queue is empty.
+ *         ID of removed element(pointer) if removal was successful.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks   Once the elements taken last are used up, swaps the producer LIFO for NULL and
+ *            reverses it into arrival order.
+ *
+ ********************************************************************************** */
+list_element_handle_t LIST_MpscRemoveHead(list_mpsc_handle_t queue)
+{
+    list_element_handle_t listElement = queue->ready;
+    list_element_handle_t pushed;
+    list_element_handle_t next;
+
+    if (listElement == NULL)
+    {
+        do
+        {
+            pushed = LIST_LOAD_EXCLUSIVE(&queue->pushed);
+            if (pushed == NULL)
+            {
+                LIST_CLEAR_EXCLUSIVE();
+                return NULL; /* Queue is empty */
+            }
+        } while (0U != LIST_STORE_EXCLUSIVE(NULL, &queue->pushed));
+
+        LIST_MEMORY_BARRIER(); /* LIFO taken before its elements are read */
+        while (pushed != NULL)
+        {
+            next         = pushed->next;
+            pushed->next = listElement;
+            listElement  = pushed;
+            pushed       = next;
+        }
+    }
+
+    queue->ready      = listElement->next;
+    listElement->next = NULL;
+
+    return listElement;
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _LOCKFREE_LIST_H_
+#define _LOCKFREE_LIST_H_
+
+#include "fsl_component_generic_list.h"
+
+/*!
+ * @addtogroup LockFreeList
+ * @{
+ */
+
+/**********************************************************************************
+ * Public macro definitions
+ ***********************************************************************************/
+/*
+ * Queues of generic list elements which never mask the interrupts.
+ *
+ * The generic list functions take a critical section, so every thread context enqueue delays the
+ * interrupts for the whole update. The queues below only order their accesses:
+ * - the single-producer/single-consumer queue is a ring of element handles, the producer only
+ *   writes the tail index and the consumer the head index, both sides are wait-free;
+ * - the multi-producer/single-consumer queue is a LIFO the producers push to with LDREX/STREX. The
+ *   consumer takes all of it with one exclusive swap and reverses it into arrival order, so the
+ *   elements come out in the order their pushes completed.
+ * An exception entry or return clears the local exclusive monitor, so an interrupt which pushes in
+ * the middle of a thread push makes the thread retry, nothing is lost. The producers and the
+ * consumer may be any mix of thread and interrupt contexts of one core, as long as each
+ * single-sided end stays in one context at a time.
+ *
+ * The element next member is used by the multi-producer queue only, the list member is left
+ * untouched: LIST_GetList() is meaningless for a queued element.
+ */
+
+/*! @brief Exclusive load of a queue pointer, port hook. */
+#ifndef LIST_LOAD_EXCLUSIVE
+#define LIST_LOAD_EXCLUSIVE(addr) ((list_element_handle_t)__LDREXW((volatile uint32_t *)(volatile void *)(addr)))
+#endif
+
+/*! @brief Exclusive store of a queue pointer, 0 if it succeeded, port hook. */
+#ifndef LIST_STORE_EXCLUSIVE
+#define LIST_STORE_EXCLUSIVE(value, addr) \
+    __STREXW((uint32_t)(value), (volatile uint32_t *)(volatile void *)(addr))
+#endif
+
+/*! @brief Drops an exclusive load without store, port hook. */
+#ifndef LIST_CLEAR_EXCLUSIVE
+#define LIST_CLEAR_EXCLUSIVE() __CLREX()
+#endif
+
+/*! @brief Orders the element accesses against the index and pointer publication, port hook. */
+#ifndef LIST_MEMORY_BARRIER
+#define LIST_MEMORY_BARRIER() __DMB()
+#endif
+
+/**********************************************************************************
+ * Public type definitions
+ ***********************************************************************************/
+/*! @brief The single-producer/single-consumer queue structure */
+typedef struct list_spsc_label
+{
+    list_element_handle_t *ring; /*!< element handle ring, a power of two entries */
+    uint32_t mask;               /*!< ring entries - 1 */
+    volatile uint32_t head;      /*!< free running read index, written by the consumer */
+    volatile uint32_t tail;      /*!< free running write index, written by the producer */
+} list_spsc_label_t, *list_spsc_handle_t;
+
+/*! @brief The multi-producer/single-consumer queue structure */
+typedef struct list_mpsc_label
+{
+    struct list_element_tag *volatile pushed; /*!< elements pushed by the producers, newest first */
+    struct list_element_tag *ready;           /*!< elements taken by the consumer, oldest first */
+} list_mpsc_label_t, *list_mpsc_handle_t;
+
+/**********************************************************************************
+ * API
+ **********************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+/*!
+ * @brief Initialize the single-producer/single-consumer queue.
+ *
+ * @param queue - Queue handle to initialize.
+ * @param ring - Element handle storage, owned by the queue until it is no longer used.
+ * @param size - Number of entries of the ring, a power of two. The queue holds up to size elements.
+ */
+void LIST_SpscInit(list_spsc_handle_t queue, list_element_handle_t *ring, uint32_t size);
+
+/*!
+ * @brief Links element to the tail of the queue, producer side.
+ *
+ * @param queue - Handle of the queue.
+ * @param listElement - Handle of the element.
+ * @retval kLIST_Full if queue is full, kLIST_Ok if insertion was successful.
+ */
+list_status_t LIST_SpscAddTail(list_spsc_handle_t queue, list_element_handle_t listElement);
+
+/*!
+ * @brief Unlinks element from the head of the queue, consumer side.
+ *
+ * @param queue - Handle of the queue.
+ *
+ * @retval NULL if queue is empty, handle of removed element(pointer) if removal was successful.
+ */
+list_element_handle_t LIST_SpscRemoveHead(list_spsc_handle_t queue);
+
+/*!
+ * @brief Gets the current size of the queue.
+ *
+ * Exact from the producer or the consumer side while the other side is idle, a snapshot otherwise.
+ *
+ * @param queue - Handle of the queue.
+ *
+ * @retval Current size of the queue.
+ */
+uint32_t LIST_SpscGetSize(list_spsc_handle_t queue);
+
+/*!
+ * @brief Initialize the multi-producer/single-consumer queue.
+ *
+ * @param queue - Queue handle to initialize.
+ */
+void LIST_MpscInit(list_mpsc_handle_t queue);
+
+/*!
+ * @brief Links element to the tail of the queue, from any producer.
+ *
+ * The queue is unbounded, the element must not be queued already.
+ *
+ * @param queue - Handle of the queue.
+ * @param listElement - Handle of the element.
+ * @retval kLIST_Ok insertion was successful.
+ */
+list_status_t LIST_MpscAddTail(list_mpsc_handle_t queue, list_element_handle_t listElement);
+
+/*!
+ * @brief Unlinks element from the head of the queue, consumer side.
+ *
+ * When the elements taken last are used up, all the elements pushed since are taken at once: the
+ * call which takes them walks them once, the following ones are O(1).
+ *
+ * @param queue - Handle of the queue.
+ *
+ * @retval NULL if queue is empty, handle of removed element(pointer) if removal was successful.
+ */
+list_element_handle_t LIST_MpscRemoveHead(list_mpsc_handle_t queue);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+/*! @}*/
+#endif /*_LOCKFREE_LIST_H_*/
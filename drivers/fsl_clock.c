@@ -77,6 +77,15 @@ volatile static uint32_t s_Enet_Tx_Clk_Freq = 0U;
 /*! @brief external UPLL clock frequency. */
 static uint32_t s_extUpllFreq = 0U;
 
+#if (defined(FSL_SDK_CLOCK_FREQ_CACHE) && FSL_SDK_CLOCK_FREQ_CACHE)
+/*! @brief Cached frequencies, 0 until queried after the last clock tree change. */
+static volatile uint32_t s_clockFreqCache[kCLOCK_FreqCacheCount];
+#if (defined(FSL_SDK_CLOCK_FREQ_CACHE_VALIDATE) && FSL_SDK_CLOCK_FREQ_CACHE_VALIDATE)
+/*! @brief Number of cached values found different from the register computation. */
+static volatile uint32_t s_clockFreqCacheMismatch;
+#endif
+#endif
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -102,6 +111,16 @@ static uint32_t CLOCK_GetSystickClkFreq(uint32_t id);
 static uint32_t CLOCK_GetClockOutClkFreq(void);
 /* Get LP_OSC Clk */
 static uint32_t CLOCK_GetLposcFreq(void);
+/* Main clock frequency computed from the registers */
+static uint32_t CLOCK_ComputeMainClkFreq(void);
+/* Core system clock frequency computed from the registers */
+static uint32_t CLOCK_ComputeCoreSysClkFreq(void);
+/* FLEXIO clock frequency computed from the registers */
+static uint32_t CLOCK_ComputeFlexioClkFreq(void);
+#if (defined(FSL_SDK_CLOCK_FREQ_CACHE) && FSL_SDK_CLOCK_FREQ_CACHE)
+/* Returns a cached frequency, computing it on the first query */
+static uint32_t CLOCK_GetCachedFreq(clock_freq_cache_t entry, uint32_t (*compute)(void));
+#endif
 
 /* Find SELP, SELI, and SELR values for raw M value, max M = MVALMAX */
 static void pllFindSel(uint32_t M, uint32_t *pSelP, uint32_t *pSelI, uint32_t *pSelR);
@@ -144,6 +163,8 @@ static float findPllMMultFromSetup(pll_setup_t *pSetup);
  */
 status_t CLOCK_SetupFROHFClocking(uint32_t iFreq)
 {
+    CLOCK_InvalidateFreqCache();
+
     if ((iFreq != 48000000U) && (iFreq != 144000000U))
     {
         return kStatus_Fail;
@@ -180,6 +201,8 @@ status_t CLOCK_SetupExtClocking(uint32_t iFreq)
 {
     uint8_t range = 0U;
 
+    CLOCK_InvalidateFreqCache();
+
     if ((iFreq >= 16000000U) && (iFreq < 20000000U))
     {
         range = 0U;
@@ -254,6 +277,8 @@ status_t CLOCK_SetupExtRefClocking(uint32_t iFreq)
 {
     uint8_t range = 0U;
 
+    CLOCK_InvalidateFreqCache();
+
     if ((iFreq >= 16000000U) && (iFreq < 20000000U))
     {
         range = 0U;
@@ -329,6 +354,8 @@ status_t CLOCK_SetupExtRefClocking(uint32_t iFreq)
  */
 status_t CLOCK_SetupOsc32KClocking(uint32_t id)
 {
+    CLOCK_InvalidateFreqCache();
+
     /* Enable LDO */
     SCG0->LDOCSR |= SCG_LDOCSR_LDOEN_MASK | SCG_LDOCSR_VOUT_OK_MASK;
 
@@ -371,6 +398,8 @@ status_t CLOCK_SetupOsc32KClocking(uint32_t id)
  */
 status_t CLOCK_SetupClk16KClocking(uint32_t id)
 {
+    CLOCK_InvalidateFreqCache();
+
     VBAT0->FROCTLA |= VBAT_FROCTLA_FRO_EN_MASK;
     VBAT0->FROCTLB &= ~VBAT_FROCTLB_INVERSE_MASK;
 
@@ -389,6 +418,8 @@ status_t CLOCK_SetupClk16KClocking(uint32_t id)
  */
 status_t CLOCK_FROHFTrimConfig(firc_trim_config_t config)
 {
+    CLOCK_InvalidateFreqCache();
+
     SCG0->FIRCTCFG = SCG_FIRCTCFG_TRIMDIV(config.trimDiv) | SCG_FIRCTCFG_TRIMSRC(config.trimSrc);
 
     if (kSCG_FircTrimNonUpdate == config.trimMode)
@@ -414,6 +445,8 @@ status_t CLOCK_FROHFTrimConfig(firc_trim_config_t config)
  */
 status_t CLOCK_FRO12MTrimConfig(sirc_trim_config_t config)
 {
+    CLOCK_InvalidateFreqCache();
+
     SCG0->SIRCTCFG = SCG_SIRCTCFG_TRIMDIV(config.trimDiv) | SCG_SIRCTCFG_TRIMSRC(config.trimSrc);
 
     if (kSCG_SircTrimNonUpdate == config.trimMode)
@@ -657,6 +690,65 @@ void VBAT_SetOscConfig(VBAT_Type *base, const vbat_osc_config_t *config)
 }
 
 /* Clock Selection for IP */
+#if (defined(FSL_SDK_CLOCK_FREQ_CACHE) && FSL_SDK_CLOCK_FREQ_CACHE)
+static uint32_t CLOCK_GetCachedFreq(clock_freq_cache_t entry, uint32_t (*compute)(void))
+{
+    uint32_t freq = s_clockFreqCache[entry];
+
+    if (freq == 0U)
+    {
+        freq                    = compute();
+        s_clockFreqCache[entry] = freq;
+    }
+#if (defined(FSL_SDK_CLOCK_FREQ_CACHE_VALIDATE) && FSL_SDK_CLOCK_FREQ_CACHE_VALIDATE)
+    else if (freq != compute())
+    {
+        s_clockFreqCacheMismatch++;
+        assert(false);
+    }
+    else
+    {
+        /* Cached value matches the registers */
+    }
+#endif
+
+    return freq;
+}
+#endif
+
+/**
+ * brief   Drops the cached clock frequencies.
+ * The next query walks the clock tree again. The clock driver calls it whenever it changes a mux,
+ * a divider or a clock source, code writing the clock registers directly has to call it as well.
+ * return  Nothing
+ */
+void CLOCK_InvalidateFreqCache(void)
+{
+#if (defined(FSL_SDK_CLOCK_FREQ_CACHE) && FSL_SDK_CLOCK_FREQ_CACHE)
+    uint32_t i;
+
+    for (i = 0U; i < (uint32_t)kCLOCK_FreqCacheCount; i++)
+    {
+        s_clockFreqCache[i] = 0U;
+    }
+#endif
+}
+
+/**
+ * brief   Number of cached frequencies found different from the register computation.
+ * Only counted with FSL_SDK_CLOCK_FREQ_CACHE_VALIDATE set, 0 otherwise.
+ * return  Mismatch count.
+ */
+uint32_t CLOCK_GetFreqCacheMismatchCount(void)
+{
+#if (defined(FSL_SDK_CLOCK_FREQ_CACHE) && FSL_SDK_CLOCK_FREQ_CACHE) && \
+    (defined(FSL_SDK_CLOCK_FREQ_CACHE_VALIDATE) && FSL_SDK_CLOCK_FREQ_CACHE_VALIDATE)
+    return s_clockFreqCacheMismatch;
+#else
+    return 0U;
+#endif
+}
+
 /**
  * brief   Configure the clock selection muxes.
  * param   connection  : Clock to be configured.
@@ -671,6 +763,8 @@ void CLOCK_AttachClk(clock_attach_id_t connection)
     uint32_t i;
     volatile uint32_t *pClkSel;
 
+    CLOCK_InvalidateFreqCache();
+
     pClkSel = &(SYSCON->SYSTICKCLKSEL0);
 
     if (kNONE_to_NONE != connection)
@@ -764,6 +858,8 @@ void CLOCK_SetClkDiv(clock_div_name_t div_name, uint32_t divided_by_value)
 {
     volatile uint32_t *pClkDiv;
 
+    CLOCK_InvalidateFreqCache();
+
     pClkDiv = &(SYSCON->SYSTICKCLKDIV[0]);
     /* halt and reset clock dividers */
     ((volatile uint32_t *)pClkDiv)[(uint32_t)div_name] = 0x3UL << 29U;
@@ -813,6 +909,8 @@ void CLOCK_HaltClkDiv(clock_div_name_t div_name)
 {
     volatile uint32_t *pClkDiv;
 
+    CLOCK_InvalidateFreqCache();
+
     pClkDiv = &(SYSCON->SYSTICKCLKDIV[0]);
 
     /* halt clock dividers */
@@ -829,6 +927,8 @@ void CLOCK_HaltClkDiv(clock_div_name_t div_name)
  */
 void CLOCK_SetupClockCtrl(uint32_t mask)
 {
+    CLOCK_InvalidateFreqCache();
+
     SYSCON->CLOCK_CTRL |= mask;
 
     return;
@@ -1545,6 +1645,15 @@ uint32_t CLOCK_GetUsdhcClkFreq(void)
  *  return Frequency of FLEXIO
  */
 uint32_t CLOCK_GetFlexioClkFreq(void)
+{
+#if (defined(FSL_SDK_CLOCK_FREQ_CACHE) && FSL_SDK_CLOCK_FREQ_CACHE)
+    return CLOCK_GetCachedFreq(kCLOCK_FreqCacheFlexio, CLOCK_ComputeFlexioClkFreq);
+#else
+    return CLOCK_ComputeFlexioClkFreq();
+#endif
+}
+
+static uint32_t CLOCK_ComputeFlexioClkFreq(void)
 {
     uint32_t freq = 0U;
 
@@ -2132,6 +2241,8 @@ pll_error_t CLOCK_SetPLL0Freq(const pll_setup_t *pSetup)
 {
     uint32_t inRate, clkRate, prediv;
 
+    CLOCK_InvalidateFreqCache();
+
     /* Enable LDO */
     SCG0->LDOCSR |= SCG_LDOCSR_LDOEN_MASK;
 
@@ -2190,6 +2301,8 @@ pll_error_t CLOCK_SetPLL1Freq(const pll_setup_t *pSetup)
 {
     uint32_t inRate, clkRate, prediv;
 
+    CLOCK_InvalidateFreqCache();
+
     /* Enable LDO */
     SCG0->LDOCSR |= SCG_LDOCSR_LDOEN_MASK;
 
@@ -2337,6 +2450,15 @@ static uint32_t CLOCK_GetOsc32KFreq(uint32_t id)
  *  @return Frequency of the main
  */
 uint32_t CLOCK_GetMainClkFreq(void)
+{
+#if (defined(FSL_SDK_CLOCK_FREQ_CACHE) && FSL_SDK_CLOCK_FREQ_CACHE)
+    return CLOCK_GetCachedFreq(kCLOCK_FreqCacheMainClk, CLOCK_ComputeMainClkFreq);
+#else
+    return CLOCK_ComputeMainClkFreq();
+#endif
+}
+
+static uint32_t CLOCK_ComputeMainClkFreq(void)
 {
     uint32_t freq = 0U;
 
@@ -2376,10 +2498,19 @@ uint32_t CLOCK_GetMainClkFreq(void)
  *  return Frequency of Core System
  */
 uint32_t CLOCK_GetCoreSysClkFreq(void)
+{
+#if (defined(FSL_SDK_CLOCK_FREQ_CACHE) && FSL_SDK_CLOCK_FREQ_CACHE)
+    return CLOCK_GetCachedFreq(kCLOCK_FreqCacheCoreSysClk, CLOCK_ComputeCoreSysClkFreq);
+#else
+    return CLOCK_ComputeCoreSysClkFreq();
+#endif
+}
+
+static uint32_t CLOCK_ComputeCoreSysClkFreq(void)
 {
     uint32_t freq = 0U;
 
-    freq = CLOCK_GetMainClkFreq() / ((SYSCON->AHBCLKDIV & 0xffU) + 1U);
+    freq = CLOCK_ComputeMainClkFreq() / ((SYSCON->AHBCLKDIV & 0xffU) + 1U);
 
     return freq;
 }
@@ -3121,6 +3252,8 @@ bool CLOCK_EnableUsbhsClock(void)
  */
 status_t CLOCK_FIRCAutoTrimWithSOF(void)
 {
+    CLOCK_InvalidateFreqCache();
+
     /* System OSC Clock Monitor is disabled */
     CLOCK_SetSysOscMonitorMode(kSCG_SysOscMonitorDisable);
 
@@ -21,8 +21,8 @@
 
 /*! @name Driver version */
 /*@{*/
-/*! @brief CLOCK driver version 1.0.1. */
-#define FSL_CLOCK_DRIVER_VERSION (MAKE_VERSION(1, 0, 1))
+/*! @brief CLOCK driver version 1.1.0. */
+#define FSL_CLOCK_DRIVER_VERSION (MAKE_VERSION(1, 1, 0))
 /*@}*/
 
 /*! @brief Configure whether driver controls clock
@@ -39,6 +39,38 @@
 #define FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL 0
 #endif
 
+/*! @brief Configure whether clock frequency queries are cached
+ *
+ * When set to 1, CLOCK_GetMainClkFreq(), CLOCK_GetCoreSysClkFreq() and CLOCK_GetFlexioClkFreq()
+ * walk the clock tree once and return the cached value afterwards. CLOCK_AttachClk(),
+ * CLOCK_SetClkDiv() and the other functions changing a mux, a divider or a clock source drop the
+ * cache, code writing the clock registers directly has to call CLOCK_InvalidateFreqCache().
+ *
+ * @note Clock changes and cached queries are expected from the same execution context, a query
+ * interrupting a clock change may cache an intermediate frequency.
+ */
+#if !(defined(FSL_SDK_CLOCK_FREQ_CACHE))
+#define FSL_SDK_CLOCK_FREQ_CACHE 1
+#endif
+
+/*! @brief Configure the validation mode of the clock frequency cache
+ *
+ * When set to 1, every cached query is compared with the full computation from the registers,
+ * a mismatch asserts and is counted by CLOCK_GetFreqCacheMismatchCount().
+ */
+#if !(defined(FSL_SDK_CLOCK_FREQ_CACHE_VALIDATE))
+#define FSL_SDK_CLOCK_FREQ_CACHE_VALIDATE 0
+#endif
+
+/*! @brief Clock frequencies held by the frequency cache. */
+typedef enum _clock_freq_cache
+{
+    kCLOCK_FreqCacheMainClk = 0U, /*!< CLOCK_GetMainClkFreq() */
+    kCLOCK_FreqCacheCoreSysClk,   /*!< CLOCK_GetCoreSysClkFreq() */
+    kCLOCK_FreqCacheFlexio,       /*!< CLOCK_GetFlexioClkFreq() */
+    kCLOCK_FreqCacheCount,        /*!< Number of cached frequencies */
+} clock_freq_cache_t;
+
 /*!
  * @brief User-defined the size of cache for CLOCK_PllGetConfig() function.
  *
@@ -1611,6 +1643,19 @@ void CLOCK_SetupClockCtrl(uint32_t mask);
  */
 uint32_t CLOCK_GetFreq(clock_name_t clockName);
 
+/**
+ * @brief   Drops the cached clock frequencies, see FSL_SDK_CLOCK_FREQ_CACHE.
+ * @return  Nothing
+ */
+void CLOCK_InvalidateFreqCache(void);
+
+/**
+ * @brief   Number of cached frequencies found different from the register computation.
+ * Only counted with FSL_SDK_CLOCK_FREQ_CACHE_VALIDATE set, 0 otherwise.
+ * @return  Mismatch count.
+ */
+uint32_t CLOCK_GetFreqCacheMismatchCount(void);
+
 /*! @brief  Return Frequency of main
  *  @return Frequency of the main
  */
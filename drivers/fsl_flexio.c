@@ -20,12 +20,34 @@
 /*< @brief user configurable flexio handle count. */
 #define FLEXIO_HANDLE_COUNT 2
 
+/*< @brief user configurable count of handlers owning status flags, per FlexIO instance. */
+#ifndef FLEXIO_FLAG_HANDLER_COUNT
+#define FLEXIO_FLAG_HANDLER_COUNT 4
+#endif
+
+/*< @brief number of shifter and timer status bits covered by the dispatch table. */
+#define FLEXIO_FLAG_SHIFTER_COUNT FLEXIO_SHIFTCTL_COUNT
+#define FLEXIO_FLAG_TIMER_COUNT   FLEXIO_TIMCTL_COUNT
+
 #if defined(FLEXIO_RSTS)
 #define FLEXIO_RESETS_ARRAY FLEXIO_RSTS
 #elif defined(FLEXIO_RSTS_N)
 #define FLEXIO_RESETS_ARRAY FLEXIO_RSTS_N
 #endif
 
+/*< @brief 1 places the interrupt dispatch and its tables in the quick access (RAM) sections. */
+#ifndef FSL_FLEXIO_IRQ_QUICKACCESS
+#define FSL_FLEXIO_IRQ_QUICKACCESS 0
+#endif
+
+#if (defined(FSL_FLEXIO_IRQ_QUICKACCESS) && FSL_FLEXIO_IRQ_QUICKACCESS)
+#define FLEXIO_IRQ_CODE(func) AT_QUICKACCESS_SECTION_CODE(func)
+#define FLEXIO_IRQ_DATA(var)  AT_QUICKACCESS_SECTION_DATA(var)
+#else
+#define FLEXIO_IRQ_CODE(func) func
+#define FLEXIO_IRQ_DATA(var)  var
+#endif
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -46,8 +68,24 @@ static void *s_flexioType[FLEXIO_HANDLE_COUNT];
 /*< @brief pointer to array of FLEXIO Isr. */
 static flexio_isr_t s_flexioIsr[FLEXIO_HANDLE_COUNT];
 
+/*< @brief handler owning a set of shifter and timer status flags. */
+typedef struct _flexio_flag_handler
+{
+    flexio_isr_t isr;     /*!< Interrupt handler, NULL when the slot is free. */
+    void *handle;         /*!< Handler parameter. */
+    uint32_t shifterMask; /*!< Owned SHIFTSTAT/SHIFTERR bits. */
+    uint32_t timerMask;   /*!< Owned TIMSTAT bits. */
+} flexio_flag_handler_t;
+
+/*< @brief flag handler slots of each FLEXIO instance. */
+FLEXIO_IRQ_DATA(static flexio_flag_handler_t s_flexioFlagHandler[FSL_FEATURE_SOC_FLEXIO_COUNT][FLEXIO_FLAG_HANDLER_COUNT]);
+
+/*< @brief owner of each shifter and timer status bit, slot index plus one, 0 when not owned. */
+FLEXIO_IRQ_DATA(static uint8_t s_flexioShifterOwner[FSL_FEATURE_SOC_FLEXIO_COUNT][FLEXIO_FLAG_SHIFTER_COUNT]);
+FLEXIO_IRQ_DATA(static uint8_t s_flexioTimerOwner[FSL_FEATURE_SOC_FLEXIO_COUNT][FLEXIO_FLAG_TIMER_COUNT]);
+
 /* FlexIO common IRQ Handler. */
-static void FLEXIO_CommonIRQHandler(void);
+FLEXIO_IRQ_CODE(static void FLEXIO_CommonIRQHandler(uint32_t instance));
 
 #if defined(FLEXIO_RESETS_ARRAY)
 /* Reset array */
@@ -261,14 +299,33 @@ uint32_t FLEXIO_GetShifterBufferAddress(FLEXIO_Type *base, flexio_shifter_buffer
 */
 void FLEXIO_SetShifterConfig(FLEXIO_Type *base, uint8_t index, const flexio_shifter_config_t *shifterConfig)
 {
-    base->SHIFTCFG[index] = FLEXIO_SHIFTCFG_INSRC(shifterConfig->inputSource)
+    flexio_shifter_image_t image;
+
+    FLEXIO_CompileShifterConfig(shifterConfig, &image);
+
+    base->SHIFTCFG[index] = image.shiftcfg;
+    base->SHIFTCTL[index] = image.shiftctl;
+}
+
+/*!
+ * brief Converts a shifter configuration into its register words.
+ *
+ * param shifterConfig Pointer to flexio_shifter_config_t structure
+ * param image         Pointer to the image to fill
+ */
+void FLEXIO_CompileShifterConfig(const flexio_shifter_config_t *shifterConfig, flexio_shifter_image_t *image)
+{
+    assert(shifterConfig != NULL);
+    assert(image != NULL);
+
+    image->shiftcfg = FLEXIO_SHIFTCFG_INSRC(shifterConfig->inputSource)
 #if FSL_FEATURE_FLEXIO_HAS_PARALLEL_WIDTH
-                            | FLEXIO_SHIFTCFG_PWIDTH(shifterConfig->parallelWidth)
+                      | FLEXIO_SHIFTCFG_PWIDTH(shifterConfig->parallelWidth)
 #endif /* FSL_FEATURE_FLEXIO_HAS_PARALLEL_WIDTH */
-                            | FLEXIO_SHIFTCFG_SSTOP(shifterConfig->shifterStop) |
-                            FLEXIO_SHIFTCFG_SSTART(shifterConfig->shifterStart);
+                      | FLEXIO_SHIFTCFG_SSTOP(shifterConfig->shifterStop) |
+                      FLEXIO_SHIFTCFG_SSTART(shifterConfig->shifterStart);
 
-    base->SHIFTCTL[index] =
+    image->shiftctl =
         FLEXIO_SHIFTCTL_TIMSEL(shifterConfig->timerSelect) | FLEXIO_SHIFTCTL_TIMPOL(shifterConfig->timerPolarity) |
         FLEXIO_SHIFTCTL_PINCFG(shifterConfig->pinConfig) | FLEXIO_SHIFTCTL_PINSEL(shifterConfig->pinSelect) |
         FLEXIO_SHIFTCTL_PINPOL(shifterConfig->pinPolarity) | FLEXIO_SHIFTCTL_SMOD(shifterConfig->shifterMode);
@@ -306,19 +363,39 @@ void FLEXIO_SetShifterConfig(FLEXIO_Type *base, uint8_t index, const flexio_shif
 */
 void FLEXIO_SetTimerConfig(FLEXIO_Type *base, uint8_t index, const flexio_timer_config_t *timerConfig)
 {
-    base->TIMCFG[index] =
+    flexio_timer_image_t image;
+
+    FLEXIO_CompileTimerConfig(timerConfig, &image);
+
+    base->TIMCFG[index] = image.timcfg;
+    base->TIMCMP[index] = image.timcmp;
+    base->TIMCTL[index] = image.timctl;
+}
+
+/*!
+ * brief Converts a timer configuration into its register words.
+ *
+ * param timerConfig Pointer to the flexio_timer_config_t structure
+ * param image       Pointer to the image to fill
+ */
+void FLEXIO_CompileTimerConfig(const flexio_timer_config_t *timerConfig, flexio_timer_image_t *image)
+{
+    assert(timerConfig != NULL);
+    assert(image != NULL);
+
+    image->timcfg =
         FLEXIO_TIMCFG_TIMOUT(timerConfig->timerOutput) | FLEXIO_TIMCFG_TIMDEC(timerConfig->timerDecrement) |
         FLEXIO_TIMCFG_TIMRST(timerConfig->timerReset) | FLEXIO_TIMCFG_TIMDIS(timerConfig->timerDisable) |
         FLEXIO_TIMCFG_TIMENA(timerConfig->timerEnable) | FLEXIO_TIMCFG_TSTOP(timerConfig->timerStop) |
         FLEXIO_TIMCFG_TSTART(timerConfig->timerStart);
 
-    base->TIMCMP[index] = FLEXIO_TIMCMP_CMP(timerConfig->timerCompare);
+    image->timcmp = FLEXIO_TIMCMP_CMP(timerConfig->timerCompare);
 
-    base->TIMCTL[index] = FLEXIO_TIMCTL_TRGSEL(timerConfig->triggerSelect) |
-                          FLEXIO_TIMCTL_TRGPOL(timerConfig->triggerPolarity) |
-                          FLEXIO_TIMCTL_TRGSRC(timerConfig->triggerSource) |
-                          FLEXIO_TIMCTL_PINCFG(timerConfig->pinConfig) | FLEXIO_TIMCTL_PINSEL(timerConfig->pinSelect) |
-                          FLEXIO_TIMCTL_PINPOL(timerConfig->pinPolarity) | FLEXIO_TIMCTL_TIMOD(timerConfig->timerMode);
+    image->timctl = FLEXIO_TIMCTL_TRGSEL(timerConfig->triggerSelect) |
+                    FLEXIO_TIMCTL_TRGPOL(timerConfig->triggerPolarity) |
+                    FLEXIO_TIMCTL_TRGSRC(timerConfig->triggerSource) | FLEXIO_TIMCTL_PINCFG(timerConfig->pinConfig) |
+                    FLEXIO_TIMCTL_PINSEL(timerConfig->pinSelect) | FLEXIO_TIMCTL_PINPOL(timerConfig->pinPolarity) |
+                    FLEXIO_TIMCTL_TIMOD(timerConfig->timerMode);
 }
 
 /*!
@@ -397,10 +474,180 @@ status_t FLEXIO_UnregisterHandleIRQ(void *base)
     }
 }
 
-static void FLEXIO_CommonIRQHandler(void)
+/*!
+ * brief Registers a handler for a set of shifter and timer status flags.
+ *
+ * param base        FlexIO peripheral base address.
+ * param shifterMask Shifter status/error flags owned by the handler, bit n for shifter n.
+ * param timerMask   Timer status flags owned by the handler, bit n for timer n.
+ * param handle      Handler parameter.
+ * param isr         Interrupt handler, called with the FlexIO base address and handle.
+ * retval kStatus_Success The handler is registered.
+ * retval kStatus_OutOfRange No free handler slot.
+ * retval kStatus_Busy A flag is already owned by another handler.
+ */
+status_t FLEXIO_RegisterFlagHandlerIRQ(
+    FLEXIO_Type *base, uint32_t shifterMask, uint32_t timerMask, void *handle, flexio_isr_t isr)
+{
+    assert(handle != NULL);
+    assert(isr != NULL);
+    assert(shifterMask < (1UL << FLEXIO_FLAG_SHIFTER_COUNT));
+    assert(timerMask < (1UL << FLEXIO_FLAG_TIMER_COUNT));
+
+    uint32_t instance = FLEXIO_GetInstance(base);
+    flexio_flag_handler_t *handler;
+    uint32_t owned = 0U;
+    uint32_t bits;
+    uint8_t slot;
+    uint8_t bit;
+
+    for (slot = 0U; slot < (uint8_t)FLEXIO_FLAG_HANDLER_COUNT; slot++)
+    {
+        handler = &s_flexioFlagHandler[instance][slot];
+        if (handler->isr != NULL)
+        {
+            owned |= (handler->shifterMask & shifterMask) | (handler->timerMask & timerMask);
+        }
+    }
+    if (owned != 0U)
+    {
+        return kStatus_Busy;
+    }
+
+    for (slot = 0U; slot < (uint8_t)FLEXIO_FLAG_HANDLER_COUNT; slot++)
+    {
+        if (s_flexioFlagHandler[instance][slot].isr == NULL)
+        {
+            break;
+        }
+    }
+    if (slot == (uint8_t)FLEXIO_FLAG_HANDLER_COUNT)
+    {
+        return kStatus_OutOfRange;
+    }
+
+    handler              = &s_flexioFlagHandler[instance][slot];
+    handler->handle      = handle;
+    handler->shifterMask = shifterMask;
+    handler->timerMask   = timerMask;
+
+    for (bits = shifterMask; bits != 0U; bits &= ~(1UL << bit))
+    {
+        bit                                 = (uint8_t)(31U - __CLZ(bits));
+        s_flexioShifterOwner[instance][bit] = slot + 1U;
+    }
+    for (bits = timerMask; bits != 0U; bits &= ~(1UL << bit))
+    {
+        bit                               = (uint8_t)(31U - __CLZ(bits));
+        s_flexioTimerOwner[instance][bit] = slot + 1U;
+    }
+
+    /* Publish the slot last, the interrupt handler only follows owners of populated slots. */
+    handler->isr = isr;
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Unregisters the flag handler registered with a handle.
+ *
+ * param base   FlexIO peripheral base address.
+ * param handle Handler parameter passed to FLEXIO_RegisterFlagHandlerIRQ().
+ * retval kStatus_Success The handler is unregistered.
+ * retval kStatus_OutOfRange No handler is registered with this handle.
+ */
+status_t FLEXIO_UnregisterFlagHandlerIRQ(FLEXIO_Type *base, void *handle)
+{
+    uint32_t instance = FLEXIO_GetInstance(base);
+    flexio_flag_handler_t *handler;
+    uint32_t bits;
+    uint8_t slot;
+    uint8_t bit;
+
+    for (slot = 0U; slot < (uint8_t)FLEXIO_FLAG_HANDLER_COUNT; slot++)
+    {
+        handler = &s_flexioFlagHandler[instance][slot];
+        if ((handler->isr != NULL) && (handler->handle == handle))
+        {
+            break;
+        }
+    }
+    if (slot == (uint8_t)FLEXIO_FLAG_HANDLER_COUNT)
+    {
+        return kStatus_OutOfRange;
+    }
+
+    /* Release the flags first, an interrupt in between must not reach a slot without handler. */
+    for (bits = handler->shifterMask; bits != 0U; bits &= ~(1UL << bit))
+    {
+        bit                                 = (uint8_t)(31U - __CLZ(bits));
+        s_flexioShifterOwner[instance][bit] = 0U;
+    }
+    for (bits = handler->timerMask; bits != 0U; bits &= ~(1UL << bit))
+    {
+        bit                               = (uint8_t)(31U - __CLZ(bits));
+        s_flexioTimerOwner[instance][bit] = 0U;
+    }
+
+    handler->isr         = NULL;
+    handler->handle      = NULL;
+    handler->shifterMask = 0U;
+    handler->timerMask   = 0U;
+
+    return kStatus_Success;
+}
+
+/*
+ * Flags with an enabled interrupt are read once, every set bit is handed to its owner with CLZ.
+ * An owner is called once per interrupt: its other flags are dropped from the pending set, the
+ * handler checks them itself. Flags without an owner are skipped. The handlers registered with
+ * FLEXIO_RegisterHandleIRQ() are then called at every interrupt, whatever the flags, as before.
+ */
+static void FLEXIO_CommonIRQHandler(uint32_t instance)
 {
     uint8_t index;
 
+    if (instance < ARRAY_SIZE(s_flexioBases))
+    {
+        FLEXIO_Type *base = s_flexioBases[instance];
+        uint32_t shifterPending =
+            ((base->SHIFTSTAT & base->SHIFTSIEN) | (base->SHIFTERR & base->SHIFTEIEN)) &
+            ((1UL << FLEXIO_FLAG_SHIFTER_COUNT) - 1U);
+        uint32_t timerPending = (base->TIMSTAT & base->TIMIEN) & ((1UL << FLEXIO_FLAG_TIMER_COUNT) - 1U);
+        flexio_flag_handler_t *handler;
+        uint8_t owner;
+        uint8_t bit;
+
+        while (shifterPending != 0U)
+        {
+            bit   = (uint8_t)(31U - __CLZ(shifterPending));
+            owner = s_flexioShifterOwner[instance][bit];
+            if (owner == 0U)
+            {
+                shifterPending &= ~(1UL << bit);
+                continue;
+            }
+            handler = &s_flexioFlagHandler[instance][owner - 1U];
+            handler->isr(base, handler->handle);
+            shifterPending &= ~handler->shifterMask;
+            timerPending &= ~handler->timerMask;
+        }
+
+        while (timerPending != 0U)
+        {
+            bit   = (uint8_t)(31U - __CLZ(timerPending));
+            owner = s_flexioTimerOwner[instance][bit];
+            if (owner == 0U)
+            {
+                timerPending &= ~(1UL << bit);
+                continue;
+            }
+            handler = &s_flexioFlagHandler[instance][owner - 1U];
+            handler->isr(base, handler->handle);
+            timerPending &= ~handler->timerMask;
+        }
+    }
+
     for (index = 0U; index < (uint8_t)FLEXIO_HANDLE_COUNT; index++)
     {
         if (s_flexioHandle[index] != NULL)
@@ -474,38 +721,38 @@ void FLEXIO_SetPinConfig(FLEXIO_Type *base, uint32_t pin, flexio_gpio_config_t *
 }
 #endif /*FSL_FEATURE_FLEXIO_HAS_PIN_REGISTER*/
 
-void FLEXIO_DriverIRQHandler(void);
+FLEXIO_IRQ_CODE(void FLEXIO_DriverIRQHandler(void));
 void FLEXIO_DriverIRQHandler(void)
 {
-    FLEXIO_CommonIRQHandler();
+    FLEXIO_CommonIRQHandler(0U);
 }
 
-void FLEXIO0_DriverIRQHandler(void);
+FLEXIO_IRQ_CODE(void FLEXIO0_DriverIRQHandler(void));
 void FLEXIO0_DriverIRQHandler(void)
 {
-    FLEXIO_CommonIRQHandler();
+    FLEXIO_CommonIRQHandler(0U);
 }
 
-void FLEXIO1_DriverIRQHandler(void);
+FLEXIO_IRQ_CODE(void FLEXIO1_DriverIRQHandler(void));
 void FLEXIO1_DriverIRQHandler(void)
 {
-    FLEXIO_CommonIRQHandler();
+    FLEXIO_CommonIRQHandler(1U);
 }
 
-void UART2_FLEXIO_DriverIRQHandler(void);
+FLEXIO_IRQ_CODE(void UART2_FLEXIO_DriverIRQHandler(void));
 void UART2_FLEXIO_DriverIRQHandler(void)
 {
-    FLEXIO_CommonIRQHandler();
+    FLEXIO_CommonIRQHandler(0U);
 }
 
-void FLEXIO2_DriverIRQHandler(void);
+FLEXIO_IRQ_CODE(void FLEXIO2_DriverIRQHandler(void));
 void FLEXIO2_DriverIRQHandler(void)
 {
-    FLEXIO_CommonIRQHandler();
+    FLEXIO_CommonIRQHandler(2U);
 }
 
-void FLEXIO3_DriverIRQHandler(void);
+FLEXIO_IRQ_CODE(void FLEXIO3_DriverIRQHandler(void));
 void FLEXIO3_DriverIRQHandler(void)
 {
-    FLEXIO_CommonIRQHandler();
+    FLEXIO_CommonIRQHandler(3U);
 }
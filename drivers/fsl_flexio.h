@@ -22,7 +22,7 @@
 /*! @name Driver version */
 /*! @{ */
 /*! @brief FlexIO driver version. */
-#define FSL_FLEXIO_DRIVER_VERSION (MAKE_VERSION(2, 2, 2))
+#define FSL_FLEXIO_DRIVER_VERSION (MAKE_VERSION(2, 4, 0))
 /*! @} */
 
 /*! @brief Calculate FlexIO timer trigger.*/
@@ -294,6 +294,27 @@ typedef struct _flexio_shifter_config
     flexio_shifter_start_bit_t shifterStart;   /*!< Shifter START bit. */
 } flexio_shifter_config_t;
 
+/*!
+ * @brief Precompiled timer registers, built once by FLEXIO_CompileTimerConfig() and applied with
+ * FLEXIO_ApplyTimerImage().
+ */
+typedef struct _flexio_timer_image
+{
+    uint32_t timcfg; /*!< TIMCFG register value. */
+    uint32_t timcmp; /*!< TIMCMP register value. */
+    uint32_t timctl; /*!< TIMCTL register value. */
+} flexio_timer_image_t;
+
+/*!
+ * @brief Precompiled shifter registers, built once by FLEXIO_CompileShifterConfig() and applied with
+ * FLEXIO_ApplyShifterImage().
+ */
+typedef struct _flexio_shifter_image
+{
+    uint32_t shiftcfg; /*!< SHIFTCFG register value. */
+    uint32_t shiftctl; /*!< SHIFTCTL register value. */
+} flexio_shifter_image_t;
+
 #if defined(FSL_FEATURE_FLEXIO_HAS_PIN_REGISTER) && FSL_FEATURE_FLEXIO_HAS_PIN_REGISTER
 /*! @brief FLEXIO gpio direction definition */
 typedef enum _flexio_gpio_direction
@@ -536,6 +557,62 @@ static inline void FLEXIO_SetClockMode(FLEXIO_Type *base, uint8_t index, flexio_
     base->TIMCFG[index] = reg;
 }
 
+/*!
+ * @brief Converts a shifter configuration into its register words.
+ *
+ * The image holds the values FLEXIO_SetShifterConfig() would write. Build it once, then apply it
+ * as often as needed with FLEXIO_ApplyShifterImage().
+ *
+ * @param shifterConfig Pointer to flexio_shifter_config_t structure
+ * @param image         Pointer to the image to fill
+ */
+void FLEXIO_CompileShifterConfig(const flexio_shifter_config_t *shifterConfig, flexio_shifter_image_t *image);
+
+/*!
+ * @brief Converts a timer configuration into its register words.
+ *
+ * The image holds the values FLEXIO_SetTimerConfig() would write. Build it once, then apply it
+ * as often as needed with FLEXIO_ApplyTimerImage(). Single fields can be patched in the image
+ * with the FLEXIO_TIMCTL_xxx/FLEXIO_TIMCMP_xxx register macros.
+ *
+ * @param timerConfig Pointer to the flexio_timer_config_t structure
+ * @param image       Pointer to the image to fill
+ */
+void FLEXIO_CompileTimerConfig(const flexio_timer_config_t *timerConfig, flexio_timer_image_t *image);
+
+/*!
+ * @brief Applies a precompiled shifter image.
+ *
+ * Both registers are written without reading them back: a peripheral read costs more than the
+ * write it could save.
+ *
+ * @param base  FlexIO peripheral base address
+ * @param index Shifter index
+ * @param image Pointer to the image built by FLEXIO_CompileShifterConfig()
+ */
+static inline void FLEXIO_ApplyShifterImage(FLEXIO_Type *base, uint8_t index, const flexio_shifter_image_t *image)
+{
+    base->SHIFTCFG[index] = image->shiftcfg;
+    base->SHIFTCTL[index] = image->shiftctl;
+}
+
+/*!
+ * @brief Applies a precompiled timer image.
+ *
+ * The registers are written without reading them back, TIMCTL last as FLEXIO_SetTimerConfig()
+ * does, so a timer mode change only takes effect once its configuration and compare are in place.
+ *
+ * @param base  FlexIO peripheral base address
+ * @param index Timer index
+ * @param image Pointer to the image built by FLEXIO_CompileTimerConfig()
+ */
+static inline void FLEXIO_ApplyTimerImage(FLEXIO_Type *base, uint8_t index, const flexio_timer_image_t *image)
+{
+    base->TIMCFG[index] = image->timcfg;
+    base->TIMCMP[index] = image->timcmp;
+    base->TIMCTL[index] = image->timctl;
+}
+
 /*! @} */
 
 /*!
@@ -758,6 +835,35 @@ status_t FLEXIO_RegisterHandleIRQ(void *base, void *handle, flexio_isr_t isr);
  * @retval kStatus_OutOfRange The FlexIO type/handle/ISR table out of range.
  */
 status_t FLEXIO_UnregisterHandleIRQ(void *base);
+
+/*!
+ * @brief Registers a handler for a set of shifter and timer status flags.
+ *
+ * The interrupt handler reads SHIFTSTAT/SHIFTERR/TIMSTAT once and calls only the owners of the
+ * flags which are set and enabled. Each flag has at most one owner. The handlers registered with
+ * FLEXIO_RegisterHandleIRQ() are still called at every interrupt.
+ *
+ * @param base        FlexIO peripheral base address.
+ * @param shifterMask Shifter status/error flags owned by the handler, bit n for shifter n.
+ * @param timerMask   Timer status flags owned by the handler, bit n for timer n.
+ * @param handle      Handler parameter.
+ * @param isr         Interrupt handler, called with the FlexIO base address and handle.
+ * @retval kStatus_Success The handler is registered.
+ * @retval kStatus_OutOfRange No free handler slot.
+ * @retval kStatus_Busy A flag is already owned by another handler.
+ */
+status_t FLEXIO_RegisterFlagHandlerIRQ(
+    FLEXIO_Type *base, uint32_t shifterMask, uint32_t timerMask, void *handle, flexio_isr_t isr);
+
+/*!
+ * @brief Unregisters the flag handler registered with a handle.
+ *
+ * @param base   FlexIO peripheral base address.
+ * @param handle Handler parameter passed to FLEXIO_RegisterFlagHandlerIRQ().
+ * @retval kStatus_Success The handler is unregistered.
+ * @retval kStatus_OutOfRange No handler is registered with this handle.
+ */
+status_t FLEXIO_UnregisterFlagHandlerIRQ(FLEXIO_Type *base, void *handle);
 /*! @} */
 
 #if defined(FSL_FEATURE_FLEXIO_HAS_PIN_REGISTER) && FSL_FEATURE_FLEXIO_HAS_PIN_REGISTER
@@ -0,0 +1,628 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "app_bench.h"
+#include "app_edma.h"
+#include "app_placement.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Distance between the two on-times alternated by the update path benchmark. */
+#define APP_BENCH_DUTY_STEP_TICKS (2U)
+
+/* Background load: flash window read before each run, in bytes, and the read stride (LPCAC line). */
+#define APP_BENCH_FLASH_SWEEP_BYTES  (64U * 1024U)
+#define APP_BENCH_FLASH_SWEEP_STRIDE (16U)
+
+/* Background load: SRAM buffers copied by eDMA, in words. */
+#define APP_BENCH_DMA_LOAD_WORDS (1024U)
+
+/* Polls of the period flag and of the handler before giving up. */
+#define APP_BENCH_WAIT_LIMIT (1000000U)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void APP_BENCH_StartCycleCounter(void);
+static uint32_t APP_BENCH_GetOverhead(void);
+static void APP_BENCH_FlushCodeCache(void);
+static void APP_BENCH_ResetResult(app_bench_result_t *result);
+static void APP_BENCH_AddSample(app_bench_result_t *result, uint64_t *total, uint32_t cycles);
+static uint32_t APP_BENCH_ClampBaseTicks(const flexio_cpwm_handle_t *handle, uint32_t onTicks);
+static void APP_BENCH_StartDmaLoad(uint8_t dmaChannel);
+static void APP_BENCH_KeepDmaLoad(uint8_t dmaChannel);
+static void APP_BENCH_SweepFlash(uint8_t dmaChannel);
+static void APP_BENCH_TimedIRQ(void *base, void *handle);
+static void APP_BENCH_ByteCopy(void *dst, const void *src, size_t n);
+static void APP_BENCH_ByteSet(void *dst, int c, size_t n);
+static void APP_BENCH_ByteMove(void *dst, const void *src, size_t n);
+static int APP_BENCH_ByteCompare(const void *s1, const void *s2, size_t n);
+static int APP_BENCH_MemRun(app_bench_mem_function_t function, bool byteLoop, uint8_t *dst, uint8_t *src, uint32_t size);
+static bool APP_BENCH_MemCheck(app_bench_mem_function_t function, uint8_t *dst, uint8_t *src, uint32_t size);
+
+/* End of the program image, from the generated linker script. */
+extern char __base_Flash[];
+extern char _etext[];
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint32_t s_dmaLoadSrc[APP_BENCH_DMA_LOAD_WORDS];
+static uint32_t s_dmaLoadDst[APP_BENCH_DMA_LOAD_WORDS];
+
+/* Result of the memory function runs, keeps memcmp() from being dropped. */
+static volatile int s_memSink;
+
+/* Written by APP_BENCH_TimedIRQ(). */
+static volatile uint32_t s_isrEntry;
+static volatile uint32_t s_isrExit;
+static volatile bool s_isrDone;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void APP_BENCH_StartCycleCounter(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/* Cycles of two back to back CYCCNT reads, subtracted from every sample. */
+static uint32_t APP_BENCH_GetOverhead(void)
+{
+    uint32_t start = DWT->CYCCNT;
+
+    return DWT->CYCCNT - start;
+}
+
+/* Invalidates the flash code cache, the next fetches come from flash with its wait states. */
+static void APP_BENCH_FlushCodeCache(void)
+{
+    SYSCON->LPCAC_CTRL |= SYSCON_LPCAC_CTRL_CLR_LPCAC_MASK;
+    SYSCON->LPCAC_CTRL &= ~SYSCON_LPCAC_CTRL_CLR_LPCAC_MASK;
+    __DSB();
+    __ISB();
+}
+
+static void APP_BENCH_ResetResult(app_bench_result_t *result)
+{
+    result->minCycles  = UINT32_MAX;
+    result->maxCycles  = 0U;
+    result->meanCycles = 0U;
+}
+
+static void APP_BENCH_AddSample(app_bench_result_t *result, uint64_t *total, uint32_t cycles)
+{
+    *total += cycles;
+    if (cycles < result->minCycles)
+    {
+        result->minCycles = cycles;
+    }
+    if (cycles > result->maxCycles)
+    {
+        result->maxCycles = cycles;
+    }
+}
+
+/* Stays clear of the 0% and 100% special cases, both alternated on-times take the compare path. */
+static uint32_t APP_BENCH_ClampBaseTicks(const flexio_cpwm_handle_t *handle, uint32_t onTicks)
+{
+    if (onTicks < (2U * APP_BENCH_DUTY_STEP_TICKS))
+    {
+        onTicks = 2U * APP_BENCH_DUTY_STEP_TICKS;
+    }
+    if (onTicks > (handle->periodTicks - (2U * APP_BENCH_DUTY_STEP_TICKS)))
+    {
+        onTicks = handle->periodTicks - (2U * APP_BENCH_DUTY_STEP_TICKS);
+    }
+
+    return onTicks;
+}
+
+/* One software started major loop copying the whole load buffer, restarted by APP_BENCH_KeepDmaLoad(). */
+static void APP_BENCH_StartDmaLoad(uint8_t dmaChannel)
+{
+    APP_EDMA_Init();
+    APP_EDMA_ResetChannel(dmaChannel, 0U);
+
+    APP_EDMA_BASEADDR->CH[dmaChannel].TCD_SADDR = (uint32_t)s_dmaLoadSrc;
+    APP_EDMA_BASEADDR->CH[dmaChannel].TCD_SOFF  = sizeof(uint32_t);
+    APP_EDMA_BASEADDR->CH[dmaChannel].TCD_ATTR =
+        DMA_TCD_ATTR_SSIZE(APP_EDMA_SIZE_4BYTES) | DMA_TCD_ATTR_DSIZE(APP_EDMA_SIZE_4BYTES);
+    APP_EDMA_BASEADDR->CH[dmaChannel].TCD_NBYTES_MLOFFNO = sizeof(s_dmaLoadSrc);
+    APP_EDMA_BASEADDR->CH[dmaChannel].TCD_SLAST_SDA      = (uint32_t)(-(int32_t)sizeof(s_dmaLoadSrc));
+    APP_EDMA_BASEADDR->CH[dmaChannel].TCD_DADDR          = (uint32_t)s_dmaLoadDst;
+    APP_EDMA_BASEADDR->CH[dmaChannel].TCD_DOFF           = sizeof(uint32_t);
+    APP_EDMA_BASEADDR->CH[dmaChannel].TCD_CITER_ELINKNO  = 1U;
+    APP_EDMA_BASEADDR->CH[dmaChannel].TCD_DLAST_SGA      = (uint32_t)(-(int32_t)sizeof(s_dmaLoadDst));
+    APP_EDMA_BASEADDR->CH[dmaChannel].TCD_BITER_ELINKNO  = 1U;
+    APP_EDMA_BASEADDR->CH[dmaChannel].TCD_CSR            = DMA_TCD_CSR_START_MASK;
+}
+
+static void APP_BENCH_KeepDmaLoad(uint8_t dmaChannel)
+{
+    if (APP_EDMA_IsDone(dmaChannel))
+    {
+        APP_EDMA_BASEADDR->CH[dmaChannel].CH_CSR  = DMA_CH_CSR_DONE_MASK;
+        APP_EDMA_BASEADDR->CH[dmaChannel].TCD_CSR = DMA_TCD_CSR_START_MASK;
+    }
+}
+
+/* Reads through the program image as a background task would, evicting the LPCAC lines. */
+static void APP_BENCH_SweepFlash(uint8_t dmaChannel)
+{
+    const volatile uint32_t *addr = (const volatile uint32_t *)__base_Flash;
+    uint32_t length               = (uint32_t)_etext - (uint32_t)__base_Flash;
+    uint32_t offset;
+
+    if (length > APP_BENCH_FLASH_SWEEP_BYTES)
+    {
+        length = APP_BENCH_FLASH_SWEEP_BYTES;
+    }
+
+    for (offset = 0U; offset < length; offset += APP_BENCH_FLASH_SWEEP_STRIDE)
+    {
+        (void)addr[offset / sizeof(uint32_t)];
+        APP_BENCH_KeepDmaLoad(dmaChannel);
+    }
+}
+
+/* Stands in for FLEXIO_CPWM_HandleIRQ() during the jitter benchmark. */
+APP_HOT_CODE static void APP_BENCH_TimedIRQ(void *base, void *handle)
+{
+    s_isrEntry = DWT->CYCCNT;
+    FLEXIO_CPWM_HandleIRQ(base, handle);
+    s_isrExit = DWT->CYCCNT;
+    s_isrDone = true;
+}
+
+/*
+ * The byte loops of the Redlib functions. The volatile stores keep the compiler from turning
+ * them back into library calls, they cost the same single strb.
+ */
+__attribute__((noinline)) static void APP_BENCH_ByteCopy(void *dst, const void *src, size_t n)
+{
+    volatile uint8_t *d = (volatile uint8_t *)dst;
+    const uint8_t *s    = (const uint8_t *)src;
+
+    while (n-- != 0U)
+    {
+        *d++ = *s++;
+    }
+}
+
+__attribute__((noinline)) static void APP_BENCH_ByteSet(void *dst, int c, size_t n)
+{
+    volatile uint8_t *d = (volatile uint8_t *)dst;
+
+    while (n-- != 0U)
+    {
+        *d++ = (uint8_t)c;
+    }
+}
+
+__attribute__((noinline)) static void APP_BENCH_ByteMove(void *dst, const void *src, size_t n)
+{
+    volatile uint8_t *d = (volatile uint8_t *)dst;
+    const uint8_t *s    = (const uint8_t *)src;
+
+    if ((uintptr_t)d < (uintptr_t)s)
+    {
+        while (n-- != 0U)
+        {
+            *d++ = *s++;
+        }
+    }
+    else
+    {
+        while (n-- != 0U)
+        {
+            d[n] = s[n];
+        }
+    }
+}
+
+__attribute__((noinline)) static int APP_BENCH_ByteCompare(const void *s1, const void *s2, size_t n)
+{
+    const uint8_t *p1 = (const uint8_t *)s1;
+    const uint8_t *p2 = (const uint8_t *)s2;
+
+    while (n-- != 0U)
+    {
+        if (*p1 != *p2)
+        {
+            return (int)*p1 - (int)*p2;
+        }
+        p1++;
+        p2++;
+    }
+
+    return 0;
+}
+
+/* One call of the function or of its byte loop, the dispatch costs the same to both. */
+__attribute__((noinline)) static int APP_BENCH_MemRun(
+    app_bench_mem_function_t function, bool byteLoop, uint8_t *dst, uint8_t *src, uint32_t size)
+{
+    int ret = 0;
+
+    switch (function)
+    {
+        case kAPP_BenchMemcpy:
+            if (byteLoop)
+            {
+                APP_BENCH_ByteCopy(dst, src, size);
+            }
+            else
+            {
+                (void)memcpy(dst, src, size);
+            }
+            break;
+        case kAPP_BenchMemset:
+            if (byteLoop)
+            {
+                APP_BENCH_ByteSet(dst, 0x5A, size);
+            }
+            else
+            {
+                (void)memset(dst, 0x5A, size);
+            }
+            break;
+        case kAPP_BenchMemmove:
+            if (byteLoop)
+            {
+                APP_BENCH_ByteMove(dst, src, size);
+            }
+            else
+            {
+                (void)memmove(dst, src, size);
+            }
+            break;
+        default:
+            ret = byteLoop ? APP_BENCH_ByteCompare(dst, src, size) : memcmp(dst, src, size);
+            break;
+    }
+
+    return ret;
+}
+
+/* Runs the library function once on known data and checks every byte it produced. */
+static bool APP_BENCH_MemCheck(app_bench_mem_function_t function, uint8_t *dst, uint8_t *src, uint32_t size)
+{
+    bool ok = true;
+    uint32_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        src[i] = (uint8_t)((i * 7U) + 1U);
+    }
+
+    switch (function)
+    {
+        case kAPP_BenchMemcpy:
+            (void)memcpy(dst, src, size);
+            for (i = 0U; i < size; i++)
+            {
+                ok = ok && (dst[i] == (uint8_t)((i * 7U) + 1U));
+            }
+            break;
+        case kAPP_BenchMemset:
+            (void)memset(dst, 0x5A, size);
+            for (i = 0U; i < size; i++)
+            {
+                ok = ok && (dst[i] == 0x5AU);
+            }
+            break;
+        case kAPP_BenchMemmove:
+            /* dst overlaps src from above, the source bytes are overwritten as they are moved. */
+            (void)memmove(dst, src, size);
+            for (i = 0U; i < size; i++)
+            {
+                ok = ok && (dst[i] == (uint8_t)((i * 7U) + 1U));
+            }
+            break;
+        default:
+            for (i = 0U; i < size; i++)
+            {
+                dst[i] = src[i];
+            }
+            ok = (memcmp(dst, src, size) == 0);
+            if ((size != 0U) && ok)
+            {
+                dst[size - 1U]++;
+                ok = (memcmp(dst, src, size) > 0) && (memcmp(src, dst, size) < 0);
+                dst[size - 1U]--;
+            }
+            break;
+    }
+
+    return ok;
+}
+
+/*!
+ * brief Times the duty update path, FLEXIO_CPWM_SetDutyTicks() then FLEXIO_CPWM_Commit().
+ *
+ * param handle     Running engine handle.
+ * param channel    Engine channel, must not be ramped.
+ * param iterations Number of timed runs, not 0.
+ * param cold       true to flush the LPCAC before each run.
+ * param result     Statistics of the runs.
+ * retval kStatus_Success The result is valid.
+ * retval kStatus_InvalidArgument No iteration or the channel is ramped.
+ */
+status_t APP_BENCH_UpdatePath(
+    flexio_cpwm_handle_t *handle, uint8_t channel, uint32_t iterations, bool cold, app_bench_result_t *result)
+{
+    uint32_t savedTicks;
+    uint32_t baseTicks;
+    uint32_t overhead;
+    uint32_t start;
+    uint32_t cycles;
+    uint64_t total = 0U;
+    status_t status;
+    uint32_t i;
+
+    assert(handle != NULL);
+    assert(result != NULL);
+
+    if (iterations == 0U)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    APP_BENCH_StartCycleCounter();
+    overhead = APP_BENCH_GetOverhead();
+
+    savedTicks = FLEXIO_CPWM_GetDutyTicks(handle, channel);
+    baseTicks  = APP_BENCH_ClampBaseTicks(handle, savedTicks);
+
+    APP_BENCH_ResetResult(result);
+
+    for (i = 0U; i < iterations; i++)
+    {
+        uint32_t onTicks = ((i & 1U) != 0U) ? (baseTicks + APP_BENCH_DUTY_STEP_TICKS) : baseTicks;
+
+        if (cold)
+        {
+            APP_BENCH_FlushCodeCache();
+        }
+
+        start  = DWT->CYCCNT;
+        status = FLEXIO_CPWM_SetDutyTicks(handle, channel, onTicks);
+        FLEXIO_CPWM_Commit(handle);
+        cycles = DWT->CYCCNT - start;
+
+        if (status != kStatus_Success)
+        {
+            return kStatus_InvalidArgument;
+        }
+
+        APP_BENCH_AddSample(result, &total, (cycles > overhead) ? (cycles - overhead) : 0U);
+    }
+
+    result->meanCycles = (uint32_t)(total / iterations);
+
+    /* Leave the channel where it was found. */
+    (void)FLEXIO_CPWM_SetDutyTicks(handle, channel, savedTicks);
+    FLEXIO_CPWM_Commit(handle);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Times the update interrupt while memory traffic runs in the background.
+ *
+ * param handle     Running engine handle, without ramp or burst.
+ * param channel    Engine channel.
+ * param iterations Number of timed runs, not 0.
+ * param dmaChannel eDMA channel for the background copies, not used by the application.
+ * param result     Statistics of the runs.
+ * retval kStatus_Success The result is valid.
+ * retval kStatus_InvalidArgument No iteration.
+ * retval kStatus_Busy A ramp or a burst runs, or the handler could not be wrapped.
+ * retval kStatus_Timeout The period timer did not expire.
+ */
+status_t APP_BENCH_IsrJitter(flexio_cpwm_handle_t *handle,
+                             uint8_t channel,
+                             uint32_t iterations,
+                             uint8_t dmaChannel,
+                             app_bench_jitter_result_t *result)
+{
+    FLEXIO_Type *base      = handle->base;
+    uint32_t periodMask    = 1UL << handle->periodTimer;
+    uint32_t flagMask      = periodMask | (1UL << handle->burstTimer);
+    uint64_t latencyTotal  = 0U;
+    uint64_t durationTotal = 0U;
+    uint32_t savedTicks;
+    uint32_t baseTicks;
+    uint32_t overhead;
+    uint32_t start;
+    uint32_t wait;
+    uint32_t edge;
+    uint32_t primask;
+    status_t status = kStatus_Success;
+    uint32_t i;
+
+    assert(result != NULL);
+
+    if (iterations == 0U)
+    {
+        return kStatus_InvalidArgument;
+    }
+    if (handle->rampActive || handle->burstActive)
+    {
+        return kStatus_Busy;
+    }
+
+    APP_BENCH_StartCycleCounter();
+    overhead = APP_BENCH_GetOverhead();
+
+    savedTicks = FLEXIO_CPWM_GetDutyTicks(handle, channel);
+    baseTicks  = APP_BENCH_ClampBaseTicks(handle, savedTicks);
+
+    APP_BENCH_ResetResult(&result->latency);
+    APP_BENCH_ResetResult(&result->duration);
+
+    primask = DisableGlobalIRQ();
+    (void)FLEXIO_UnregisterFlagHandlerIRQ(base, handle);
+    if (kStatus_Success != FLEXIO_RegisterFlagHandlerIRQ(base, 0U, flagMask, handle, APP_BENCH_TimedIRQ))
+    {
+        (void)FLEXIO_RegisterFlagHandlerIRQ(base, 0U, flagMask, handle, FLEXIO_CPWM_HandleIRQ);
+        EnableGlobalIRQ(primask);
+        return kStatus_Busy;
+    }
+    EnableGlobalIRQ(primask);
+
+    APP_BENCH_StartDmaLoad(dmaChannel);
+
+    for (i = 0U; (i < iterations) && (status == kStatus_Success); i++)
+    {
+        APP_BENCH_SweepFlash(dmaChannel);
+
+        (void)FLEXIO_CPWM_SetDutyTicks(handle, channel,
+                                       ((i & 1U) != 0U) ? (baseTicks + APP_BENCH_DUTY_STEP_TICKS) : baseTicks);
+
+        /*
+         * Start right after the period start of the channel, one of the next two edges, the interrupt
+         * is then taken as soon as it is enabled and commits.
+         */
+        for (edge = 0U; edge < 2U; edge++)
+        {
+            FLEXIO_ClearTimerStatusFlags(base, periodMask);
+            for (wait = 0U;
+                 (0U == (FLEXIO_GetTimerStatusFlags(base) & periodMask)) && (wait < APP_BENCH_WAIT_LIMIT); wait++)
+            {
+                APP_BENCH_KeepDmaLoad(dmaChannel);
+            }
+            if (0U != (FLEXIO_CPWM_GetBoundaryMask(handle) & (1UL << channel)))
+            {
+                break;
+            }
+        }
+
+        /* FLEXIO_CPWM_Update() would clear the fresh flag and wait for the next edge. */
+        s_isrDone = false;
+        start     = DWT->CYCCNT;
+        FLEXIO_EnableTimerStatusInterrupts(base, periodMask);
+        for (wait = 0U; (!s_isrDone) && (wait < APP_BENCH_WAIT_LIMIT); wait++)
+        {
+        }
+
+        if (!s_isrDone)
+        {
+            status = kStatus_Timeout;
+            break;
+        }
+
+        APP_BENCH_AddSample(&result->latency, &latencyTotal,
+                            ((s_isrEntry - start) > overhead) ? (s_isrEntry - start - overhead) : 0U);
+        APP_BENCH_AddSample(&result->duration, &durationTotal,
+                            ((s_isrExit - s_isrEntry) > overhead) ? (s_isrExit - s_isrEntry - overhead) : 0U);
+    }
+
+    /* No hardware request, this waits for the copy in flight. */
+    APP_EDMA_StopChannel(dmaChannel);
+
+    primask = DisableGlobalIRQ();
+    (void)FLEXIO_UnregisterFlagHandlerIRQ(base, handle);
+    (void)FLEXIO_RegisterFlagHandlerIRQ(base, 0U, flagMask, handle, FLEXIO_CPWM_HandleIRQ);
+    EnableGlobalIRQ(primask);
+
+    (void)FLEXIO_CPWM_SetDutyTicks(handle, channel, savedTicks);
+    FLEXIO_CPWM_Commit(handle);
+
+    if (status == kStatus_Success)
+    {
+        result->latency.meanCycles  = (uint32_t)(latencyTotal / iterations);
+        result->duration.meanCycles = (uint32_t)(durationTotal / iterations);
+    }
+
+    return status;
+}
+
+/*!
+ * brief Times a C library memory function against the byte loop it replaces.
+ *
+ * param function   Function to time.
+ * param size       Bytes per call, up to APP_BENCH_MEM_MAX_SIZE.
+ * param dstOffset  Destination (first operand of memcmp) offset from a word boundary, [0, 3].
+ * param srcOffset  Source (second operand of memcmp) offset from a word boundary, [0, 3].
+ * param iterations Number of timed runs, not 0.
+ * param result     Statistics of the runs.
+ * retval kStatus_Success The result is valid.
+ * retval kStatus_InvalidArgument A parameter is out of range.
+ * retval kStatus_Fail The function returned a wrong result.
+ */
+status_t APP_BENCH_MemFunction(app_bench_mem_function_t function,
+                               uint32_t size,
+                               uint32_t dstOffset,
+                               uint32_t srcOffset,
+                               uint32_t iterations,
+                               app_bench_mem_result_t *result)
+{
+    uint8_t *src = (uint8_t *)s_dmaLoadSrc + srcOffset;
+    uint8_t *dst = (uint8_t *)s_dmaLoadDst + dstOffset;
+    app_bench_result_t *stats;
+    uint64_t total;
+    uint32_t overhead;
+    uint32_t primask;
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t pass;
+    uint32_t i;
+    int sink = 0;
+
+    assert(result != NULL);
+
+    if ((iterations == 0U) || (size > APP_BENCH_MEM_MAX_SIZE) || (dstOffset > 3U) || (srcOffset > 3U) ||
+        (function > kAPP_BenchMemcmp))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* memmove works within the source buffer, a few bytes above the source. */
+    if (function == kAPP_BenchMemmove)
+    {
+        dst = (uint8_t *)s_dmaLoadSrc + sizeof(uint32_t) + dstOffset;
+    }
+
+    if (!APP_BENCH_MemCheck(function, dst, src, size))
+    {
+        return kStatus_Fail;
+    }
+
+    APP_BENCH_StartCycleCounter();
+    overhead = APP_BENCH_GetOverhead();
+
+    /* First pass the linked function, second pass the byte loop. */
+    for (pass = 0U; pass < 2U; pass++)
+    {
+        stats = (pass == 0U) ? &result->library : &result->byteLoop;
+        total = 0U;
+        APP_BENCH_ResetResult(stats);
+
+        for (i = 0U; i < iterations; i++)
+        {
+            primask = DisableGlobalIRQ();
+            start   = DWT->CYCCNT;
+            sink += APP_BENCH_MemRun(function, pass != 0U, dst, src, size);
+            cycles = DWT->CYCCNT - start;
+            EnableGlobalIRQ(primask);
+
+            APP_BENCH_AddSample(stats, &total, (cycles > overhead) ? (cycles - overhead) : 0U);
+        }
+
+        stats->meanCycles = (uint32_t)(total / iterations);
+    }
+
+    s_memSink = sink;
+
+    return kStatus_Success;
+}
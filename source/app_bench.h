@@ -0,0 +1,138 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_BENCH_H_
+#define APP_BENCH_H_
+
+#include "fsl_common.h"
+#include "flexio_cpwm.h"
+
+/*!
+ * @addtogroup app_bench
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Cycle statistics of a benchmark, in core clocks, DWT overhead removed. */
+typedef struct _app_bench_result
+{
+    uint32_t minCycles;  /*!< Fastest run. */
+    uint32_t maxCycles;  /*!< Slowest run. */
+    uint32_t meanCycles; /*!< Average run. */
+} app_bench_result_t;
+
+/*! @brief Update interrupt timing under background memory load, in core clocks. */
+typedef struct _app_bench_jitter_result
+{
+    app_bench_result_t latency;  /*!< From the interrupt enable to the handler entry. */
+    app_bench_result_t duration; /*!< FLEXIO_CPWM_HandleIRQ() run time. */
+} app_bench_jitter_result_t;
+
+/*! @brief Largest size timed by APP_BENCH_MemFunction(), in bytes. */
+#define APP_BENCH_MEM_MAX_SIZE (1024U)
+
+/*! @brief C library memory functions timed by APP_BENCH_MemFunction(). */
+typedef enum _app_bench_mem_function
+{
+    kAPP_BenchMemcpy  = 0U, /*!< memcpy() between two buffers. */
+    kAPP_BenchMemset  = 1U, /*!< memset() of the destination. */
+    kAPP_BenchMemmove = 2U, /*!< memmove() a few bytes up within one buffer, copied back to front. */
+    kAPP_BenchMemcmp  = 3U, /*!< memcmp() of two equal buffers, the whole size is compared. */
+} app_bench_mem_function_t;
+
+/*! @brief Memory function timing, in core clocks. */
+typedef struct _app_bench_mem_result
+{
+    app_bench_result_t library;  /*!< The linked function, from utilities/fsl_mem*.S when overridden. */
+    app_bench_result_t byteLoop; /*!< The byte by byte loop of Redlib, on the same buffers. */
+} app_bench_mem_result_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Times the duty update path, FLEXIO_CPWM_SetDutyTicks() then FLEXIO_CPWM_Commit().
+ *
+ * The channel alternates two on-times close to its current one and is restored at the end.
+ * With cold set the LPCAC is flushed before each run, as after a burst of unrelated code, so the
+ * figures show the worst case of code fetched from flash. Build once with APP_PLACEMENT_ENABLE 0
+ * and once with 1 to compare flash and RAM placement.
+ *
+ * @param handle     Running engine handle.
+ * @param channel    Engine channel, must not be ramped.
+ * @param iterations Number of timed runs, not 0.
+ * @param cold       true to flush the LPCAC before each run.
+ * @param result     Statistics of the runs.
+ * @retval kStatus_Success The result is valid.
+ * @retval kStatus_InvalidArgument No iteration or the channel is ramped.
+ */
+status_t APP_BENCH_UpdatePath(
+    flexio_cpwm_handle_t *handle, uint8_t channel, uint32_t iterations, bool cold, app_bench_result_t *result);
+
+/*!
+ * @brief Times the update interrupt while memory traffic runs in the background.
+ *
+ * The engine interrupt handler is wrapped for the duration of the benchmark. At each run a duty
+ * is staged and the period timer interrupt enabled right after the period start of the channel,
+ * the interrupt is then taken at once and commits. In the background an eDMA channel copies between two SRAM buffers and, before
+ * each run, the core reads through a flash window larger than the LPCAC, as an unrelated task
+ * would. The spread between min and max is the jitter to compare between the timing presets.
+ *
+ * @param handle     Running engine handle, without ramp or burst.
+ * @param channel    Engine channel.
+ * @param iterations Number of timed runs, not 0.
+ * @param dmaChannel eDMA channel for the background copies, not used by the application.
+ * @param result     Statistics of the runs.
+ * @retval kStatus_Success The result is valid.
+ * @retval kStatus_InvalidArgument No iteration.
+ * @retval kStatus_Busy A ramp or a burst runs, or the handler could not be wrapped.
+ * @retval kStatus_Timeout The period timer did not expire.
+ */
+status_t APP_BENCH_IsrJitter(flexio_cpwm_handle_t *handle,
+                             uint8_t channel,
+                             uint32_t iterations,
+                             uint8_t dmaChannel,
+                             app_bench_jitter_result_t *result);
+
+/*!
+ * @brief Times a C library memory function against the byte loop it replaces.
+ *
+ * The buffers are in SRAM and the runs are done with the interrupts masked. The result of the
+ * function is checked once before the runs, so a broken override is reported rather than timed.
+ *
+ * @param function   Function to time.
+ * @param size       Bytes per call, up to APP_BENCH_MEM_MAX_SIZE.
+ * @param dstOffset  Destination (first operand of memcmp) offset from a word boundary, [0, 3].
+ * @param srcOffset  Source (second operand of memcmp) offset from a word boundary, [0, 3], unused
+ *                   by memset.
+ * @param iterations Number of timed runs, not 0.
+ * @param result     Statistics of the runs.
+ * @retval kStatus_Success The result is valid.
+ * @retval kStatus_InvalidArgument A parameter is out of range.
+ * @retval kStatus_Fail The function returned a wrong result.
+ */
+status_t APP_BENCH_MemFunction(app_bench_mem_function_t function,
+                               uint32_t size,
+                               uint32_t dstOffset,
+                               uint32_t srcOffset,
+                               uint32_t iterations,
+                               app_bench_mem_result_t *result);
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_BENCH_H_ */
@@ -0,0 +1,463 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "app_capture.h"
+#include "app_edma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* FXIO_D0..D31, the pin selects are 5 bits wide. */
+#define APP_CAPTURE_PIN_COUNT (32U)
+
+/* Capture progress. */
+typedef enum _app_capture_state
+{
+    kAPP_CaptureIdle      = 0U, /* Never armed. */
+    kAPP_CaptureArmed     = 1U, /* Searching for the trigger. */
+    kAPP_CaptureTriggered = 2U, /* Recording the words after the trigger. */
+    kAPP_CaptureDone      = 3U, /* Stopped, the result is valid. */
+} app_capture_state_t;
+
+/* Logic capture state, thread level only. Word positions count from the first word of the capture. */
+typedef struct _app_capture
+{
+    FLEXIO_Type *base;
+    uint8_t shifter;
+    uint8_t timer;
+    uint8_t dmaChannel;
+    uint8_t state;
+    bool triggerEdge;
+    bool lastMatch;   /* Last sample searched matched the trigger */
+    bool doneCounted; /* Wrap counted before the eDMA DONE flag was seen */
+    uint32_t *buffer;
+    uint32_t bufferWords;
+    uint32_t postTriggerWords;
+    uint32_t maskLanes;  /* Trigger mask repeated in every sample lane */
+    uint32_t valueLanes; /* Trigger value repeated in every sample lane */
+    uint32_t laneTops;   /* Top bit of every sample lane */
+    uint32_t ringStart;  /* Position of buffer[0] in the current pass */
+    uint32_t lastIndex;  /* Buffer index the eDMA wrote next at the last poll */
+    uint32_t searched;   /* Position of the next word to search */
+    uint32_t stopAt;     /* Position ending the capture once triggered */
+    uint32_t triggerWord;
+    uint32_t triggerLane;
+    app_capture_result_t result;
+} app_capture_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t APP_CAPTURE_GetWritten(bool *late);
+static void APP_CAPTURE_Search(uint32_t written);
+static void APP_CAPTURE_Finish(void);
+static void APP_CAPTURE_Reverse(uint32_t *words, uint32_t count);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static app_capture_t s_capture;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*
+ * Words written by the eDMA since the start. The channel raises DONE at every wrap of the buffer:
+ * a DONE without the index going back means a whole buffer went by since the last poll. A wrap
+ * between reading DONE and the index is counted from the index, its DONE is then skipped once.
+ */
+static uint32_t APP_CAPTURE_GetWritten(bool *late)
+{
+    uint8_t channel = s_capture.dmaChannel;
+    uint32_t csr;
+    uint32_t index;
+    bool done;
+
+    csr  = APP_EDMA_BASEADDR->CH[channel].CH_CSR;
+    done = (0U != (csr & DMA_CH_CSR_DONE_MASK));
+    if (done)
+    {
+        APP_EDMA_BASEADDR->CH[channel].CH_CSR = csr; /* DONE is write 1 to clear, ERQ is kept. */
+        if (s_capture.doneCounted)
+        {
+            s_capture.doneCounted = false;
+            done                  = false;
+        }
+    }
+    index = s_capture.bufferWords - APP_EDMA_GetRemainingMajorLoopCount(channel);
+
+    if (index < s_capture.lastIndex)
+    {
+        s_capture.ringStart += s_capture.bufferWords;
+        s_capture.doneCounted = !done;
+    }
+    else if (done)
+    {
+        s_capture.ringStart += s_capture.bufferWords;
+        *late = true;
+    }
+    else
+    {
+        /* No wrap since the last poll. */
+    }
+    s_capture.lastIndex = index;
+
+    return s_capture.ringStart + index;
+}
+
+/*
+ * Searches the words up to written for the trigger. A sample lane is zero after XOR with the value
+ * and AND with the mask when it matches; the carry-free zero test marks the top bit of every such
+ * lane, the lowest mark is the first matching sample.
+ */
+static void APP_CAPTURE_Search(uint32_t written)
+{
+    uint32_t width = s_capture.result.pinCount;
+    uint32_t lows  = ~s_capture.laneTops;
+    uint32_t index = s_capture.searched % s_capture.bufferWords;
+    uint32_t diff;
+    uint32_t matches;
+    uint32_t previous;
+    uint32_t hits;
+
+    while (s_capture.searched != written)
+    {
+        diff    = (s_capture.buffer[index] ^ s_capture.valueLanes) & s_capture.maskLanes;
+        matches = ~(((diff & lows) + lows) | diff) & s_capture.laneTops;
+        hits    = matches;
+        if (s_capture.triggerEdge)
+        {
+            /* Drop the lanes whose previous sample matched too. */
+            previous = (matches << width) | (s_capture.lastMatch ? (1UL << (width - 1U)) : 0U);
+            hits &= ~previous;
+        }
+        s_capture.lastMatch = (0U != (matches & 0x80000000U));
+
+        if (hits != 0U)
+        {
+            s_capture.triggerWord = s_capture.searched;
+            s_capture.triggerLane = __CLZ(__RBIT(hits)) / width;
+            s_capture.stopAt      = s_capture.searched + 1U + s_capture.postTriggerWords;
+            s_capture.state       = (uint8_t)kAPP_CaptureTriggered;
+            s_capture.searched    = written;
+            return;
+        }
+
+        s_capture.searched++;
+        index = (index + 1U == s_capture.bufferWords) ? 0U : (index + 1U);
+    }
+}
+
+/* Reverses count words in place. */
+static void APP_CAPTURE_Reverse(uint32_t *words, uint32_t count)
+{
+    uint32_t *last = &words[count];
+    uint32_t word;
+
+    while (words < --last)
+    {
+        word     = *words;
+        *words++ = *last;
+        *last    = word;
+    }
+}
+
+/* Stops the eDMA, releases the FlexIO resources and rotates the buffer oldest first. */
+static void APP_CAPTURE_Finish(void)
+{
+    bool late = false;
+    uint32_t written;
+    uint32_t oldest;
+    uint32_t first;
+
+    APP_EDMA_StopChannel(s_capture.dmaChannel);
+    written = APP_CAPTURE_GetWritten(&late);
+    APP_CAPTURE_Deinit();
+
+    oldest = (written > s_capture.bufferWords) ? (written - s_capture.bufferWords) : 0U;
+    first  = oldest % s_capture.bufferWords;
+    if (first != 0U)
+    {
+        /* Left rotation by first words: reverse both parts, then the whole buffer. */
+        APP_CAPTURE_Reverse(&s_capture.buffer[0], first);
+        APP_CAPTURE_Reverse(&s_capture.buffer[first], s_capture.bufferWords - first);
+        APP_CAPTURE_Reverse(&s_capture.buffer[0], s_capture.bufferWords);
+    }
+
+    if (late)
+    {
+        s_capture.result.late++;
+    }
+    s_capture.result.wordCount = written - oldest;
+    if ((s_capture.triggerWord >= oldest) && (s_capture.triggerWord < written))
+    {
+        s_capture.result.triggerSample = ((s_capture.triggerWord - oldest) * (32U / s_capture.result.pinCount)) +
+                                         s_capture.triggerLane;
+    }
+    s_capture.state = (uint8_t)kAPP_CaptureDone;
+}
+
+/*!
+ * brief Gets the default configuration: 8 pins from FXIO_D24, 10 MHz, shifter 6, timer 6, eDMA
+ * channel 3, trigger on the first sample.
+ *
+ * param config Pointer to the configuration structure.
+ */
+void APP_CAPTURE_GetDefaultConfig(app_capture_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->sampleRate_Hz = 10000000U;
+    config->firstPin      = 24U;
+    config->pinCount      = 8U;
+    config->shifter       = 6U;
+    config->timer         = 6U;
+    config->dmaChannel    = 3U;
+}
+
+/*!
+ * brief Arms a capture on a FlexIO instance.
+ *
+ * param base   FlexIO peripheral base address.
+ * param config Logic capture configuration.
+ * retval kStatus_Success The capture runs and searches for the trigger.
+ * retval kStatus_InvalidArgument Pin, rate, trigger or buffer out of range.
+ * retval kStatus_Busy The shifter or the timer is in use.
+ */
+status_t APP_CAPTURE_Init(FLEXIO_Type *base, const app_capture_config_t *config)
+{
+    assert(base != NULL);
+    assert(config != NULL);
+
+    flexio_shifter_config_t shifterConfig;
+    flexio_timer_config_t timerConfig;
+    uint32_t samplesPerWord;
+    uint32_t lanes;
+    uint32_t divider;
+    uint32_t words  = config->bufferWords;
+    uint8_t channel = config->dmaChannel;
+
+    if ((config->pinCount != 1U) && (config->pinCount != 2U) && (config->pinCount != 4U) &&
+        (config->pinCount != 8U))
+    {
+        return kStatus_InvalidArgument;
+    }
+    if (((config->firstPin + config->pinCount) > APP_CAPTURE_PIN_COUNT) || (config->shifter >= FLEXIO_SHIFTBUF_COUNT) ||
+        (config->timer >= FLEXIO_TIMCTL_COUNT))
+    {
+        return kStatus_InvalidArgument;
+    }
+    if ((config->triggerMask >= (1U << config->pinCount)) || ((config->triggerValue & ~config->triggerMask) != 0U) ||
+        (config->triggerEdge && (config->triggerMask == 0U)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Same shift clock as the pattern generator: divider FlexIO clocks per timer output edge. */
+    if ((config->sampleRate_Hz == 0U) || (config->sampleRate_Hz > (config->srcClock_Hz / 2U)))
+    {
+        return kStatus_InvalidArgument;
+    }
+    divider = (config->srcClock_Hz + config->sampleRate_Hz) / (2U * config->sampleRate_Hz);
+    if (divider > 256U)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if ((config->buffer == NULL) || (words == 0U) || (words > DMA_TCD_CITER_ELINKNO_CITER_MASK) ||
+        (config->postTriggerWords >= words))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    APP_CAPTURE_Deinit();
+
+    /* The PWM and the other modes keep their own shifters and timers. */
+    if ((base->SHIFTCTL[config->shifter] != 0U) || (base->TIMCTL[config->timer] != 0U))
+    {
+        return kStatus_Busy;
+    }
+
+    samplesPerWord = 32U / config->pinCount;
+    lanes          = 0xFFFFFFFFU / ((1UL << config->pinCount) - 1U);
+
+    (void)memset(&s_capture, 0, sizeof(s_capture));
+    s_capture.base                 = base;
+    s_capture.shifter              = config->shifter;
+    s_capture.timer                = config->timer;
+    s_capture.dmaChannel           = channel;
+    s_capture.state                = (uint8_t)kAPP_CaptureArmed;
+    s_capture.triggerEdge          = config->triggerEdge;
+    s_capture.lastMatch            = true; /* Whatever ran before the capture does not trigger an edge */
+    s_capture.buffer               = config->buffer;
+    s_capture.bufferWords          = words;
+    s_capture.postTriggerWords     = config->postTriggerWords;
+    s_capture.maskLanes            = lanes * config->triggerMask;
+    s_capture.valueLanes           = lanes * config->triggerValue;
+    s_capture.laneTops             = lanes << (config->pinCount - 1U);
+    s_capture.result.words         = config->buffer;
+    s_capture.result.sampleRate_Hz = config->srcClock_Hz / (2U * divider);
+    s_capture.result.firstPin      = config->firstPin;
+    s_capture.result.pinCount      = config->pinCount;
+    s_capture.result.triggerSample = APP_CAPTURE_NO_TRIGGER;
+
+    /* Circular drain: the destination wraps at the end of every major loop, the request stays on. */
+    APP_EDMA_Init();
+    APP_EDMA_ResetChannel(channel, APP_EDMA_GetFlexioRequest(FLEXIO_GetInstance(base), config->shifter));
+    APP_EDMA_BASEADDR->CH[channel].TCD_SADDR =
+        FLEXIO_GetShifterBufferAddress(base, kFLEXIO_ShifterBuffer, config->shifter);
+    APP_EDMA_BASEADDR->CH[channel].TCD_SOFF = 0U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_ATTR =
+        DMA_TCD_ATTR_SSIZE(APP_EDMA_SIZE_4BYTES) | DMA_TCD_ATTR_DSIZE(APP_EDMA_SIZE_4BYTES);
+    APP_EDMA_BASEADDR->CH[channel].TCD_NBYTES_MLOFFNO = 4U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_DADDR          = (uint32_t)&config->buffer[0];
+    APP_EDMA_BASEADDR->CH[channel].TCD_DOFF           = 4U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_DLAST_SGA      = (uint32_t)(-(int32_t)(words * 4U));
+    APP_EDMA_BASEADDR->CH[channel].TCD_CITER_ELINKNO  = (uint16_t)words;
+    APP_EDMA_BASEADDR->CH[channel].TCD_BITER_ELINKNO  = (uint16_t)words;
+    APP_EDMA_EnableRequest(channel);
+
+    shifterConfig.timerSelect   = config->timer;
+    shifterConfig.timerPolarity = kFLEXIO_ShifterTimerPolarityOnPositive;
+    shifterConfig.pinConfig     = kFLEXIO_PinConfigOutputDisabled;
+    shifterConfig.pinSelect     = config->firstPin;
+    shifterConfig.pinPolarity   = kFLEXIO_PinActiveHigh;
+    shifterConfig.shifterMode   = kFLEXIO_ShifterModeReceive;
+    shifterConfig.parallelWidth = (uint32_t)config->pinCount - 1U;
+    shifterConfig.inputSource   = kFLEXIO_ShifterInputFromPin;
+    shifterConfig.shifterStop   = kFLEXIO_ShifterStopBitDisable;
+    shifterConfig.shifterStart  = kFLEXIO_ShifterStartBitDisabledLoadDataOnEnable;
+    FLEXIO_ClearShifterErrorFlags(base, 1UL << config->shifter);
+    FLEXIO_SetShifterConfig(base, config->shifter, &shifterConfig);
+    FLEXIO_EnableShifterStatusDMA(base, 1UL << config->shifter, true);
+
+    /* Free running from here: one shifter store per 32 bits. */
+    timerConfig.triggerSelect   = FLEXIO_TIMER_TRIGGER_SEL_SHIFTnSTAT(config->shifter);
+    timerConfig.triggerPolarity = kFLEXIO_TimerTriggerPolarityActiveHigh;
+    timerConfig.triggerSource   = kFLEXIO_TimerTriggerSourceInternal;
+    timerConfig.pinConfig       = kFLEXIO_PinConfigOutputDisabled;
+    timerConfig.pinSelect       = 0U;
+    timerConfig.pinPolarity     = kFLEXIO_PinActiveHigh;
+    timerConfig.timerMode       = kFLEXIO_TimerModeDual8BitBaudBit;
+    timerConfig.timerOutput     = kFLEXIO_TimerOutputZeroNotAffectedByReset;
+    timerConfig.timerDecrement  = kFLEXIO_TimerDecSrcOnFlexIOClockShiftTimerOutput;
+    timerConfig.timerReset      = kFLEXIO_TimerResetNever;
+    timerConfig.timerDisable    = kFLEXIO_TimerDisableNever;
+    timerConfig.timerEnable     = kFLEXIO_TimerEnabledAlways;
+    timerConfig.timerStop       = kFLEXIO_TimerStopBitDisabled;
+    timerConfig.timerStart      = kFLEXIO_TimerStartBitDisabled;
+    timerConfig.timerCompare    = (((2U * samplesPerWord) - 1U) << 8U) | (divider - 1U);
+    FLEXIO_SetTimerConfig(base, config->timer, &timerConfig);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops the capture and releases the shifter and the timer.
+ */
+void APP_CAPTURE_Deinit(void)
+{
+    FLEXIO_Type *base = s_capture.base;
+
+    if (base == NULL)
+    {
+        return;
+    }
+
+    APP_EDMA_StopChannel(s_capture.dmaChannel);
+    base->TIMCTL[s_capture.timer] = 0U;
+    FLEXIO_EnableShifterStatusDMA(base, 1UL << s_capture.shifter, false);
+    base->SHIFTCTL[s_capture.shifter] = 0U;
+    s_capture.base                    = NULL;
+    if (s_capture.state != (uint8_t)kAPP_CaptureDone)
+    {
+        s_capture.state = (uint8_t)kAPP_CaptureIdle;
+    }
+}
+
+/*!
+ * brief Searches the new words for the trigger and ends the capture, call it from the main loop.
+ *
+ * retval kStatus_Success Nothing to report.
+ * retval kStatus_APP_CaptureLate Words were overwritten before they were searched.
+ * retval kStatus_APP_CaptureOverrun The shifter stored a word before the eDMA read the previous one.
+ */
+status_t APP_CAPTURE_Poll(void)
+{
+    FLEXIO_Type *base = s_capture.base;
+    status_t status   = kStatus_Success;
+    bool late         = false;
+    uint32_t written;
+
+    if (base == NULL)
+    {
+        return kStatus_Success;
+    }
+
+    if (0U != (FLEXIO_GetShifterErrorFlags(base) & (1UL << s_capture.shifter)))
+    {
+        FLEXIO_ClearShifterErrorFlags(base, 1UL << s_capture.shifter);
+        s_capture.result.overruns++;
+        status = kStatus_APP_CaptureOverrun;
+    }
+
+    written = APP_CAPTURE_GetWritten(&late);
+    if ((s_capture.state == (uint8_t)kAPP_CaptureArmed) && ((written - s_capture.searched) > s_capture.bufferWords))
+    {
+        /* Start over from the words still in the buffer, an edge needs a fresh miss first. */
+        s_capture.searched  = written - s_capture.bufferWords;
+        s_capture.lastMatch = true;
+        late                = true;
+    }
+    if (late)
+    {
+        s_capture.result.late++;
+        status = kStatus_APP_CaptureLate;
+    }
+
+    if (s_capture.state == (uint8_t)kAPP_CaptureArmed)
+    {
+        APP_CAPTURE_Search(written);
+    }
+    if ((s_capture.state == (uint8_t)kAPP_CaptureTriggered) && ((int32_t)(written - s_capture.stopAt) >= 0))
+    {
+        APP_CAPTURE_Finish();
+    }
+
+    return status;
+}
+
+/*!
+ * brief Gets the result of the last capture.
+ *
+ * param result Pointer to the result structure.
+ * retval kStatus_Success The capture is finished, result is filled.
+ * retval kStatus_APP_CaptureBusy The capture still runs.
+ * retval kStatus_Fail No capture was armed.
+ */
+status_t APP_CAPTURE_GetResult(app_capture_result_t *result)
+{
+    assert(result != NULL);
+
+    if (s_capture.state == (uint8_t)kAPP_CaptureIdle)
+    {
+        return kStatus_Fail;
+    }
+    if (s_capture.state != (uint8_t)kAPP_CaptureDone)
+    {
+        return kStatus_APP_CaptureBusy;
+    }
+
+    *result = s_capture.result;
+
+    return kStatus_Success;
+}
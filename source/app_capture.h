@@ -0,0 +1,153 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_CAPTURE_H_
+#define APP_CAPTURE_H_
+
+#include "fsl_common.h"
+#include "fsl_flexio.h"
+
+/*!
+ * @addtogroup app_capture
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * On-chip logic capture of up to 8 FlexIO pins, next to the PWM.
+ *
+ * One shifter runs in parallel receive mode: every shift clock it samples pins firstPin.. into its
+ * top pinCount bits, a 32-bit word carries 32 / pinCount samples, the first one in its lowest bits.
+ * A free running timer in 8-bit baud mode makes the shift clock, so the samples are evenly spaced.
+ * The pin inputs read back the pads, the PWM outputs included.
+ *
+ * An eDMA channel moves every word into a circular buffer in SRAM. APP_CAPTURE_Poll() searches the
+ * new words for the trigger: the first sample whose masked pins equal the trigger value, or with
+ * triggerEdge the first one which does after one which did not. All the lanes of a word are compared
+ * at once. Once postTriggerWords more words are in, the eDMA is stopped and the buffer rotated, so
+ * it holds the samples before and after the trigger oldest first. A zero trigger mask triggers on
+ * the first sample.
+ *
+ * The trigger search runs at thread level and must keep up with the eDMA: words overwritten before
+ * they were searched are counted as late. The shifter error flag (SHIFTERR) reports an overrun, a
+ * word the eDMA did not read in time, the samples are no longer evenly spaced.
+ */
+
+/*! @brief No trigger in the result. */
+#define APP_CAPTURE_NO_TRIGGER (0xFFFFFFFFU)
+
+/*! @brief Status group of the logic capture. */
+#define kStatusGroup_APP_CAPTURE (kStatusGroup_ApplicationRangeStart + 3)
+
+/*! @brief Error codes of the logic capture. */
+enum
+{
+    kStatus_APP_CaptureBusy    = MAKE_STATUS(kStatusGroup_APP_CAPTURE, 0), /*!< The capture runs. */
+    kStatus_APP_CaptureOverrun = MAKE_STATUS(kStatusGroup_APP_CAPTURE, 1), /*!< The shifter overran. */
+    kStatus_APP_CaptureLate    = MAKE_STATUS(kStatusGroup_APP_CAPTURE, 2), /*!< Words were not searched in time. */
+};
+
+/*! @brief Logic capture configuration. */
+typedef struct _app_capture_config
+{
+    uint32_t srcClock_Hz;      /*!< FlexIO clock frequency. */
+    uint32_t sampleRate_Hz;    /*!< Samples per second, up to srcClock_Hz / 2. */
+    uint8_t firstPin;          /*!< FlexIO pin of the lowest sample bit. */
+    uint8_t pinCount;          /*!< Bits per sample: 1, 2, 4 or 8. */
+    uint8_t shifter;           /*!< FlexIO shifter in parallel receive mode. */
+    uint8_t timer;             /*!< FlexIO timer making the shift clock. */
+    uint8_t dmaChannel;        /*!< eDMA channel draining the shifter. */
+    bool triggerEdge;          /*!< Trigger when the pins start to match only. */
+    uint8_t triggerMask;       /*!< Sample bits compared, 0 to trigger on the first sample. */
+    uint8_t triggerValue;      /*!< Value of the compared bits. */
+    uint32_t *buffer;          /*!< Circular buffer of bufferWords words. */
+    uint32_t bufferWords;      /*!< Words of the buffer. */
+    uint32_t postTriggerWords; /*!< Words kept after the one holding the trigger, less than bufferWords. */
+} app_capture_config_t;
+
+/*! @brief Logic capture result. */
+typedef struct _app_capture_result
+{
+    const uint32_t *words;  /*!< Samples, oldest first, the configured buffer. */
+    uint32_t wordCount;     /*!< Words captured. */
+    uint32_t sampleRate_Hz; /*!< Sample rate, the nearest the FlexIO clock divides to. */
+    uint8_t firstPin;       /*!< FlexIO pin of the lowest sample bit. */
+    uint8_t pinCount;       /*!< Bits per sample. */
+    uint32_t triggerSample; /*!< Sample index of the trigger in words, APP_CAPTURE_NO_TRIGGER if lost. */
+    uint32_t late;          /*!< Polls which found words overwritten before they were searched. */
+    uint32_t overruns;      /*!< Polls which found the shifter error flag set. */
+} app_capture_result_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Gets the default configuration: 8 pins from FXIO_D24, 10 MHz, shifter 6, timer 6, eDMA
+ * channel 3, trigger on the first sample.
+ *
+ * srcClock_Hz, buffer, bufferWords and postTriggerWords are left zero and must be filled by the
+ * caller.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void APP_CAPTURE_GetDefaultConfig(app_capture_config_t *config);
+
+/*!
+ * @brief Arms a capture on a FlexIO instance.
+ *
+ * The shifter and the timer must be free, the rest of the instance keeps running.
+ *
+ * @param base   FlexIO peripheral base address.
+ * @param config Logic capture configuration.
+ * @retval kStatus_Success The capture runs and searches for the trigger.
+ * @retval kStatus_InvalidArgument Pin, rate, trigger or buffer out of range.
+ * @retval kStatus_Busy The shifter or the timer is in use.
+ */
+status_t APP_CAPTURE_Init(FLEXIO_Type *base, const app_capture_config_t *config);
+
+/*!
+ * @brief Stops the capture and releases the shifter and the timer.
+ *
+ * A finished capture has already released them, its result stays available.
+ */
+void APP_CAPTURE_Deinit(void);
+
+/*!
+ * @brief Searches the new words for the trigger and ends the capture, call it from the main loop.
+ *
+ * Poll at least once per buffer, bufferWords * 32 / pinCount samples.
+ *
+ * @retval kStatus_Success Nothing to report.
+ * @retval kStatus_APP_CaptureLate Words were overwritten before they were searched.
+ * @retval kStatus_APP_CaptureOverrun The shifter stored a word before the eDMA read the previous one.
+ */
+status_t APP_CAPTURE_Poll(void);
+
+/*!
+ * @brief Gets the result of the last capture.
+ *
+ * @param result Pointer to the result structure.
+ * @retval kStatus_Success The capture is finished, result is filled.
+ * @retval kStatus_APP_CaptureBusy The capture still runs.
+ * @retval kStatus_Fail No capture was armed.
+ */
+status_t APP_CAPTURE_GetResult(app_capture_result_t *result);
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_CAPTURE_H_ */
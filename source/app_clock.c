@@ -0,0 +1,156 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "app_clock.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t APP_CLOCK_GetFlexioSourceFreq(clock_attach_id_t source);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static app_clock_listener_t *s_clockListeners;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Frequency of a FlexIO clock source, known before the mux is switched. */
+static uint32_t APP_CLOCK_GetFlexioSourceFreq(clock_attach_id_t source)
+{
+    uint32_t freq;
+
+    switch (source)
+    {
+        case kPLL0_to_FLEXIO:
+            freq = CLOCK_GetFreq(kCLOCK_Pll0Out);
+            break;
+        case kCLK_IN_to_FLEXIO:
+            freq = CLOCK_GetFreq(kCLOCK_ExtClk);
+            break;
+        case kFRO_HF_to_FLEXIO:
+            freq = CLOCK_GetFreq(kCLOCK_FroHf);
+            break;
+        case kFRO12M_to_FLEXIO:
+            freq = CLOCK_GetFreq(kCLOCK_Fro12M);
+            break;
+        case kPLL1_CLK0_to_FLEXIO:
+            freq = CLOCK_GetFreq(kCLOCK_Pll1Out) / ((SYSCON->PLL1CLK0DIV & SYSCON_PLL1CLK0DIV_DIV_MASK) + 1U);
+            break;
+        default:
+            freq = 0U;
+            break;
+    }
+
+    return freq;
+}
+
+/*!
+ * brief Registers a FlexIO clock listener.
+ *
+ * param listener Listener node, must stay valid while registered.
+ * param notify   Listener function.
+ * param userData Listener parameter.
+ */
+void APP_CLOCK_AddListener(app_clock_listener_t *listener, app_clock_notify_t notify, void *userData)
+{
+    assert(listener != NULL);
+    assert(notify != NULL);
+
+    listener->notify   = notify;
+    listener->userData = userData;
+    listener->next     = s_clockListeners;
+    s_clockListeners   = listener;
+}
+
+/*!
+ * brief Unregisters a FlexIO clock listener.
+ *
+ * param listener Listener node.
+ */
+void APP_CLOCK_RemoveListener(app_clock_listener_t *listener)
+{
+    app_clock_listener_t **link = &s_clockListeners;
+
+    while (*link != NULL)
+    {
+        if (*link == listener)
+        {
+            *link = listener->next;
+            break;
+        }
+        link = &(*link)->next;
+    }
+}
+
+/*!
+ * brief Switches the FlexIO clock, notifying every listener.
+ *
+ * param source  FlexIO clock source, one of the k*_to_FLEXIO values.
+ * param divider FlexIO clock divider, [1, 256].
+ * retval kStatus_Success The clock is switched.
+ * retval kStatus_InvalidArgument The source does not run or the divider is out of range.
+ * return The status of the listener which refused the change.
+ */
+status_t APP_CLOCK_SetFlexioClock(clock_attach_id_t source, uint32_t divider)
+{
+    app_clock_listener_t *listener;
+    app_clock_listener_t *prepared;
+    uint32_t newFreq_Hz;
+    uint32_t primask;
+    status_t status = kStatus_Success;
+
+    if ((divider == 0U) || (divider > (SYSCON_FLEXIOCLKDIV_DIV_MASK + 1U)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    newFreq_Hz = APP_CLOCK_GetFlexioSourceFreq(source) / divider;
+    if (newFreq_Hz == 0U)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    for (listener = s_clockListeners; listener != NULL; listener = listener->next)
+    {
+        status = listener->notify(kAPP_ClockPrepare, newFreq_Hz, listener->userData);
+        if (status != kStatus_Success)
+        {
+            break;
+        }
+    }
+
+    if (status != kStatus_Success)
+    {
+        for (prepared = s_clockListeners; prepared != listener; prepared = prepared->next)
+        {
+            (void)prepared->notify(kAPP_ClockCancel, newFreq_Hz, prepared->userData);
+        }
+        return status;
+    }
+
+    primask = DisableGlobalIRQ();
+
+    for (listener = s_clockListeners; listener != NULL; listener = listener->next)
+    {
+        (void)listener->notify(kAPP_ClockAlign, newFreq_Hz, listener->userData);
+    }
+
+    CLOCK_SetClkDiv(kCLOCK_DivFlexioClk, divider);
+    CLOCK_AttachClk(source);
+
+    for (listener = s_clockListeners; listener != NULL; listener = listener->next)
+    {
+        (void)listener->notify(kAPP_ClockCommit, newFreq_Hz, listener->userData);
+    }
+
+    EnableGlobalIRQ(primask);
+
+    return kStatus_Success;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_CLOCK_H_
+#define APP_CLOCK_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup app_clock
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * FlexIO clock transitions. Users of the FlexIO clock register a listener and are notified in
+ * three steps around the switch:
+ * - kAPP_ClockPrepare, interrupts enabled: compute the new settings, a listener can refuse the
+ *   change by returning an error, the listeners already prepared then get kAPP_ClockCancel;
+ * - kAPP_ClockAlign, interrupts masked: wait for a safe point, e.g. a PWM period edge;
+ * - kAPP_ClockCommit, interrupts masked, right after the clock mux and divider are written:
+ *   write the new settings.
+ * The align, switch and commit steps run back to back, so they have to be short.
+ */
+
+/*! @brief Clock transition steps. */
+typedef enum _app_clock_event
+{
+    kAPP_ClockPrepare = 0U, /*!< New frequency known, nothing changed yet. */
+    kAPP_ClockAlign,        /*!< Interrupts masked, the switch follows. */
+    kAPP_ClockCommit,       /*!< Interrupts masked, the new clock runs. */
+    kAPP_ClockCancel,       /*!< Another listener refused the change. */
+} app_clock_event_t;
+
+/*!
+ * @brief Clock transition listener.
+ *
+ * @param event      Transition step.
+ * @param newFreq_Hz FlexIO clock frequency after the change.
+ * @param userData   Parameter passed to APP_CLOCK_AddListener().
+ * @return kStatus_Success, any other value refuses the change at kAPP_ClockPrepare.
+ */
+typedef status_t (*app_clock_notify_t)(app_clock_event_t event, uint32_t newFreq_Hz, void *userData);
+
+/*! @brief Listener node, owned by the caller. */
+typedef struct _app_clock_listener
+{
+    app_clock_notify_t notify;         /*!< Listener function. */
+    void *userData;                    /*!< Listener parameter. */
+    struct _app_clock_listener *next;  /*!< Next listener. */
+} app_clock_listener_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Registers a FlexIO clock listener.
+ *
+ * @param listener Listener node, must stay valid while registered.
+ * @param notify   Listener function.
+ * @param userData Listener parameter.
+ */
+void APP_CLOCK_AddListener(app_clock_listener_t *listener, app_clock_notify_t notify, void *userData);
+
+/*!
+ * @brief Unregisters a FlexIO clock listener.
+ *
+ * @param listener Listener node.
+ */
+void APP_CLOCK_RemoveListener(app_clock_listener_t *listener);
+
+/*!
+ * @brief Switches the FlexIO clock, notifying every listener.
+ *
+ * The source must be running, e.g. FRO_HF or PLL0 as set up by the board clock functions.
+ *
+ * @param source  FlexIO clock source, one of the k*_to_FLEXIO values.
+ * @param divider FlexIO clock divider, [1, 256].
+ * @retval kStatus_Success The clock is switched.
+ * @retval kStatus_InvalidArgument The source does not run or the divider is out of range.
+ * @return The status of the listener which refused the change.
+ */
+status_t APP_CLOCK_SetFlexioClock(clock_attach_id_t source, uint32_t divider);
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_CLOCK_H_ */
@@ -0,0 +1,506 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "app_command.h"
+#include "app_edma.h"
+#include "fsl_lpflexcomm.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* CITER is 15 bits wide (bit 15 is ELINK), so the largest power of two it holds is 16384. */
+#if ((APP_COMMAND_RX_BUFFER_SIZE & (APP_COMMAND_RX_BUFFER_SIZE - 1U)) != 0U) || \
+    (APP_COMMAND_RX_BUFFER_SIZE > 16384U)
+#error "APP_COMMAND_RX_BUFFER_SIZE must be a power of two, not over 16384."
+#endif
+
+/* Receive buffer index mask. */
+#define APP_COMMAND_RX_MASK (APP_COMMAND_RX_BUFFER_SIZE - 1U)
+
+/* Command interface state. The eDMA writes buffer, the idle-line interrupt counts the pauses. */
+typedef struct _app_command_state
+{
+    flexio_cpwm_handle_t *cpwm;
+    LPUART_Type *uart;
+    uint8_t dmaChannel;
+    volatile uint32_t idleCount;
+    uint32_t tail;
+    bool binaryWaiting;
+    uint32_t binaryIdleCount;
+    bool armed;
+    uint32_t savedTicks[FLEXIO_CPWM_MAX_CHANNELS];
+    app_command_callback_t callback;
+    void *userData;
+    uint8_t buffer[APP_COMMAND_RX_BUFFER_SIZE];
+} app_command_state_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void APP_COMMAND_HandleIRQ(uint32_t instance, void *handle);
+static uint32_t APP_COMMAND_Head(void);
+static uint8_t APP_COMMAND_At(uint32_t offset);
+static status_t APP_COMMAND_ParseBinary(app_command_t *command);
+static status_t APP_COMMAND_ParseLine(uint32_t length, app_command_t *command);
+static status_t APP_COMMAND_Stage(bool armed);
+static status_t APP_COMMAND_SetFrequency(uint32_t freq_Hz);
+static status_t APP_COMMAND_Apply(const app_command_t *command);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static app_command_state_t s_command;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Idle line: the sender paused, wake the main loop up. */
+static void APP_COMMAND_HandleIRQ(uint32_t instance, void *handle)
+{
+    app_command_state_t *state = (app_command_state_t *)handle;
+    uint32_t flags             = LPUART_GetStatusFlags(state->uart);
+
+    if (0U != (flags & (uint32_t)kLPUART_IdleLineFlag))
+    {
+        (void)LPUART_ClearStatusFlags(state->uart, (uint32_t)kLPUART_IdleLineFlag);
+        state->idleCount++;
+    }
+    if (0U != (flags & (uint32_t)kLPUART_RxOverrunFlag))
+    {
+        (void)LPUART_ClearStatusFlags(state->uart, (uint32_t)kLPUART_RxOverrunFlag);
+    }
+}
+
+/* Buffer index the eDMA writes next. */
+static uint32_t APP_COMMAND_Head(void)
+{
+    return (APP_COMMAND_RX_BUFFER_SIZE - APP_EDMA_GetRemainingMajorLoopCount(s_command.dmaChannel)) &
+           APP_COMMAND_RX_MASK;
+}
+
+/* Received byte at an offset from the parse position, across the buffer wrap. */
+static uint8_t APP_COMMAND_At(uint32_t offset)
+{
+    return s_command.buffer[(s_command.tail + offset) & APP_COMMAND_RX_MASK];
+}
+
+/* SYNC, opcode, channel, check, value: the XOR of the 8 bytes is zero. */
+static status_t APP_COMMAND_ParseBinary(app_command_t *command)
+{
+    uint8_t check = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < APP_COMMAND_BINARY_SIZE; i++)
+    {
+        check ^= APP_COMMAND_At(i);
+    }
+    if (check != 0U)
+    {
+        return kStatus_APP_CommandSyntax;
+    }
+
+    command->opcode  = APP_COMMAND_At(1U);
+    command->channel = APP_COMMAND_At(2U);
+    command->value   = (uint32_t)APP_COMMAND_At(4U) | ((uint32_t)APP_COMMAND_At(5U) << 8U) |
+                     ((uint32_t)APP_COMMAND_At(6U) << 16U) | ((uint32_t)APP_COMMAND_At(7U) << 24U);
+
+    return kStatus_Success;
+}
+
+/* "<letter> [<decimal> [<decimal>]]", the line starts at the parse position. */
+static status_t APP_COMMAND_ParseLine(uint32_t length, app_command_t *command)
+{
+    uint32_t args[2] = {0U, 0U};
+    uint32_t argCount = 0U;
+    uint32_t expected;
+    uint32_t pos = 1U;
+    uint32_t digit;
+    uint8_t c;
+
+    command->opcode = APP_COMMAND_At(0U);
+    switch (command->opcode)
+    {
+        case (uint8_t)kAPP_CommandDuty:
+        case (uint8_t)kAPP_CommandDutyTicks:
+        case (uint8_t)kAPP_CommandPhase:
+            expected = 2U;
+            break;
+        case (uint8_t)kAPP_CommandFrequency:
+            expected = 1U;
+            break;
+        case (uint8_t)kAPP_CommandArm:
+        case (uint8_t)kAPP_CommandDisarm:
+            expected = 0U;
+            break;
+        default:
+            return kStatus_APP_CommandSyntax;
+    }
+
+    while (pos < length)
+    {
+        if (APP_COMMAND_At(pos) == (uint8_t)' ')
+        {
+            pos++;
+            continue;
+        }
+        if (argCount == expected)
+        {
+            return kStatus_APP_CommandSyntax;
+        }
+
+        c = APP_COMMAND_At(pos);
+        if ((c < (uint8_t)'0') || (c > (uint8_t)'9'))
+        {
+            return kStatus_APP_CommandSyntax;
+        }
+        while ((pos < length) && (c >= (uint8_t)'0') && (c <= (uint8_t)'9'))
+        {
+            digit = (uint32_t)c - (uint32_t)'0';
+            if (args[argCount] > ((UINT32_MAX - digit) / 10U))
+            {
+                return kStatus_APP_CommandSyntax;
+            }
+            args[argCount] = (args[argCount] * 10U) + digit;
+            pos++;
+            c = (pos < length) ? APP_COMMAND_At(pos) : (uint8_t)' ';
+        }
+        if (c != (uint8_t)' ')
+        {
+            return kStatus_APP_CommandSyntax;
+        }
+        argCount++;
+    }
+    if (argCount != expected)
+    {
+        return kStatus_APP_CommandSyntax;
+    }
+
+    /* Single argument commands carry it in value. */
+    command->channel = (expected == 2U) ? (uint8_t)MIN(args[0], 0xFFU) : 0U;
+    command->value   = (expected == 2U) ? args[1] : args[0];
+
+    return kStatus_Success;
+}
+
+/* Stages the saved duties, or zero for all channels, through the engine update path. */
+static status_t APP_COMMAND_Stage(bool armed)
+{
+    flexio_cpwm_handle_t *cpwm = s_command.cpwm;
+    status_t status            = kStatus_Success;
+    status_t channelStatus;
+    uint8_t i;
+
+    for (i = 0U; i < cpwm->channelCount; i++)
+    {
+        channelStatus = FLEXIO_CPWM_SetDutyTicks(cpwm, i, armed ? s_command.savedTicks[i] : 0U);
+        if (kStatus_Success != channelStatus)
+        {
+            status = channelStatus;
+        }
+    }
+    FLEXIO_CPWM_Update(cpwm);
+    s_command.armed = armed;
+
+    return status;
+}
+
+/* Retimes the running engine, the duty ratios are kept. The duties saved while disarmed follow. */
+static status_t APP_COMMAND_SetFrequency(uint32_t freq_Hz)
+{
+    flexio_cpwm_handle_t *cpwm = s_command.cpwm;
+    uint32_t oldPeriodTicks    = cpwm->periodTicks;
+    status_t status;
+    uint8_t i;
+
+    status = FLEXIO_CPWM_SetFrequency(cpwm, freq_Hz);
+    if (kStatus_Success == status)
+    {
+        for (i = 0U; i < cpwm->channelCount; i++)
+        {
+            s_command.savedTicks[i] = (uint32_t)((((uint64_t)s_command.savedTicks[i] * cpwm->periodTicks) +
+                                                  (oldPeriodTicks / 2U)) /
+                                                 oldPeriodTicks);
+        }
+    }
+
+    return status;
+}
+
+static status_t APP_COMMAND_Apply(const app_command_t *command)
+{
+    flexio_cpwm_handle_t *cpwm = s_command.cpwm;
+    status_t status            = kStatus_Success;
+    uint32_t ticks;
+
+    switch (command->opcode)
+    {
+        case (uint8_t)kAPP_CommandDuty:
+        case (uint8_t)kAPP_CommandDutyTicks:
+            if (command->channel >= cpwm->channelCount)
+            {
+                return kStatus_InvalidArgument;
+            }
+            if (command->opcode == (uint8_t)kAPP_CommandDuty)
+            {
+                if (command->value > 100U)
+                {
+                    return kStatus_InvalidArgument;
+                }
+                ticks = (cpwm->periodTicks * command->value) / 100U;
+            }
+            else
+            {
+                if (command->value > cpwm->periodTicks)
+                {
+                    return kStatus_InvalidArgument;
+                }
+                ticks = command->value;
+            }
+            /* Disarmed, the duty waits for the arm command. */
+            if (s_command.armed)
+            {
+                status = FLEXIO_CPWM_SetDutyTicks(cpwm, command->channel, ticks);
+                FLEXIO_CPWM_Update(cpwm);
+            }
+            if (kStatus_Success == status)
+            {
+                s_command.savedTicks[command->channel] = ticks;
+            }
+            break;
+        case (uint8_t)kAPP_CommandFrequency:
+            status = APP_COMMAND_SetFrequency(command->value);
+            break;
+        case (uint8_t)kAPP_CommandPhase:
+            if (command->channel >= cpwm->channelCount)
+            {
+                return kStatus_InvalidArgument;
+            }
+            /* All channels are centered on the period timer. */
+            status = ((command->value % 360U) == 0U) ? kStatus_Success : kStatus_APP_CommandUnsupported;
+            break;
+        case (uint8_t)kAPP_CommandArm:
+            status = APP_COMMAND_Stage(true);
+            break;
+        case (uint8_t)kAPP_CommandDisarm:
+            status = APP_COMMAND_Stage(false);
+            break;
+        default:
+            status = kStatus_APP_CommandSyntax;
+            break;
+    }
+
+    return status;
+}
+
+/*!
+ * brief Gets the default configuration: eDMA channel 12, no callback.
+ *
+ * param config Pointer to the configuration structure.
+ */
+void APP_COMMAND_GetDefaultConfig(app_command_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->dmaChannel = 12U;
+}
+
+/*!
+ * brief Starts receiving commands for an engine.
+ *
+ * param handle Running engine handle.
+ * param config Command interface configuration.
+ * retval kStatus_Success Reception started.
+ */
+status_t APP_COMMAND_Init(flexio_cpwm_handle_t *handle, const app_command_config_t *config)
+{
+    assert(handle != NULL);
+    assert(config != NULL);
+    assert(config->uart != NULL);
+
+    IRQn_Type uartIrqs[] = LPUART_RX_TX_IRQS;
+    LPUART_Type *base    = config->uart;
+    uint32_t instance    = LPUART_GetInstance(base);
+    uint8_t channel      = config->dmaChannel;
+    uint32_t ctrl;
+    uint8_t i;
+
+    APP_COMMAND_Deinit();
+
+    (void)memset(&s_command, 0, sizeof(s_command));
+    s_command.cpwm       = handle;
+    s_command.uart       = base;
+    s_command.dmaChannel = channel;
+    s_command.callback   = config->callback;
+    s_command.userData   = config->userData;
+    s_command.armed      = true;
+    for (i = 0U; i < handle->channelCount; i++)
+    {
+        s_command.savedTicks[i] = FLEXIO_CPWM_GetDutyTicks(handle, i);
+    }
+
+    /* Circular receive: the destination wraps at the end of every major loop, the request stays on. */
+    APP_EDMA_Init();
+    APP_EDMA_ResetChannel(channel, config->dmaRequest);
+    APP_EDMA_BASEADDR->CH[channel].TCD_SADDR = LPUART_GetDataRegisterAddress(base);
+    APP_EDMA_BASEADDR->CH[channel].TCD_SOFF  = 0U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_ATTR =
+        DMA_TCD_ATTR_SSIZE(APP_EDMA_SIZE_1BYTE) | DMA_TCD_ATTR_DSIZE(APP_EDMA_SIZE_1BYTE);
+    APP_EDMA_BASEADDR->CH[channel].TCD_NBYTES_MLOFFNO = 1U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_DADDR          = (uint32_t)&s_command.buffer[0];
+    APP_EDMA_BASEADDR->CH[channel].TCD_DOFF           = 1U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_CITER_ELINKNO  = APP_COMMAND_RX_BUFFER_SIZE;
+    APP_EDMA_BASEADDR->CH[channel].TCD_BITER_ELINKNO  = APP_COMMAND_RX_BUFFER_SIZE;
+    APP_EDMA_BASEADDR->CH[channel].TCD_DLAST_SGA      = (uint32_t)(-(int32_t)APP_COMMAND_RX_BUFFER_SIZE);
+
+    /* Idle after one character time, counted from the stop bit. The receiver must be off to change it. */
+    while (0U == (LPUART_GetStatusFlags(base) & (uint32_t)kLPUART_TransmissionCompleteFlag))
+    {
+    }
+    ctrl       = base->CTRL;
+    base->CTRL = ctrl & ~(LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK);
+    base->CTRL = (ctrl & ~LPUART_CTRL_IDLECFG_MASK) | LPUART_CTRL_ILT_MASK | LPUART_CTRL_RE_MASK;
+    base->FIFO |= LPUART_FIFO_RXFLUSH_MASK;
+    (void)LPUART_ClearStatusFlags(base, (uint32_t)kLPUART_IdleLineFlag | (uint32_t)kLPUART_RxOverrunFlag);
+
+    LP_FLEXCOMM_SetIRQHandler(instance, APP_COMMAND_HandleIRQ, &s_command, LP_FLEXCOMM_PERIPH_LPUART);
+    LPUART_EnableRxDMA(base, true);
+    LPUART_EnableInterrupts(base, (uint32_t)kLPUART_IdleLineInterruptEnable);
+    APP_EDMA_EnableRequest(channel);
+    (void)EnableIRQ(uartIrqs[instance]);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops the reception.
+ */
+void APP_COMMAND_Deinit(void)
+{
+    if (s_command.cpwm == NULL)
+    {
+        return;
+    }
+
+    LPUART_DisableInterrupts(s_command.uart, (uint32_t)kLPUART_IdleLineInterruptEnable);
+    LPUART_EnableRxDMA(s_command.uart, false);
+    APP_EDMA_StopChannel(s_command.dmaChannel);
+    LP_FLEXCOMM_SetIRQHandler(LPUART_GetInstance(s_command.uart), NULL, NULL, LP_FLEXCOMM_PERIPH_LPUART);
+    s_command.cpwm = NULL;
+}
+
+/*!
+ * brief Parses and applies the commands received so far, call it from the main loop.
+ *
+ * return Number of commands applied or rejected.
+ */
+uint32_t APP_COMMAND_Poll(void)
+{
+    app_command_t command;
+    uint32_t count = 0U;
+    uint32_t head;
+    uint32_t avail;
+    uint32_t length;
+    status_t status;
+    uint8_t first;
+    uint8_t c;
+
+    if (s_command.cpwm == NULL)
+    {
+        return 0U;
+    }
+
+    head = APP_COMMAND_Head();
+    while (s_command.tail != head)
+    {
+        avail = (head - s_command.tail) & APP_COMMAND_RX_MASK;
+        first = APP_COMMAND_At(0U);
+
+        if (first == APP_COMMAND_SYNC)
+        {
+            if (avail < APP_COMMAND_BINARY_SIZE)
+            {
+                if (!s_command.binaryWaiting)
+                {
+                    s_command.binaryWaiting   = true;
+                    s_command.binaryIdleCount = s_command.idleCount;
+                    break;
+                }
+                if (s_command.binaryIdleCount == s_command.idleCount)
+                {
+                    /* Still arriving. */
+                    break;
+                }
+                /* The line went idle in the middle, resynchronize on the next byte. */
+                s_command.binaryWaiting = false;
+                s_command.tail          = (s_command.tail + 1U) & APP_COMMAND_RX_MASK;
+                status                  = kStatus_APP_CommandSyntax;
+            }
+            else
+            {
+                s_command.binaryWaiting = false;
+                status                  = APP_COMMAND_ParseBinary(&command);
+                length                  = (kStatus_Success == status) ? APP_COMMAND_BINARY_SIZE : 1U;
+                s_command.tail          = (s_command.tail + length) & APP_COMMAND_RX_MASK;
+            }
+        }
+        else if ((first == (uint8_t)'\r') || (first == (uint8_t)'\n') || (first == (uint8_t)' '))
+        {
+            /* Empty line or the second byte of CR LF. */
+            s_command.tail = (s_command.tail + 1U) & APP_COMMAND_RX_MASK;
+            continue;
+        }
+        else
+        {
+            for (length = 1U; (length < avail) && (length <= APP_COMMAND_MAX_LINE); length++)
+            {
+                c = APP_COMMAND_At(length);
+                if ((c == (uint8_t)'\r') || (c == (uint8_t)'\n') || (c == APP_COMMAND_SYNC))
+                {
+                    break;
+                }
+            }
+            if (length > APP_COMMAND_MAX_LINE)
+            {
+                status = kStatus_APP_CommandSyntax;
+            }
+            else if (length == avail)
+            {
+                /* Line not terminated yet. */
+                break;
+            }
+            else if (APP_COMMAND_At(length) == APP_COMMAND_SYNC)
+            {
+                /* A binary command cut the line, drop the line. */
+                status = kStatus_APP_CommandSyntax;
+            }
+            else
+            {
+                status = APP_COMMAND_ParseLine(length, &command);
+                length++;
+            }
+            s_command.tail = (s_command.tail + length) & APP_COMMAND_RX_MASK;
+        }
+
+        if (kStatus_Success == status)
+        {
+            status = APP_COMMAND_Apply(&command);
+        }
+        if (s_command.callback != NULL)
+        {
+            s_command.callback((kStatus_APP_CommandSyntax == status) ? NULL : &command, status,
+                               s_command.userData);
+        }
+        count++;
+    }
+
+    return count;
+}
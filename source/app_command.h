@@ -0,0 +1,155 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_COMMAND_H_
+#define APP_COMMAND_H_
+
+#include "fsl_common.h"
+#include "fsl_lpuart.h"
+#include "flexio_cpwm.h"
+
+/*!
+ * @addtogroup app_command
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Live PWM control over the receive side of an LPUART. An eDMA channel writes every received byte
+ * into a circular buffer, the LPUART idle-line interrupt wakes the core up once the sender pauses,
+ * and APP_COMMAND_Poll() parses the new bytes where the eDMA put them, across the buffer wrap,
+ * without copying them.
+ *
+ * Two encodings can be mixed on the line:
+ * - ASCII, one command per line ending with CR or LF:
+ *   "d <ch> <percent>", "t <ch> <ticks>", "f <hz>", "p <ch> <degrees>", "a", "x";
+ * - binary, 8 bytes: APP_COMMAND_SYNC, opcode (the ASCII letter), channel, check byte, value
+ *   (u32, little endian). The XOR of the 8 bytes is zero. A binary command must arrive in one
+ *   burst, an idle line in its middle drops it.
+ *
+ * Duty commands are staged and committed at the next period boundary. A frequency change goes
+ * through FLEXIO_CPWM_SetFrequency() on the running clock, the duty ratios are kept. Disarming parks every
+ * channel low through the staged path and keeps the duties, which arming restores. The
+ * center-aligned engine has no phase control, only a zero phase is accepted.
+ *
+ * The receiver keeps running with the debug console transmitter on the same LPUART, console input
+ * is taken over. The LPUART interrupt is used, which the non-blocking console needs as well.
+ */
+
+/*! @brief Size of the receive buffer, a power of two. Longer bursts without idle gap overwrite it. */
+#ifndef APP_COMMAND_RX_BUFFER_SIZE
+#define APP_COMMAND_RX_BUFFER_SIZE (256U)
+#endif
+
+/*! @brief Longest ASCII command line without its terminator. */
+#ifndef APP_COMMAND_MAX_LINE
+#define APP_COMMAND_MAX_LINE (32U)
+#endif
+
+/*! @brief First byte of a binary command, never part of an ASCII line. */
+#define APP_COMMAND_SYNC (0xC3U)
+
+/*! @brief Size of a binary command. */
+#define APP_COMMAND_BINARY_SIZE (8U)
+
+/*! @brief Status group of the command interface. */
+#define kStatusGroup_APP_COMMAND (kStatusGroup_ApplicationRangeStart + 1)
+
+/*! @brief Error codes of the command interface. */
+enum
+{
+    kStatus_APP_CommandSyntax      = MAKE_STATUS(kStatusGroup_APP_COMMAND, 0), /*!< Malformed command. */
+    kStatus_APP_CommandUnsupported = MAKE_STATUS(kStatusGroup_APP_COMMAND, 1), /*!< Not produced by the engine. */
+};
+
+/*! @brief Command opcodes, the letters of the ASCII form. */
+typedef enum _app_command_opcode
+{
+    kAPP_CommandDuty      = 'd', /*!< value: duty in %, [0, 100]. */
+    kAPP_CommandDutyTicks = 't', /*!< value: on-time in FlexIO clocks, [0, period]. */
+    kAPP_CommandFrequency = 'f', /*!< value: PWM frequency in Hz, channel unused. */
+    kAPP_CommandPhase     = 'p', /*!< value: phase in degrees, only 0. */
+    kAPP_CommandArm       = 'a', /*!< Restores the duties, channel and value unused. */
+    kAPP_CommandDisarm    = 'x', /*!< Parks the outputs low, channel and value unused. */
+} app_command_opcode_t;
+
+/*! @brief Decoded command. */
+typedef struct _app_command
+{
+    uint8_t opcode;  /*!< One of app_command_opcode_t. */
+    uint8_t channel; /*!< Engine channel. */
+    uint32_t value;  /*!< Command parameter. */
+} app_command_t;
+
+/*!
+ * @brief Reports a command result, from APP_COMMAND_Poll().
+ *
+ * command is NULL for a line or frame which could not be decoded.
+ */
+typedef void (*app_command_callback_t)(const app_command_t *command, status_t status, void *userData);
+
+/*! @brief Command interface configuration. */
+typedef struct _app_command_config
+{
+    LPUART_Type *uart;               /*!< LPUART receiving the commands, already initialized. */
+    uint8_t dmaChannel;              /*!< eDMA channel draining the receiver. */
+    uint32_t dmaRequest;             /*!< LPUART receive request, one of the kDma0RequestMux* values. */
+    app_command_callback_t callback; /*!< Result callback, NULL if not needed. */
+    void *userData;                  /*!< Callback parameter. */
+} app_command_config_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Gets the default configuration: eDMA channel 12, no callback.
+ *
+ * uart and dmaRequest are left zero and must be filled by the caller.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void APP_COMMAND_GetDefaultConfig(app_command_config_t *config);
+
+/*!
+ * @brief Starts receiving commands for an engine.
+ *
+ * The engine starts armed with its current duties.
+ *
+ * @param handle Running engine handle.
+ * @param config Command interface configuration.
+ * @retval kStatus_Success Reception started.
+ */
+status_t APP_COMMAND_Init(flexio_cpwm_handle_t *handle, const app_command_config_t *config);
+
+/*!
+ * @brief Stops the reception.
+ */
+void APP_COMMAND_Deinit(void);
+
+/*!
+ * @brief Parses and applies the commands received so far, call it from the main loop.
+ *
+ * The eDMA does not run in deep sleep, idle in sleep mode while commands are expected.
+ *
+ * @return Number of commands applied or rejected.
+ */
+uint32_t APP_COMMAND_Poll(void);
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_COMMAND_H_ */
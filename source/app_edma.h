@@ -0,0 +1,152 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_EDMA_H_
+#define APP_EDMA_H_
+
+#include "fsl_common.h"
+#include "fsl_reset.h"
+
+/*!
+ * @addtogroup app_edma
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * The project does not ship the fsl_edma driver, the features built on top of FlexIO only need a
+ * handful of eDMA4 channel operations. These helpers program the DMA0 channel registers directly.
+ */
+
+/*! @brief eDMA instance used by the application. */
+#define APP_EDMA_BASEADDR DMA0
+
+/*! @brief eDMA transfer size encoding for TCD_ATTR SSIZE/DSIZE. */
+#define APP_EDMA_SIZE_1BYTE  0U
+#define APP_EDMA_SIZE_2BYTES 1U
+#define APP_EDMA_SIZE_4BYTES 2U
+
+/*!
+ * @brief Request source of shifter/timer 0 of every FlexIO instance, in FLEXIO_GetInstance() order.
+ *
+ * The sources of shifters/timers 1..7 follow it. Add the sources of the other instances on parts
+ * which have them.
+ */
+#define APP_EDMA_FLEXIO_REQUESTS {(uint32_t)kDma0RequestMuxFlexIO0ShiftRegister0Request}
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Enables the eDMA clock and releases it from reset.
+ *
+ * Calling it more than once is harmless.
+ */
+static inline void APP_EDMA_Init(void)
+{
+    CLOCK_EnableClock(kCLOCK_Dma0);
+    RESET_ReleasePeripheralReset(kDMA0_RST_SHIFT_RSTn);
+}
+
+/*!
+ * @brief Stops a channel: disables the hardware request and waits for an in-flight minor loop.
+ *
+ * @param channel eDMA channel number
+ */
+static inline void APP_EDMA_StopChannel(uint8_t channel)
+{
+    APP_EDMA_BASEADDR->CH[channel].CH_CSR &= ~(DMA_CH_CSR_ERQ_MASK | DMA_CH_CSR_DONE_MASK);
+    while (0U != (APP_EDMA_BASEADDR->CH[channel].CH_CSR & DMA_CH_CSR_ACTIVE_MASK))
+    {
+    }
+}
+
+/*!
+ * @brief Routes a request source to a channel, clears the channel status and its TCD.
+ *
+ * @param channel eDMA channel number
+ * @param source  Request source, one of the kDma0RequestMux* values
+ */
+static inline void APP_EDMA_ResetChannel(uint8_t channel, uint32_t source)
+{
+    APP_EDMA_StopChannel(channel);
+
+    APP_EDMA_BASEADDR->CH[channel].CH_MUX = 0U;
+    APP_EDMA_BASEADDR->CH[channel].CH_MUX = DMA_CH_MUX_SRC(source);
+    APP_EDMA_BASEADDR->CH[channel].CH_ES  = DMA_CH_ES_ERR_MASK;
+    APP_EDMA_BASEADDR->CH[channel].CH_INT = DMA_CH_INT_INT_MASK;
+    /* DONE is write 1 to clear. */
+    APP_EDMA_BASEADDR->CH[channel].CH_CSR = DMA_CH_CSR_DONE_MASK;
+
+    APP_EDMA_BASEADDR->CH[channel].TCD_CSR       = 0U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_SLAST_SDA = 0U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_DLAST_SGA = 0U;
+}
+
+/*!
+ * @brief Gets the request source of a FlexIO shifter or timer status flag.
+ *
+ * @param instance FlexIO instance, from FLEXIO_GetInstance()
+ * @param index    Shifter or timer index
+ * @return Request source for APP_EDMA_ResetChannel().
+ */
+static inline uint32_t APP_EDMA_GetFlexioRequest(uint32_t instance, uint32_t index)
+{
+    static const uint32_t s_flexioRequests[] = APP_EDMA_FLEXIO_REQUESTS;
+
+    assert(instance < ARRAY_SIZE(s_flexioRequests));
+
+    return s_flexioRequests[instance] + index;
+}
+
+/*!
+ * @brief Enables the hardware request of a channel.
+ *
+ * @param channel eDMA channel number
+ */
+static inline void APP_EDMA_EnableRequest(uint8_t channel)
+{
+    APP_EDMA_BASEADDR->CH[channel].CH_CSR = (APP_EDMA_BASEADDR->CH[channel].CH_CSR & ~DMA_CH_CSR_DONE_MASK) |
+                                            DMA_CH_CSR_ERQ_MASK;
+}
+
+/*!
+ * @brief Checks whether the major loop of a channel has completed.
+ *
+ * @param channel eDMA channel number
+ * @return true if the channel DONE flag is set.
+ */
+static inline bool APP_EDMA_IsDone(uint8_t channel)
+{
+    return (0U != (APP_EDMA_BASEADDR->CH[channel].CH_CSR & DMA_CH_CSR_DONE_MASK));
+}
+
+/*!
+ * @brief Gets the remaining major loop count of a channel.
+ *
+ * @param channel eDMA channel number
+ * @return Current major iteration count (CITER).
+ */
+static inline uint32_t APP_EDMA_GetRemainingMajorLoopCount(uint8_t channel)
+{
+    return (uint32_t)(APP_EDMA_BASEADDR->CH[channel].TCD_CITER_ELINKNO & DMA_TCD_CITER_ELINKNO_CITER_MASK);
+}
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_EDMA_H_ */
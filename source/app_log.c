@@ -0,0 +1,143 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "app_log.h"
+#include "app_placement.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#if ((APP_LOG_RING_WORDS & (APP_LOG_RING_WORDS - 1U)) != 0U)
+#error "APP_LOG_RING_WORDS must be a power of two."
+#endif
+
+/* Ring index mask. */
+#define APP_LOG_RING_MASK (APP_LOG_RING_WORDS - 1U)
+
+/* Record ring. head is written with interrupts masked by the producers, tail by APP_LOG_Drain() only. */
+typedef struct _app_log_ring
+{
+    uint32_t word[APP_LOG_RING_WORDS];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint32_t sequence;
+    uint32_t drop;
+} app_log_ring_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Written from the FlexIO interrupt, kept in SRAMH with the engine handle. */
+APP_HOT_BSS static app_log_ring_t s_logRing;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * brief Starts the DWT cycle counter and empties the ring.
+ */
+void APP_LOG_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    s_logRing.head     = 0U;
+    s_logRing.tail     = 0U;
+    s_logRing.sequence = 0U;
+    s_logRing.drop     = 0U;
+}
+
+/*!
+ * brief Appends a record, use APP_LOG() instead.
+ *
+ * param id       Format string ID.
+ * param argCount Number of arguments, not more than APP_LOG_MAX_ARGS.
+ * param args     Arguments.
+ */
+APP_HOT_CODE void APP_LOG_Write(uint32_t id, uint32_t argCount, const uint32_t *args)
+{
+    uint32_t timestamp = DWT->CYCCNT;
+    uint32_t words     = APP_LOG_HEADER_WORDS + argCount;
+    uint32_t regPrimask;
+    uint32_t head;
+    uint32_t i;
+
+    assert(argCount <= APP_LOG_MAX_ARGS);
+
+    regPrimask = DisableGlobalIRQ();
+
+    head = s_logRing.head;
+    if ((APP_LOG_RING_WORDS - (head - s_logRing.tail)) < words)
+    {
+        s_logRing.drop++;
+    }
+    else
+    {
+        s_logRing.word[head & APP_LOG_RING_MASK] = APP_LOG_SYNC | (argCount << 8U) | (s_logRing.sequence << 16U);
+        s_logRing.word[(head + 1U) & APP_LOG_RING_MASK] = id;
+        s_logRing.word[(head + 2U) & APP_LOG_RING_MASK] = timestamp;
+        for (i = 0U; i < argCount; i++)
+        {
+            s_logRing.word[(head + APP_LOG_HEADER_WORDS + i) & APP_LOG_RING_MASK] = args[i];
+        }
+        s_logRing.head = head + words;
+    }
+    s_logRing.sequence++;
+
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Sends the recorded records, from thread level.
+ *
+ * param write Writes a block of the stream, the ring space is released after the call.
+ * return Number of words sent.
+ */
+uint32_t APP_LOG_Drain(app_log_write_t write)
+{
+    uint32_t tail  = s_logRing.tail;
+    uint32_t count = s_logRing.head - tail;
+    uint32_t chunk;
+
+    assert(write != NULL);
+
+    /* The records up to head are complete, the producers update head once a record is written. */
+    __DMB();
+
+    chunk = APP_LOG_RING_WORDS - (tail & APP_LOG_RING_MASK);
+    if (chunk > count)
+    {
+        chunk = count;
+    }
+    if (chunk != 0U)
+    {
+        write((const uint8_t *)&s_logRing.word[tail & APP_LOG_RING_MASK], chunk * sizeof(uint32_t));
+    }
+    if (count > chunk)
+    {
+        /* Wrapped part. */
+        write((const uint8_t *)&s_logRing.word[0], (count - chunk) * sizeof(uint32_t));
+    }
+
+    __DMB();
+    s_logRing.tail = tail + count;
+
+    return count;
+}
+
+/*!
+ * brief Gets the number of records dropped on a full ring.
+ *
+ * return Dropped records since APP_LOG_Init().
+ */
+uint32_t APP_LOG_GetDropCount(void)
+{
+    return s_logRing.drop;
+}
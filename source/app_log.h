@@ -0,0 +1,153 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_LOG_H_
+#define APP_LOG_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup app_log
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Deferred binary logging. APP_LOG() does not format anything: it stores the address of its format
+ * string, a DWT cycle timestamp and the raw arguments into a ring of words, which costs a few dozen
+ * cycles and is safe in any interrupt. APP_LOG_Drain() later sends the records as they are, and
+ * tools/app_log_decode.py rebuilds the text from the ELF file.
+ *
+ * The format strings go to the ".app_log_fmt" section, which the linker scripts keep in the ELF as
+ * an INFO section: they take no flash, the record carries their offset in the section.
+ *
+ * Record, little endian words:
+ * - APP_LOG_SYNC | (argument count << 8) | (sequence << 16);
+ * - format string ID;
+ * - DWT->CYCCNT at the call;
+ * - the arguments, converted to uint32_t.
+ * The sequence counts every call, dropped ones included, so the decoder reports the gaps.
+ * Arguments are integers or characters; %s takes a pointer to a string in flash, which the decoder
+ * reads from the ELF file. Floating point is not supported.
+ */
+
+/*! @brief 1 records APP_LOG() calls, 0 compiles them out. */
+#ifndef APP_LOG_ENABLE
+#define APP_LOG_ENABLE 0
+#endif
+
+/*! @brief Ring size in words, a power of two. */
+#ifndef APP_LOG_RING_WORDS
+#define APP_LOG_RING_WORDS (1024U)
+#endif
+
+/*! @brief First byte of every record. */
+#define APP_LOG_SYNC (0xA5U)
+
+/*! @brief Words of the record header. */
+#define APP_LOG_HEADER_WORDS (3U)
+
+/*! @brief Arguments of one record. */
+#define APP_LOG_MAX_ARGS (6U)
+
+/*! @brief Section of the format strings. */
+#define APP_LOG_FMT_SECTION ".app_log_fmt"
+
+/*! @brief Writes a block of the record stream, e.g. to the debug UART. */
+typedef void (*app_log_write_t)(const uint8_t *data, size_t size);
+
+/*! @brief Number of arguments of APP_LOG(), 0 to APP_LOG_MAX_ARGS. */
+#define APP_LOG_NARGS(...)                                     APP_LOG_NARGS_(0, ##__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+#define APP_LOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, count, ...) count
+
+/*!
+ * @brief Arguments of APP_LOG() as record words, each one after a comma.
+ *
+ * Every argument goes through uintptr_t, so %s pointers convert as well as integers.
+ */
+#define APP_LOG_ARGS(...)                   APP_LOG_CAT(APP_LOG_ARGS_, APP_LOG_NARGS(__VA_ARGS__))(__VA_ARGS__)
+#define APP_LOG_CAT(a, b)                   APP_LOG_CAT_(a, b)
+#define APP_LOG_CAT_(a, b)                  a##b
+#define APP_LOG_ARG(a)                      , (uint32_t)(uintptr_t)(a)
+#define APP_LOG_ARGS_0()
+#define APP_LOG_ARGS_1(a)                   APP_LOG_ARG(a)
+#define APP_LOG_ARGS_2(a, b)                APP_LOG_ARG(a) APP_LOG_ARGS_1(b)
+#define APP_LOG_ARGS_3(a, b, c)             APP_LOG_ARG(a) APP_LOG_ARGS_2(b, c)
+#define APP_LOG_ARGS_4(a, b, c, d)          APP_LOG_ARG(a) APP_LOG_ARGS_3(b, c, d)
+#define APP_LOG_ARGS_5(a, b, c, d, e)       APP_LOG_ARG(a) APP_LOG_ARGS_4(b, c, d, e)
+#define APP_LOG_ARGS_6(a, b, c, d, e, f)    APP_LOG_ARG(a) APP_LOG_ARGS_5(b, c, d, e, f)
+
+#if (defined(APP_LOG_ENABLE) && APP_LOG_ENABLE)
+/*!
+ * @brief Records a message, formatted later on the host.
+ *
+ * @param fmt String literal, printf syntax.
+ * @param ... Up to APP_LOG_MAX_ARGS integer or pointer arguments.
+ */
+#define APP_LOG(fmt, ...)                                                                          \
+    do                                                                                             \
+    {                                                                                              \
+        static const char appLogFmt[] __attribute__((section(APP_LOG_FMT_SECTION), used)) = fmt;   \
+        const uint32_t appLogArgs[] = {0U APP_LOG_ARGS(__VA_ARGS__)};                              \
+        APP_LOG_Write((uint32_t)(uintptr_t)appLogFmt, APP_LOG_NARGS(__VA_ARGS__), &appLogArgs[1]); \
+    } while (false)
+#else
+#define APP_LOG(fmt, ...) \
+    do                    \
+    {                     \
+    } while (false)
+#endif /* APP_LOG_ENABLE */
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Starts the DWT cycle counter and empties the ring.
+ */
+void APP_LOG_Init(void);
+
+/*!
+ * @brief Appends a record, use APP_LOG() instead.
+ *
+ * Interrupts are masked while the record is written, so any context can log. A record which does
+ * not fit is dropped and counted.
+ *
+ * @param id       Format string ID.
+ * @param argCount Number of arguments, not more than APP_LOG_MAX_ARGS.
+ * @param args     Arguments.
+ */
+void APP_LOG_Write(uint32_t id, uint32_t argCount, const uint32_t *args);
+
+/*!
+ * @brief Sends the recorded records, from thread level.
+ *
+ * @param write Writes a block of the stream, the ring space is released after the call.
+ * @return Number of words sent.
+ */
+uint32_t APP_LOG_Drain(app_log_write_t write);
+
+/*!
+ * @brief Gets the number of records dropped on a full ring.
+ *
+ * @return Dropped records since APP_LOG_Init().
+ */
+uint32_t APP_LOG_GetDropCount(void);
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_LOG_H_ */
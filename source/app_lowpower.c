@@ -0,0 +1,308 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "app_lowpower.h"
+#include "fsl_clock.h"
+#include "fsl_reset.h"
+#include "fsl_spc.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* CMC clocking modes, see CMC_CKCTRL_CKMODE. */
+#define APP_LOWPOWER_CKMODE_NONE      (0x0U)
+#define APP_LOWPOWER_CKMODE_CORE      (0x1U)
+#define APP_LOWPOWER_CKMODE_ALL       (0xFU)
+/* CMC power mode, see CMC_PMCTRL_LPMODE. */
+#define APP_LOWPOWER_LPMODE_ACTIVE    (0x0U)
+#define APP_LOWPOWER_LPMODE_DEEPSLEEP (0x1U)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void APP_LOWPOWER_KeepClockInLowPower(void);
+static status_t APP_LOWPOWER_ConfigRegulators(void);
+static uint32_t APP_LOWPOWER_GrayToBinary(uint32_t gray);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static app_lowpower_mode_t s_lowPowerMode;
+static app_lowpower_hook_t s_lowPowerHook;
+static void *s_lowPowerHookData;
+static app_lowpower_stats_t s_lowPowerStats;
+/* Time and cycle counter at the last wakeup. */
+static uint64_t s_lowPowerWakeTime;
+static uint32_t s_lowPowerWakeCycles;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t APP_LOWPOWER_GrayToBinary(uint32_t gray)
+{
+    gray ^= gray >> 16U;
+    gray ^= gray >> 8U;
+    gray ^= gray >> 4U;
+    gray ^= gray >> 2U;
+    gray ^= gray >> 1U;
+
+    return gray;
+}
+
+/*
+ * FIRC feeds FRO_HF, the FlexIO functional clock, SIRC feeds clk_1m, the OSTIMER clock.
+ * Both are stopped in deep sleep unless their stop enable bit is set.
+ */
+static void APP_LOWPOWER_KeepClockInLowPower(void)
+{
+    uint32_t firccsr = SCG0->FIRCCSR;
+    uint32_t sirccsr = SCG0->SIRCCSR;
+
+    SCG0->FIRCCSR = (firccsr & ~SCG_FIRCCSR_LK_MASK);
+    SCG0->FIRCCSR = (firccsr & ~SCG_FIRCCSR_LK_MASK) | SCG_FIRCCSR_FIRCSTEN_MASK |
+                    SCG_FIRCCSR_FIRC_FCLK_PERIPH_EN_MASK;
+    SCG0->FIRCCSR |= (firccsr & SCG_FIRCCSR_LK_MASK);
+
+    SCG0->SIRCCSR = (sirccsr & ~SCG_SIRCCSR_LK_MASK);
+    SCG0->SIRCCSR = (sirccsr & ~SCG_SIRCCSR_LK_MASK) | SCG_SIRCCSR_SIRCSTEN_MASK;
+    SCG0->SIRCCSR |= (sirccsr & SCG_SIRCCSR_LK_MASK);
+}
+
+/*
+ * The core domain hosts the FlexIO logic. In deep sleep the core supply is kept at mid voltage
+ * with normal drive strength, enough for the 48 MHz FRO_HF clocking the state machine, instead
+ * of the retention settings used when nothing but SRAM has to survive.
+ */
+static status_t APP_LOWPOWER_ConfigRegulators(void)
+{
+    spc_lowpower_mode_regulators_config_t config;
+
+    (void)memset(&config, 0, sizeof(config));
+
+    config.lpIREF      = false;
+    config.bandgapMode = kSPC_BandgapEnabledBufferEnabled;
+#if (defined(FSL_FEATURE_MCX_SPC_HAS_LPBUFF_EN_BIT) && FSL_FEATURE_MCX_SPC_HAS_LPBUFF_EN_BIT)
+    config.lpBuff = false;
+#endif /* FSL_FEATURE_MCX_SPC_HAS_LPBUFF_EN_BIT */
+#if (defined(FSL_FEATURE_MCX_SPC_HAS_COREVDD_IVS_EN_BIT) && FSL_FEATURE_MCX_SPC_HAS_COREVDD_IVS_EN_BIT)
+    config.CoreIVS = false;
+#endif /* FSL_FEATURE_MCX_SPC_HAS_COREVDD_IVS_EN_BIT */
+#if (defined(FSL_FEATURE_MCX_SPC_HAS_DCDC) && FSL_FEATURE_MCX_SPC_HAS_DCDC)
+    config.DCDCOption.DCDCVoltage       = kSPC_DCDC_MidVoltage;
+    config.DCDCOption.DCDCDriveStrength = kSPC_DCDC_NormalDriveStrength;
+#endif /* FSL_FEATURE_MCX_SPC_HAS_DCDC */
+#if (defined(FSL_FEATURE_MCX_SPC_HAS_SYS_LDO) && FSL_FEATURE_MCX_SPC_HAS_SYS_LDO)
+    config.SysLDOOption.SysLDODriveStrength = kSPC_SysLDO_NormalDriveStrength;
+#endif /* FSL_FEATURE_MCX_SPC_HAS_SYS_LDO */
+    config.CoreLDOOption.CoreLDOVoltage       = kSPC_CoreLDO_MidDriveVoltage;
+    config.CoreLDOOption.CoreLDODriveStrength = kSPC_CoreLDO_NormalDriveStrength;
+
+    return SPC_SetLowPowerModeRegulatorsConfig(SPC0, &config);
+}
+
+/*!
+ * brief Prepares the FlexIO instance, the clocks and the SPC for the selected idle mode.
+ *
+ * param base FlexIO instance which has to keep running while the core is idle.
+ * param mode Idle mode.
+ * retval kStatus_Success The mode is configured.
+ * retval kStatus_Fail The SPC rejected the low power regulator settings.
+ */
+status_t APP_LOWPOWER_Init(FLEXIO_Type *base, app_lowpower_mode_t mode)
+{
+    assert(base != NULL);
+
+    /* Time base: OSTIMER on clk_1m, one count per microsecond. */
+    CLOCK_SetupClockCtrl(kCLOCK_FRO1MHZ_CLK_ENA);
+    CLOCK_AttachClk(kCLK_1M_to_OSTIMER);
+    CLOCK_EnableClock(kCLOCK_OsTimer);
+    RESET_PeripheralReset(kOSTIMER_RST_SHIFT_RSTn);
+
+    /* Active cycles: DWT cycle counter. */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    /* FlexIO enabled in doze modes: DOZEN cleared. */
+    base->CTRL &= ~FLEXIO_CTRL_DOZEN_MASK;
+
+    s_lowPowerMode = mode;
+
+    if (mode == kAPP_LowPowerDeepSleep)
+    {
+        APP_LOWPOWER_KeepClockInLowPower();
+        if (kStatus_Success != APP_LOWPOWER_ConfigRegulators())
+        {
+            s_lowPowerMode = kAPP_LowPowerSleep;
+            return kStatus_Fail;
+        }
+        /* Allow deep sleep, PMPROT is write once. */
+        if (0U == (CMC0->PMPROT & CMC_PMPROT_LOCK_MASK))
+        {
+            CMC0->PMPROT = CMC_PMPROT_LPMODE(APP_LOWPOWER_LPMODE_DEEPSLEEP);
+        }
+    }
+
+    APP_LOWPOWER_ResetStats();
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Installs the cycle-accounting hook.
+ *
+ * param hook     Hook function, NULL to remove.
+ * param userData Hook parameter.
+ */
+void APP_LOWPOWER_SetHook(app_lowpower_hook_t hook, void *userData)
+{
+    uint32_t primask = DisableGlobalIRQ();
+
+    s_lowPowerHook     = hook;
+    s_lowPowerHookData = userData;
+
+    EnableGlobalIRQ(primask);
+}
+
+/*!
+ * brief Gets the OSTIMER time base.
+ *
+ * return Time since APP_LOWPOWER_Init() in microseconds.
+ */
+uint64_t APP_LOWPOWER_GetTime(void)
+{
+    uint32_t high;
+    uint32_t low;
+
+    /* The counter is gray coded, reread until both halves belong together. */
+    do
+    {
+        high = OSTIMER0->EVTIMERH;
+        low  = OSTIMER0->EVTIMERL;
+    } while (high != OSTIMER0->EVTIMERH);
+
+    /* A binary bit is the parity of the gray bits at and above it. */
+    high = APP_LOWPOWER_GrayToBinary(high);
+    low  = APP_LOWPOWER_GrayToBinary(low) ^ ((0U != (high & 1U)) ? 0xFFFFFFFFU : 0U);
+
+    return ((uint64_t)high << 32U) | low;
+}
+
+/*!
+ * brief Waits for the next interrupt in the configured idle mode.
+ *
+ * param allowDeepSleep false limits the idle mode to sleep, e.g. while an eDMA ramp streams.
+ */
+void APP_LOWPOWER_Idle(bool allowDeepSleep)
+{
+    app_lowpower_mode_t mode = s_lowPowerMode;
+    uint32_t primask;
+    uint64_t now;
+
+    if (mode == kAPP_LowPowerRun)
+    {
+        return;
+    }
+    if (!allowDeepSleep)
+    {
+        mode = kAPP_LowPowerSleep;
+    }
+
+    /* Masked: a pending interrupt still ends WFI, it is serviced once the accounting is done. */
+    primask = DisableGlobalIRQ();
+
+    now = APP_LOWPOWER_GetTime();
+    s_lowPowerStats.activeTime_us += now - s_lowPowerWakeTime;
+    s_lowPowerStats.activeCycles += DWT->CYCCNT - s_lowPowerWakeCycles;
+    if (s_lowPowerHook != NULL)
+    {
+        s_lowPowerHook(kAPP_LowPowerEnterIdle, now, s_lowPowerHookData);
+    }
+
+    if (mode == kAPP_LowPowerDeepSleep)
+    {
+        CMC0->PMCTRL[0] = CMC_PMCTRL_LPMODE(APP_LOWPOWER_LPMODE_DEEPSLEEP);
+        CMC0->CKCTRL    = CMC_CKCTRL_CKMODE(APP_LOWPOWER_CKMODE_ALL);
+    }
+    else
+    {
+        CMC0->PMCTRL[0] = CMC_PMCTRL_LPMODE(APP_LOWPOWER_LPMODE_ACTIVE);
+        CMC0->CKCTRL    = CMC_CKCTRL_CKMODE(APP_LOWPOWER_CKMODE_CORE);
+    }
+    SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+
+    __DSB();
+    __WFI();
+    __ISB();
+
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+    CMC0->CKCTRL = CMC_CKCTRL_CKMODE(APP_LOWPOWER_CKMODE_NONE);
+
+    s_lowPowerWakeTime   = APP_LOWPOWER_GetTime();
+    s_lowPowerWakeCycles = DWT->CYCCNT;
+    s_lowPowerStats.idleTime_us += s_lowPowerWakeTime - now;
+    s_lowPowerStats.wakeups++;
+    if (s_lowPowerHook != NULL)
+    {
+        s_lowPowerHook(kAPP_LowPowerExitIdle, s_lowPowerWakeTime, s_lowPowerHookData);
+    }
+
+    EnableGlobalIRQ(primask);
+}
+
+/*!
+ * brief Gets the accounting collected since APP_LOWPOWER_Init() or the last reset.
+ *
+ * param stats Accounting output.
+ */
+void APP_LOWPOWER_GetStats(app_lowpower_stats_t *stats)
+{
+    assert(stats != NULL);
+
+    uint32_t primask = DisableGlobalIRQ();
+
+    *stats = s_lowPowerStats;
+    stats->activeTime_us += APP_LOWPOWER_GetTime() - s_lowPowerWakeTime;
+    stats->activeCycles += DWT->CYCCNT - s_lowPowerWakeCycles;
+
+    EnableGlobalIRQ(primask);
+}
+
+/*!
+ * brief Restarts the accounting.
+ */
+void APP_LOWPOWER_ResetStats(void)
+{
+    uint32_t primask = DisableGlobalIRQ();
+
+    (void)memset(&s_lowPowerStats, 0, sizeof(s_lowPowerStats));
+    s_lowPowerWakeTime   = APP_LOWPOWER_GetTime();
+    s_lowPowerWakeCycles = DWT->CYCCNT;
+
+    EnableGlobalIRQ(primask);
+}
+
+/*!
+ * brief Gets the share of time the core was active.
+ *
+ * return Active share in unit of 0.01%, [0, 10000].
+ */
+uint32_t APP_LOWPOWER_GetActiveShare(void)
+{
+    app_lowpower_stats_t stats;
+    uint64_t total;
+
+    APP_LOWPOWER_GetStats(&stats);
+    total = stats.activeTime_us + stats.idleTime_us;
+    if (total == 0U)
+    {
+        return 10000U;
+    }
+
+    return (uint32_t)((stats.activeTime_us * 10000U) / total);
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_LOWPOWER_H_
+#define APP_LOWPOWER_H_
+
+#include "fsl_common.h"
+#include "fsl_flexio.h"
+
+/*!
+ * @addtogroup app_lowpower
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * The FlexIO state machine produces the PWM without any CPU work, the core only has to run
+ * when a duty update is queued: FLEXIO_CPWM_Update() enables the period timer interrupt, which
+ * is the only interrupt the PWM path raises. Between updates the core waits in WFI.
+ *
+ * - Sleep: only the core clock is gated, every peripheral keeps running.
+ * - Deep sleep: core, platform and peripheral bus clocks are gated. FlexIO keeps counting on its
+ *   functional clock (FRO_HF) as long as FIRC stays enabled in low power modes, the FlexIO
+ *   doze mode is disabled and the SPC keeps the core supply at a level that sustains the FlexIO
+ *   clock. The eDMA is stopped in deep sleep, so ramps fall back to sleep.
+ *
+ * Time is accounted with OSTIMER0 running from clk_1m, which keeps counting in both modes,
+ * active core cycles with the DWT cycle counter, which stops while the core clock is gated.
+ */
+
+/*! @brief Idle mode entered by APP_LOWPOWER_Idle(). */
+typedef enum _app_lowpower_mode
+{
+    kAPP_LowPowerRun = 0U,    /*!< No low power mode, APP_LOWPOWER_Idle() returns immediately. */
+    kAPP_LowPowerSleep,       /*!< Core clock gated. */
+    kAPP_LowPowerDeepSleep,   /*!< Core, platform and peripheral clocks gated, FlexIO keeps running. */
+} app_lowpower_mode_t;
+
+/*! @brief Events reported to the cycle-accounting hook. */
+typedef enum _app_lowpower_event
+{
+    kAPP_LowPowerEnterIdle = 0U, /*!< The core is about to wait for an interrupt. */
+    kAPP_LowPowerExitIdle,       /*!< The core woke up, the interrupt is not serviced yet. */
+} app_lowpower_event_t;
+
+/*!
+ * @brief Cycle-accounting hook, called with interrupts masked around every idle period.
+ *
+ * @param event     Idle entry or exit.
+ * @param timestamp Current OSTIMER time in microseconds.
+ * @param userData  Parameter passed to APP_LOWPOWER_SetHook().
+ */
+typedef void (*app_lowpower_hook_t)(app_lowpower_event_t event, uint64_t timestamp, void *userData);
+
+/*! @brief Active versus idle accounting. */
+typedef struct _app_lowpower_stats
+{
+    uint64_t activeTime_us; /*!< Time spent with the core running. */
+    uint64_t idleTime_us;   /*!< Time spent waiting for an interrupt. */
+    uint64_t activeCycles;  /*!< Core cycles executed, from the DWT cycle counter. */
+    uint32_t wakeups;       /*!< Number of idle periods ended by an interrupt. */
+} app_lowpower_stats_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Prepares the FlexIO instance, the clocks and the SPC for the selected idle mode.
+ *
+ * Also starts the OSTIMER time base and the DWT cycle counter used by the accounting.
+ *
+ * @param base FlexIO instance which has to keep running while the core is idle.
+ * @param mode Idle mode.
+ * @retval kStatus_Success The mode is configured.
+ * @retval kStatus_Fail The SPC rejected the low power regulator settings.
+ */
+status_t APP_LOWPOWER_Init(FLEXIO_Type *base, app_lowpower_mode_t mode);
+
+/*!
+ * @brief Installs the cycle-accounting hook.
+ *
+ * @param hook     Hook function, NULL to remove.
+ * @param userData Hook parameter.
+ */
+void APP_LOWPOWER_SetHook(app_lowpower_hook_t hook, void *userData);
+
+/*!
+ * @brief Waits for the next interrupt in the configured idle mode.
+ *
+ * Call it from the main loop. The interrupt is serviced before the function returns.
+ *
+ * @param allowDeepSleep false limits the idle mode to sleep, e.g. while an eDMA ramp streams.
+ */
+void APP_LOWPOWER_Idle(bool allowDeepSleep);
+
+/*!
+ * @brief Gets the accounting collected since APP_LOWPOWER_Init() or the last reset.
+ *
+ * The time spent since the last wakeup is included in activeTime_us.
+ *
+ * @param stats Accounting output.
+ */
+void APP_LOWPOWER_GetStats(app_lowpower_stats_t *stats);
+
+/*!
+ * @brief Restarts the accounting.
+ */
+void APP_LOWPOWER_ResetStats(void);
+
+/*!
+ * @brief Gets the share of time the core was active.
+ *
+ * @return Active share in unit of 0.01%, [0, 10000].
+ */
+uint32_t APP_LOWPOWER_GetActiveShare(void);
+
+/*!
+ * @brief Gets the OSTIMER time base.
+ *
+ * @return Time since APP_LOWPOWER_Init() in microseconds.
+ */
+uint64_t APP_LOWPOWER_GetTime(void);
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_LOWPOWER_H_ */
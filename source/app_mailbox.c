@@ -0,0 +1,179 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "app_mailbox.h"
+#include "fsl_reset.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* MAILBOX word read by core1. */
+#define APP_MAILBOX_CORE1 (1U)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static status_t APP_MAILBOX_Post(app_mailbox_ring_t *ring, void *slots, uint32_t slotCount, uint32_t slotSize,
+                                 const void *entry);
+static status_t APP_MAILBOX_Get(app_mailbox_ring_t *ring, const void *slots, uint32_t slotCount, uint32_t slotSize,
+                                void *entry);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Producer side, the only writer of head. */
+static status_t APP_MAILBOX_Post(app_mailbox_ring_t *ring, void *slots, uint32_t slotCount, uint32_t slotSize,
+                                 const void *entry)
+{
+    uint32_t head = ring->head;
+
+    if ((head - ring->tail) >= slotCount)
+    {
+        ring->drop++;
+        return kStatus_Busy;
+    }
+
+    (void)memcpy((uint8_t *)slots + ((head & (slotCount - 1U)) * slotSize), entry, slotSize);
+
+    /* The slot is complete before the consumer can see it. */
+    __DMB();
+    ring->head = head + 1U;
+
+    return kStatus_Success;
+}
+
+/* Consumer side, the only writer of tail. */
+static status_t APP_MAILBOX_Get(app_mailbox_ring_t *ring, const void *slots, uint32_t slotCount, uint32_t slotSize,
+                                void *entry)
+{
+    uint32_t tail = ring->tail;
+
+    if (tail == ring->head)
+    {
+        return kStatus_NoData;
+    }
+
+    /* The slot is read after head, and released after the copy. */
+    __DMB();
+    (void)memcpy(entry, (const uint8_t *)slots + ((tail & (slotCount - 1U)) * slotSize), slotSize);
+    __DMB();
+    ring->tail = tail + 1U;
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Initializes the shared mailbox.
+ *
+ * param mailbox        Mailbox in SRAM reachable by both cores.
+ * param coreClock_Hz   Core clock frequency.
+ * param flexioClock_Hz FlexIO clock frequency.
+ */
+void APP_MAILBOX_Init(app_mailbox_t *mailbox, uint32_t coreClock_Hz, uint32_t flexioClock_Hz)
+{
+    assert(mailbox != NULL);
+
+    (void)memset(mailbox, 0, sizeof(*mailbox));
+    mailbox->coreClock_Hz   = coreClock_Hz;
+    mailbox->flexioClock_Hz = flexioClock_Hz;
+    __DMB();
+    mailbox->magic = APP_MAILBOX_MAGIC;
+}
+
+/*!
+ * brief Hands the mailbox address to core1, call before releasing core1.
+ *
+ * param mailbox Initialized mailbox.
+ */
+void APP_MAILBOX_Publish(app_mailbox_t *mailbox)
+{
+    CLOCK_EnableClock(kCLOCK_Mailbox);
+    RESET_ReleasePeripheralReset(kMAILBOX_RST_SHIFT_RSTn);
+
+    /* The core1 interrupt stays disabled in its NVIC, the word is only read. */
+    MAILBOX->MBOXIRQ[APP_MAILBOX_CORE1].IRQCLR = 0xFFFFFFFFU;
+    MAILBOX->MBOXIRQ[APP_MAILBOX_CORE1].IRQSET = (uint32_t)mailbox;
+    __DSB();
+}
+
+/*!
+ * brief Posts a command to core1.
+ *
+ * param mailbox Mailbox.
+ * param command Command to copy.
+ * retval kStatus_Success The command is queued.
+ * retval kStatus_Busy The ring is full, the command is dropped and counted.
+ */
+status_t APP_MAILBOX_PostCommand(app_mailbox_t *mailbox, const app_mailbox_command_t *command)
+{
+    return APP_MAILBOX_Post(&mailbox->commandRing, mailbox->command, APP_MAILBOX_COMMAND_SLOTS,
+                            sizeof(app_mailbox_command_t), command);
+}
+
+/*!
+ * brief Gets the oldest telemetry snapshot from core1.
+ *
+ * param mailbox   Mailbox.
+ * param telemetry Destination.
+ * retval kStatus_Success A snapshot is copied.
+ * retval kStatus_NoData The ring is empty.
+ */
+status_t APP_MAILBOX_GetTelemetry(app_mailbox_t *mailbox, app_mailbox_telemetry_t *telemetry)
+{
+    return APP_MAILBOX_Get(&mailbox->telemetryRing, mailbox->telemetry, APP_MAILBOX_TELEMETRY_SLOTS,
+                           sizeof(app_mailbox_telemetry_t), telemetry);
+}
+
+/*!
+ * brief Gets the mailbox published by core0.
+ *
+ * return The mailbox, NULL if core0 did not publish one.
+ */
+app_mailbox_t *APP_MAILBOX_Attach(void)
+{
+    app_mailbox_t *mailbox = (app_mailbox_t *)MAILBOX->MBOXIRQ[APP_MAILBOX_CORE1].IRQ;
+
+    if ((mailbox == NULL) || (mailbox->magic != APP_MAILBOX_MAGIC))
+    {
+        return NULL;
+    }
+
+    MAILBOX->MBOXIRQ[APP_MAILBOX_CORE1].IRQCLR = (uint32_t)mailbox;
+    __DMB();
+
+    return mailbox;
+}
+
+/*!
+ * brief Gets the oldest command from core0.
+ *
+ * param mailbox Mailbox.
+ * param command Destination.
+ * retval kStatus_Success A command is copied.
+ * retval kStatus_NoData The ring is empty.
+ */
+status_t APP_MAILBOX_GetCommand(app_mailbox_t *mailbox, app_mailbox_command_t *command)
+{
+    return APP_MAILBOX_Get(&mailbox->commandRing, mailbox->command, APP_MAILBOX_COMMAND_SLOTS,
+                           sizeof(app_mailbox_command_t), command);
+}
+
+/*!
+ * brief Posts a telemetry snapshot to core0.
+ *
+ * param mailbox   Mailbox.
+ * param telemetry Snapshot to copy.
+ * retval kStatus_Success The snapshot is queued.
+ * retval kStatus_Busy The ring is full, the snapshot is dropped and counted.
+ */
+status_t APP_MAILBOX_PostTelemetry(app_mailbox_t *mailbox, const app_mailbox_telemetry_t *telemetry)
+{
+    return APP_MAILBOX_Post(&mailbox->telemetryRing, mailbox->telemetry, APP_MAILBOX_TELEMETRY_SLOTS,
+                            sizeof(app_mailbox_telemetry_t), telemetry);
+}
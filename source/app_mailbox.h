@@ -0,0 +1,180 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_MAILBOX_H_
+#define APP_MAILBOX_H_
+
+#include "fsl_common.h"
+#include "flexio_cpwm.h"
+
+/*!
+ * @addtogroup app_mailbox
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Dual-core mailbox. Core0 owns the debug console and the host side, core1 owns FLEXIO0 and the
+ * PWM loop. They share one app_mailbox_t in SRAM holding two single-producer/single-consumer rings:
+ * - commands, written by core0 and read by core1;
+ * - telemetry, written by core1 and read by core0.
+ * Each ring index is written by one core only: the producer owns head, the consumer owns tail, so
+ * no lock and no interrupt is needed. A barrier orders the slot access and the index update.
+ * Core0 hands the mailbox address to core1 through the core1 word of the MAILBOX peripheral.
+ */
+
+/*! @brief Command slots, a power of two. */
+#define APP_MAILBOX_COMMAND_SLOTS (16U)
+/*! @brief Telemetry slots, a power of two. */
+#define APP_MAILBOX_TELEMETRY_SLOTS (16U)
+
+/*! @brief Commands from core0 to core1. */
+typedef enum _app_mailbox_command_type
+{
+    kAPP_MailboxSetDuty = 1U,  /*!< value: duty in %, [0, 100]. */
+    kAPP_MailboxSetDutyTicks,  /*!< value: on-time in FlexIO clocks. */
+    kAPP_MailboxSetFrequency,  /*!< value: PWM frequency in Hz, all channels keep their duty. */
+} app_mailbox_command_type_t;
+
+/*! @brief Command slot. */
+typedef struct _app_mailbox_command
+{
+    uint8_t type;     /*!< One of app_mailbox_command_type_t. */
+    uint8_t channel;  /*!< Engine channel, unused by kAPP_MailboxSetFrequency. */
+    uint16_t reserved;
+    uint32_t value;   /*!< Command parameter. */
+} app_mailbox_command_t;
+
+/*! @brief Telemetry slot, a snapshot of the core1 loop. */
+typedef struct _app_mailbox_telemetry
+{
+    uint32_t loopCount;                          /*!< Loop iterations since core1 start. */
+    uint32_t overrunCount;                       /*!< Iterations which missed their tick. */
+    uint32_t maxLoopCycles;                      /*!< Longest iteration since the last snapshot. */
+    uint32_t commandCount;                       /*!< Commands applied since core1 start. */
+    uint32_t periodTicks;                        /*!< PWM period in FlexIO clocks. */
+    uint32_t onTicks[FLEXIO_CPWM_MAX_CHANNELS];  /*!< Committed on-times. */
+} app_mailbox_telemetry_t;
+
+/*! @brief Ring indexes, free running, the slot is index % slots. */
+typedef struct _app_mailbox_ring
+{
+    volatile uint32_t head; /*!< Next slot to write, owned by the producer. */
+    volatile uint32_t tail; /*!< Next slot to read, owned by the consumer. */
+    volatile uint32_t drop; /*!< Posts refused on a full ring, owned by the producer. */
+} app_mailbox_ring_t;
+
+/*! @brief Shared mailbox, placed by core0, used by both cores. */
+typedef struct _app_mailbox
+{
+    uint32_t magic;                   /*!< APP_MAILBOX_MAGIC once initialized. */
+    uint32_t coreClock_Hz;            /*!< Core clock, both cores share it. */
+    uint32_t flexioClock_Hz;          /*!< FlexIO clock set up by core0. */
+    volatile uint32_t core1Ready;     /*!< Set by core1 once the PWM runs. */
+    app_mailbox_ring_t commandRing;   /*!< core0 -> core1. */
+    app_mailbox_ring_t telemetryRing; /*!< core1 -> core0. */
+    app_mailbox_command_t command[APP_MAILBOX_COMMAND_SLOTS];
+    app_mailbox_telemetry_t telemetry[APP_MAILBOX_TELEMETRY_SLOTS];
+} app_mailbox_t;
+
+/*! @brief Marks an initialized mailbox. */
+#define APP_MAILBOX_MAGIC (0x4D424F58UL)
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @name Core0
+ * @{
+ */
+
+/*!
+ * @brief Initializes the shared mailbox.
+ *
+ * @param mailbox        Mailbox in SRAM reachable by both cores.
+ * @param coreClock_Hz   Core clock frequency.
+ * @param flexioClock_Hz FlexIO clock frequency.
+ */
+void APP_MAILBOX_Init(app_mailbox_t *mailbox, uint32_t coreClock_Hz, uint32_t flexioClock_Hz);
+
+/*!
+ * @brief Hands the mailbox address to core1, call before releasing core1.
+ *
+ * @param mailbox Initialized mailbox.
+ */
+void APP_MAILBOX_Publish(app_mailbox_t *mailbox);
+
+/*!
+ * @brief Posts a command to core1.
+ *
+ * @param mailbox Mailbox.
+ * @param command Command to copy.
+ * @retval kStatus_Success The command is queued.
+ * @retval kStatus_Busy The ring is full, the command is dropped and counted.
+ */
+status_t APP_MAILBOX_PostCommand(app_mailbox_t *mailbox, const app_mailbox_command_t *command);
+
+/*!
+ * @brief Gets the oldest telemetry snapshot from core1.
+ *
+ * @param mailbox   Mailbox.
+ * @param telemetry Destination.
+ * @retval kStatus_Success A snapshot is copied.
+ * @retval kStatus_NoData The ring is empty.
+ */
+status_t APP_MAILBOX_GetTelemetry(app_mailbox_t *mailbox, app_mailbox_telemetry_t *telemetry);
+
+/*! @} */
+
+/*!
+ * @name Core1
+ * @{
+ */
+
+/*!
+ * @brief Gets the mailbox published by core0.
+ *
+ * @return The mailbox, NULL if core0 did not publish one.
+ */
+app_mailbox_t *APP_MAILBOX_Attach(void);
+
+/*!
+ * @brief Gets the oldest command from core0.
+ *
+ * @param mailbox Mailbox.
+ * @param command Destination.
+ * @retval kStatus_Success A command is copied.
+ * @retval kStatus_NoData The ring is empty.
+ */
+status_t APP_MAILBOX_GetCommand(app_mailbox_t *mailbox, app_mailbox_command_t *command);
+
+/*!
+ * @brief Posts a telemetry snapshot to core0.
+ *
+ * @param mailbox   Mailbox.
+ * @param telemetry Snapshot to copy.
+ * @retval kStatus_Success The snapshot is queued.
+ * @retval kStatus_Busy The ring is full, the snapshot is dropped and counted.
+ */
+status_t APP_MAILBOX_PostTelemetry(app_mailbox_t *mailbox, const app_mailbox_telemetry_t *telemetry);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_MAILBOX_H_ */
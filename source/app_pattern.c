@@ -0,0 +1,330 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "app_pattern.h"
+#include "app_edma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* FXIO_D0..D31, the pin selects are 5 bits wide. */
+#define APP_PATTERN_PIN_COUNT (32U)
+
+/* Pattern generator state, thread level only. */
+typedef struct _app_pattern
+{
+    FLEXIO_Type *base;
+    uint8_t shifter;
+    uint8_t timer;
+    uint8_t dmaChannel;
+    uint8_t half;
+    bool doneCounted;
+    uint32_t *buffer;
+    uint32_t halfWords;
+    app_pattern_fill_t fill;
+    void *userData;
+    const uint32_t *pattern;
+    uint32_t patternWords;
+    uint32_t patternIndex;
+    app_pattern_status_t status;
+} app_pattern_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void APP_PATTERN_Fill(uint32_t *words, uint32_t wordCount);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static app_pattern_t s_pattern;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Fills words from the callback, or with the next words of the looped pattern. */
+static void APP_PATTERN_Fill(uint32_t *words, uint32_t wordCount)
+{
+    uint32_t count;
+
+    if (s_pattern.fill != NULL)
+    {
+        s_pattern.fill(words, wordCount, s_pattern.userData);
+        return;
+    }
+
+    while (wordCount > 0U)
+    {
+        count = s_pattern.patternWords - s_pattern.patternIndex;
+        if (count > wordCount)
+        {
+            count = wordCount;
+        }
+        (void)memcpy(words, &s_pattern.pattern[s_pattern.patternIndex], count * sizeof(uint32_t));
+        words += count;
+        wordCount -= count;
+        s_pattern.patternIndex += count;
+        if (s_pattern.patternIndex == s_pattern.patternWords)
+        {
+            s_pattern.patternIndex = 0U;
+        }
+    }
+}
+
+/*!
+ * brief Gets the default configuration: 4 pins from FXIO_D24, clock on FXIO_D28, 10 MHz, shifter 0,
+ * timer 0, eDMA channel 2.
+ *
+ * param config Pointer to the configuration structure.
+ */
+void APP_PATTERN_GetDefaultConfig(app_pattern_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->sampleRate_Hz = 10000000U;
+    config->firstPin      = 24U;
+    config->pinCount      = 4U;
+    config->clockPin      = 28U;
+    config->shifter       = 0U;
+    config->timer         = 0U;
+    config->dmaChannel    = 2U;
+}
+
+/*!
+ * brief Takes a FlexIO instance over and starts the pattern.
+ *
+ * param base   FlexIO peripheral base address.
+ * param config Pattern generator configuration.
+ * retval kStatus_Success The pattern runs.
+ * retval kStatus_InvalidArgument Pin, rate or buffer out of range, or no pattern source.
+ */
+status_t APP_PATTERN_Init(FLEXIO_Type *base, const app_pattern_config_t *config)
+{
+    assert(base != NULL);
+    assert(config != NULL);
+
+    flexio_shifter_config_t shifterConfig;
+    flexio_timer_config_t timerConfig;
+    uint32_t samplesPerWord;
+    uint32_t divider;
+    uint32_t words;
+    uint32_t ctrl;
+    uint8_t channel = config->dmaChannel;
+
+    if ((config->pinCount != 1U) && (config->pinCount != 2U) && (config->pinCount != 4U) &&
+        (config->pinCount != 8U))
+    {
+        return kStatus_InvalidArgument;
+    }
+    if (((config->firstPin + config->pinCount) > APP_PATTERN_PIN_COUNT) ||
+        ((config->clockPin != APP_PATTERN_NO_PIN) && (config->clockPin >= APP_PATTERN_PIN_COUNT)) ||
+        (config->shifter >= FLEXIO_SHIFTBUF_COUNT) || (config->timer >= FLEXIO_TIMCTL_COUNT))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* The timer toggles the shift clock every divider FlexIO clocks, its low compare byte is divider - 1. */
+    if ((config->sampleRate_Hz == 0U) || (config->sampleRate_Hz > (config->srcClock_Hz / 2U)))
+    {
+        return kStatus_InvalidArgument;
+    }
+    divider = (config->srcClock_Hz + config->sampleRate_Hz) / (2U * config->sampleRate_Hz);
+    if (divider > 256U)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    words = 2U * config->halfWords;
+    if ((config->buffer == NULL) || (config->halfWords == 0U) || (words > DMA_TCD_CITER_ELINKNO_CITER_MASK) ||
+        ((config->fill == NULL) && ((config->pattern == NULL) || (config->patternWords == 0U))))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    APP_PATTERN_Deinit();
+
+    (void)memset(&s_pattern, 0, sizeof(s_pattern));
+    s_pattern.base                 = base;
+    s_pattern.shifter              = config->shifter;
+    s_pattern.timer                = config->timer;
+    s_pattern.dmaChannel           = channel;
+    s_pattern.buffer               = config->buffer;
+    s_pattern.halfWords            = config->halfWords;
+    s_pattern.fill                 = config->fill;
+    s_pattern.userData             = config->userData;
+    s_pattern.pattern              = config->pattern;
+    s_pattern.patternWords         = config->patternWords;
+    s_pattern.status.sampleRate_Hz = config->srcClock_Hz / (2U * divider);
+
+    APP_PATTERN_Fill(&config->buffer[0], words);
+
+    /* Every shifter and timer of the PWM stops, the instance keeps its control bits. */
+    ctrl = base->CTRL;
+    FLEXIO_Reset(base);
+    base->CTRL = ctrl & ~FLEXIO_CTRL_SWRST_MASK;
+
+    /* Circular feed: the source wraps at the end of every major loop, the request stays on. */
+    APP_EDMA_Init();
+    APP_EDMA_ResetChannel(channel, APP_EDMA_GetFlexioRequest(FLEXIO_GetInstance(base), config->shifter));
+    APP_EDMA_BASEADDR->CH[channel].TCD_SADDR = (uint32_t)&config->buffer[0];
+    APP_EDMA_BASEADDR->CH[channel].TCD_SOFF  = 4U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_ATTR =
+        DMA_TCD_ATTR_SSIZE(APP_EDMA_SIZE_4BYTES) | DMA_TCD_ATTR_DSIZE(APP_EDMA_SIZE_4BYTES);
+    APP_EDMA_BASEADDR->CH[channel].TCD_NBYTES_MLOFFNO = 4U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_SLAST_SDA      = (uint32_t)(-(int32_t)(words * 4U));
+    APP_EDMA_BASEADDR->CH[channel].TCD_DADDR =
+        FLEXIO_GetShifterBufferAddress(base, kFLEXIO_ShifterBuffer, config->shifter);
+    APP_EDMA_BASEADDR->CH[channel].TCD_DOFF          = 0U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_CITER_ELINKNO = (uint16_t)words;
+    APP_EDMA_BASEADDR->CH[channel].TCD_BITER_ELINKNO = (uint16_t)words;
+
+    shifterConfig.timerSelect   = config->timer;
+    shifterConfig.timerPolarity = kFLEXIO_ShifterTimerPolarityOnNegitive;
+    shifterConfig.pinConfig     = kFLEXIO_PinConfigOutput;
+    shifterConfig.pinSelect     = config->firstPin;
+    shifterConfig.pinPolarity   = kFLEXIO_PinActiveHigh;
+    shifterConfig.shifterMode   = kFLEXIO_ShifterModeTransmit;
+    shifterConfig.parallelWidth = (uint32_t)config->pinCount - 1U;
+    shifterConfig.inputSource   = kFLEXIO_ShifterInputFromPin;
+    shifterConfig.shifterStop   = kFLEXIO_ShifterStopBitDisable;
+    shifterConfig.shifterStart  = kFLEXIO_ShifterStartBitDisabledLoadDataOnEnable;
+    FLEXIO_SetShifterConfig(base, config->shifter, &shifterConfig);
+
+    /* Enabled by the first word in the buffer, then free running: one shifter load per 32 bits. */
+    samplesPerWord              = 32U / config->pinCount;
+    timerConfig.triggerSelect   = FLEXIO_TIMER_TRIGGER_SEL_SHIFTnSTAT(config->shifter);
+    timerConfig.triggerPolarity = kFLEXIO_TimerTriggerPolarityActiveLow;
+    timerConfig.triggerSource   = kFLEXIO_TimerTriggerSourceInternal;
+    timerConfig.pinConfig       = (config->clockPin != APP_PATTERN_NO_PIN) ? kFLEXIO_PinConfigOutput :
+                                                                             kFLEXIO_PinConfigOutputDisabled;
+    timerConfig.pinSelect       = (config->clockPin != APP_PATTERN_NO_PIN) ? config->clockPin : 0U;
+    timerConfig.pinPolarity     = kFLEXIO_PinActiveHigh;
+    timerConfig.timerMode       = kFLEXIO_TimerModeDual8BitBaudBit;
+    timerConfig.timerOutput     = kFLEXIO_TimerOutputZeroNotAffectedByReset;
+    timerConfig.timerDecrement  = kFLEXIO_TimerDecSrcOnFlexIOClockShiftTimerOutput;
+    timerConfig.timerReset      = kFLEXIO_TimerResetNever;
+    timerConfig.timerDisable    = kFLEXIO_TimerDisableNever;
+    timerConfig.timerEnable     = kFLEXIO_TimerEnableOnTriggerHigh;
+    timerConfig.timerStop       = kFLEXIO_TimerStopBitDisabled;
+    timerConfig.timerStart      = kFLEXIO_TimerStartBitDisabled;
+    timerConfig.timerCompare    = (((2U * samplesPerWord) - 1U) << 8U) | (divider - 1U);
+    FLEXIO_SetTimerConfig(base, config->timer, &timerConfig);
+
+    FLEXIO_ClearShifterErrorFlags(base, 1UL << config->shifter);
+    FLEXIO_EnableShifterStatusDMA(base, 1UL << config->shifter, true);
+    APP_EDMA_EnableRequest(channel);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops the pattern, the pins are released.
+ */
+void APP_PATTERN_Deinit(void)
+{
+    FLEXIO_Type *base = s_pattern.base;
+
+    if (base == NULL)
+    {
+        return;
+    }
+
+    APP_EDMA_StopChannel(s_pattern.dmaChannel);
+    FLEXIO_EnableShifterStatusDMA(base, 1UL << s_pattern.shifter, false);
+    base->TIMCTL[s_pattern.timer]     = 0U;
+    base->SHIFTCTL[s_pattern.shifter] = 0U;
+    s_pattern.base                    = NULL;
+}
+
+/*!
+ * brief Refills the half the eDMA has left and checks for underruns, call it from the main loop.
+ *
+ * retval kStatus_Success Nothing to report.
+ * retval kStatus_APP_PatternLate A half was played before it was refilled.
+ * retval kStatus_APP_PatternUnderrun The shifter buffer was empty when the shifter reloaded.
+ */
+status_t APP_PATTERN_Poll(void)
+{
+    FLEXIO_Type *base = s_pattern.base;
+    uint8_t channel   = s_pattern.dmaChannel;
+    status_t status   = kStatus_Success;
+    uint32_t csr;
+    uint32_t half;
+    int32_t passed;
+    bool done;
+
+    if (base == NULL)
+    {
+        return kStatus_Success;
+    }
+
+    /*
+     * Whether the major loop wrapped since the last poll, then the half being read now. DONE comes
+     * first, as in APP_CAPTURE_GetWritten(): a wrap between the two reads shows in the half only, its
+     * DONE is then skipped once at the next poll.
+     */
+    csr  = APP_EDMA_BASEADDR->CH[channel].CH_CSR;
+    done = (0U != (csr & DMA_CH_CSR_DONE_MASK));
+    if (done)
+    {
+        APP_EDMA_BASEADDR->CH[channel].CH_CSR = csr; /* DONE is write 1 to clear, ERQ is kept. */
+        if (s_pattern.doneCounted)
+        {
+            s_pattern.doneCounted = false;
+            done                  = false;
+        }
+    }
+    half = ((2U * s_pattern.halfWords) - APP_EDMA_GetRemainingMajorLoopCount(channel)) >= s_pattern.halfWords ?
+               1U :
+               0U;
+
+    /* Halves the eDMA went through since the last poll: from the one it was in to the current one. */
+    passed = (int32_t)half - (int32_t)s_pattern.half + (done ? 2 : 0);
+    if (passed < 0)
+    {
+        /* Wrapped after DONE was read. */
+        passed                = 1;
+        s_pattern.doneCounted = true;
+    }
+    if (passed > 0)
+    {
+        if (passed > 1)
+        {
+            s_pattern.status.late++;
+            status = kStatus_APP_PatternLate;
+        }
+        APP_PATTERN_Fill(&s_pattern.buffer[(1U - half) * s_pattern.halfWords], s_pattern.halfWords);
+        s_pattern.status.refills++;
+        s_pattern.half = (uint8_t)half;
+    }
+
+    if (0U != (FLEXIO_GetShifterErrorFlags(base) & (1UL << s_pattern.shifter)))
+    {
+        FLEXIO_ClearShifterErrorFlags(base, 1UL << s_pattern.shifter);
+        s_pattern.status.underruns++;
+        status = kStatus_APP_PatternUnderrun;
+    }
+
+    return status;
+}
+
+/*!
+ * brief Gets the counters.
+ *
+ * param status Pointer to the status structure.
+ */
+void APP_PATTERN_GetStatus(app_pattern_status_t *status)
+{
+    assert(status != NULL);
+
+    *status = s_pattern.status;
+}
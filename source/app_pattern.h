@@ -0,0 +1,151 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_PATTERN_H_
+#define APP_PATTERN_H_
+
+#include "fsl_common.h"
+#include "fsl_flexio.h"
+
+/*!
+ * @addtogroup app_pattern
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Arbitrary digital patterns on up to 8 FlexIO pins, in place of the PWM.
+ *
+ * One shifter runs in parallel transmit mode: every shift clock puts the next pinCount bits of its
+ * buffer on the pins firstPin.., a 32-bit word carries 32 / pinCount samples, bit 0 first. A timer
+ * in 8-bit baud mode makes the shift clock, optionally on clockPin: the pins change on its falling
+ * edge and are stable at its rising edge. The timer starts once the shifter buffer holds the first
+ * word and then never stops, so the samples are evenly spaced.
+ *
+ * An eDMA channel feeds the shifter buffer from a ping-pong buffer in SRAM, circularly.
+ * APP_PATTERN_Poll() refills the half the eDMA has left, from a fill callback or from a pattern
+ * table played in a loop, so the pattern can be far larger than the buffer, or generated. A half
+ * the eDMA reaches before it was refilled is counted as late, its stale words are played. The
+ * shifter error flag (SHIFTERR) reports an underrun: the shifter reloaded before the eDMA wrote
+ * the buffer, the previous word was repeated.
+ *
+ * The FlexIO instance is reset, the PWM engine and everything built on its timers stop.
+ */
+
+/*! @brief No clock output pin. */
+#define APP_PATTERN_NO_PIN (0xFFU)
+
+/*! @brief Status group of the pattern generator. */
+#define kStatusGroup_APP_PATTERN (kStatusGroup_ApplicationRangeStart + 2)
+
+/*! @brief Error codes of the pattern generator. */
+enum
+{
+    kStatus_APP_PatternUnderrun = MAKE_STATUS(kStatusGroup_APP_PATTERN, 0), /*!< The shifter ran dry. */
+    kStatus_APP_PatternLate     = MAKE_STATUS(kStatusGroup_APP_PATTERN, 1), /*!< A half was not refilled in time. */
+};
+
+/*!
+ * @brief Fills words of the ping-pong buffer with the next samples, from APP_PATTERN_Poll().
+ *
+ * Each word holds 32 / pinCount samples, the first one in its lowest bits.
+ */
+typedef void (*app_pattern_fill_t)(uint32_t *words, uint32_t wordCount, void *userData);
+
+/*! @brief Pattern generator configuration. */
+typedef struct _app_pattern_config
+{
+    uint32_t srcClock_Hz;    /*!< FlexIO clock frequency. */
+    uint32_t sampleRate_Hz;  /*!< Samples per second, up to srcClock_Hz / 2. */
+    uint8_t firstPin;        /*!< FlexIO pin of the lowest sample bit. */
+    uint8_t pinCount;        /*!< Bits per sample: 1, 2, 4 or 8. */
+    uint8_t clockPin;        /*!< FlexIO pin of the sample clock, APP_PATTERN_NO_PIN for none. */
+    uint8_t shifter;         /*!< FlexIO shifter in parallel transmit mode. */
+    uint8_t timer;           /*!< FlexIO timer making the shift clock. */
+    uint8_t dmaChannel;      /*!< eDMA channel feeding the shifter. */
+    uint32_t *buffer;        /*!< Ping-pong buffer of 2 * halfWords words. */
+    uint32_t halfWords;      /*!< Words per half. */
+    app_pattern_fill_t fill; /*!< Fill callback, NULL to play pattern. */
+    void *userData;          /*!< Fill callback parameter. */
+    const uint32_t *pattern; /*!< Pattern words played in a loop when fill is NULL. */
+    uint32_t patternWords;   /*!< Number of pattern words. */
+} app_pattern_config_t;
+
+/*! @brief Pattern generator counters. */
+typedef struct _app_pattern_status
+{
+    uint32_t sampleRate_Hz; /*!< Sample rate produced, the nearest the FlexIO clock divides to. */
+    uint32_t refills;       /*!< Halves refilled. */
+    uint32_t late;          /*!< Polls which found a half played before it was refilled. */
+    uint32_t underruns;     /*!< Polls which found the shifter error flag set. */
+} app_pattern_status_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Gets the default configuration: 4 pins from FXIO_D24, clock on FXIO_D28, 10 MHz, shifter 0,
+ * timer 0, eDMA channel 2.
+ *
+ * srcClock_Hz, buffer, halfWords and the pattern source are left zero and must be filled by the caller.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void APP_PATTERN_GetDefaultConfig(app_pattern_config_t *config);
+
+/*!
+ * @brief Takes a FlexIO instance over and starts the pattern.
+ *
+ * Both halves are filled before the first sample.
+ *
+ * @param base   FlexIO peripheral base address.
+ * @param config Pattern generator configuration.
+ * @retval kStatus_Success The pattern runs.
+ * @retval kStatus_InvalidArgument Pin, rate or buffer out of range, or no pattern source.
+ */
+status_t APP_PATTERN_Init(FLEXIO_Type *base, const app_pattern_config_t *config);
+
+/*!
+ * @brief Stops the pattern, the pins are released.
+ *
+ * The FlexIO instance is left enabled without shifter or timer, the PWM needs its peripheral
+ * initialization again.
+ */
+void APP_PATTERN_Deinit(void);
+
+/*!
+ * @brief Refills the half the eDMA has left and checks for underruns, call it from the main loop.
+ *
+ * A half lasts halfWords * 32 / pinCount samples, poll at least that often.
+ *
+ * @retval kStatus_Success Nothing to report.
+ * @retval kStatus_APP_PatternLate A half was played before it was refilled.
+ * @retval kStatus_APP_PatternUnderrun The shifter buffer was empty when the shifter reloaded.
+ */
+status_t APP_PATTERN_Poll(void);
+
+/*!
+ * @brief Gets the counters.
+ *
+ * @param status Pointer to the status structure.
+ */
+void APP_PATTERN_GetStatus(app_pattern_status_t *status);
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_PATTERN_H_ */
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "app_placement.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Cortex-M33 system exceptions in front of the device interrupts. */
+#define APP_PLACEMENT_SYSTEM_VECTORS (16U)
+
+/* Whole table, NUMBER_OF_INT_VECTORS counts the system exceptions too. */
+#define APP_PLACEMENT_VECTOR_COUNT (NUMBER_OF_INT_VECTORS)
+
+/* VTOR needs the table aligned on its size rounded up to a power of two. */
+#define APP_PLACEMENT_VECTOR_ALIGN (1024U)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+extern void FLEXIO_DriverIRQHandler(void);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+#if (defined(APP_PLACEMENT_ENABLE) && APP_PLACEMENT_ENABLE)
+__attribute__((section(".bss.$SRAMX"), aligned(APP_PLACEMENT_VECTOR_ALIGN))) static uint32_t
+    s_ramVectors[APP_PLACEMENT_VECTOR_COUNT];
+#endif
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * brief Moves the vector table to SRAMX.
+ */
+void APP_PLACEMENT_RelocateVectors(void)
+{
+#if (defined(APP_PLACEMENT_ENABLE) && APP_PLACEMENT_ENABLE)
+    const uint32_t *vectors = (const uint32_t *)SCB->VTOR;
+    uint32_t primask;
+    uint32_t i;
+
+    if (vectors == s_ramVectors)
+    {
+        return;
+    }
+
+    for (i = 0U; i < APP_PLACEMENT_VECTOR_COUNT; i++)
+    {
+        s_ramVectors[i] = vectors[i];
+    }
+    s_ramVectors[APP_PLACEMENT_SYSTEM_VECTORS + (uint32_t)FLEXIO_IRQn] = (uint32_t)FLEXIO_DriverIRQHandler;
+
+    primask   = DisableGlobalIRQ();
+    SCB->VTOR = (uint32_t)s_ramVectors;
+    __DSB();
+    __ISB();
+    EnableGlobalIRQ(primask);
+#endif
+}
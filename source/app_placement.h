@@ -0,0 +1,72 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_PLACEMENT_H_
+#define APP_PLACEMENT_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup app_placement
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Memory placement of the PWM update path. Flash is read through the LPCAC and a cache miss costs
+ * the flash wait states, the update path then runs in a time depending on what ran before it.
+ * - SRAMX (0x04000000) sits on the code bus: hot code and the vector table run from it at zero
+ *   wait states, whatever the cache state.
+ * - SRAMH (0x20060000) is a separate system bus slave: hot data does not contend with the
+ *   application buffers in SRAMA..SRAMG.
+ * The managed linker scripts already route these section names to SRAMX and SRAMH.
+ */
+
+/*! @brief 1 places the update path in SRAMX/SRAMH, 0 leaves it in flash and SRAMA, e.g. for comparison. */
+#ifndef APP_PLACEMENT_ENABLE
+#define APP_PLACEMENT_ENABLE 1
+#endif
+
+#if (defined(APP_PLACEMENT_ENABLE) && APP_PLACEMENT_ENABLE)
+/*! @brief Function executed from SRAMX. Not inlined, otherwise the code lands in the flash caller. */
+#define APP_HOT_CODE __attribute__((section(".ramfunc.$SRAMX"), noinline))
+/*! @brief Initialized variable in SRAMH. */
+#define APP_HOT_DATA __attribute__((section(".data.$SRAMH")))
+/*! @brief Zero initialized variable in SRAMH. */
+#define APP_HOT_BSS __attribute__((section(".bss.$SRAMH")))
+#else
+#define APP_HOT_CODE
+#define APP_HOT_DATA
+#define APP_HOT_BSS
+#endif
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Moves the vector table to SRAMX.
+ *
+ * The table is copied from the current one, then the FlexIO entry points straight at
+ * FLEXIO_DriverIRQHandler(), skipping the flash trampoline of the startup code. Does nothing when
+ * APP_PLACEMENT_ENABLE is 0. Call it once, before the FlexIO interrupt is enabled.
+ */
+void APP_PLACEMENT_RelocateVectors(void);
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_PLACEMENT_H_ */
@@ -0,0 +1,436 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "app_sched.h"
+#include "app_placement.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#if ((APP_SCHED_WHEEL_SLOTS & (APP_SCHED_WHEEL_SLOTS - 1U)) != 0U)
+#error "APP_SCHED_WHEEL_SLOTS must be a power of two."
+#endif
+
+/* Scheduler state, touched by the tick interrupt. */
+typedef struct _app_sched
+{
+    flexio_cpwm_handle_t *cpwm;
+    uint32_t timerMask;
+    volatile uint32_t period;
+    bool update;
+    uint32_t parkedMask;
+    uint32_t parkedTicks[FLEXIO_CPWM_MAX_CHANNELS];
+    list_label_t wheel[APP_SCHED_WHEEL_SLOTS];
+} app_sched_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void APP_SCHED_HandleIRQ(void *base, void *handle);
+static void APP_SCHED_Insert(app_sched_t *sched, app_sched_event_t *event);
+static status_t APP_SCHED_Apply(app_sched_t *sched, uint8_t action, uint8_t channel, uint32_t value);
+static void APP_SCHED_Dispatch(app_sched_t *sched, app_sched_event_t *event);
+static status_t APP_SCHED_Schedule(app_sched_event_t *event, uint32_t period);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Walked from the FlexIO interrupt every period, kept in SRAMH with the engine handle. */
+APP_HOT_BSS static app_sched_t s_sched;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Links an event to the slot of its period, the period is ahead of the current one. */
+APP_HOT_CODE static void APP_SCHED_Insert(app_sched_t *sched, app_sched_event_t *event)
+{
+    (void)LIST_AddTail(&sched->wheel[event->period & (APP_SCHED_WHEEL_SLOTS - 1U)], &event->link);
+}
+
+/* Stages one action, the staged channels are handed to FLEXIO_CPWM_Update() once the period is dispatched. */
+APP_HOT_CODE static status_t APP_SCHED_Apply(app_sched_t *sched, uint8_t action, uint8_t channel, uint32_t value)
+{
+    flexio_cpwm_handle_t *cpwm = sched->cpwm;
+    uint32_t oldTicks          = cpwm->periodTicks;
+    uint32_t channelMask       = 1UL << channel;
+    status_t status            = kStatus_Success;
+    uint8_t i;
+
+    if ((action != (uint8_t)kAPP_SchedFrequency) && (action != (uint8_t)kAPP_SchedBurst) &&
+        (channel >= cpwm->channelCount))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    switch (action)
+    {
+        case (uint8_t)kAPP_SchedDutyTicks:
+            if (0U != (sched->parkedMask & channelMask))
+            {
+                /* Taken over when the channel runs again. */
+                sched->parkedTicks[channel] = (value > oldTicks) ? oldTicks : value;
+            }
+            else
+            {
+                status        = FLEXIO_CPWM_SetDutyTicks(cpwm, channel, value);
+                sched->update = true;
+            }
+            break;
+
+        case (uint8_t)kAPP_SchedFrequency:
+            status = FLEXIO_CPWM_SetFrequency(cpwm, value);
+            if (kStatus_Success == status)
+            {
+                for (i = 0U; i < cpwm->channelCount; i++)
+                {
+                    sched->parkedTicks[i] = (uint32_t)((((uint64_t)sched->parkedTicks[i] * cpwm->periodTicks) +
+                                                        (oldTicks / 2U)) /
+                                                       oldTicks);
+                }
+            }
+            break;
+
+        case (uint8_t)kAPP_SchedMode:
+            if (value == (uint32_t)kAPP_SchedModeRun)
+            {
+                if (0U != (sched->parkedMask & channelMask))
+                {
+                    sched->parkedMask &= ~channelMask;
+                    status = FLEXIO_CPWM_SetDutyTicks(cpwm, channel, sched->parkedTicks[channel]);
+                }
+            }
+            else if (value <= (uint32_t)kAPP_SchedModeParkHigh)
+            {
+                if (0U == (sched->parkedMask & channelMask))
+                {
+                    sched->parkedTicks[channel] = FLEXIO_CPWM_GetDutyTicks(cpwm, channel);
+                    sched->parkedMask |= channelMask;
+                }
+                status = FLEXIO_CPWM_SetDutyTicks(cpwm, channel,
+                                                  (value == (uint32_t)kAPP_SchedModeParkHigh) ? oldTicks : 0U);
+            }
+            else
+            {
+                status = kStatus_InvalidArgument;
+            }
+            sched->update = true;
+            break;
+
+        case (uint8_t)kAPP_SchedBurst:
+            if (value == 0U)
+            {
+                FLEXIO_CPWM_StopBurst(cpwm);
+            }
+            else
+            {
+                status = FLEXIO_CPWM_StartBurst(cpwm, value, channel);
+            }
+            break;
+
+        default:
+            status = kStatus_InvalidArgument;
+            break;
+    }
+
+    return status;
+}
+
+/* Applies a due event, a profile moves on to its next step. */
+APP_HOT_CODE static void APP_SCHED_Dispatch(app_sched_t *sched, app_sched_event_t *event)
+{
+    const app_sched_step_t *step;
+    status_t status;
+
+    if (event->action != (uint8_t)kAPP_SchedProfile)
+    {
+        status = APP_SCHED_Apply(sched, event->action, event->channel, event->value);
+    }
+    else
+    {
+        do
+        {
+            step   = &event->steps[event->stepIndex];
+            status = APP_SCHED_Apply(sched, step->action, step->channel, step->value);
+            event->stepIndex++;
+        } while ((kStatus_Success == status) && (event->stepIndex < event->stepCount) &&
+                 (event->steps[event->stepIndex].delay == 0U));
+
+        if ((kStatus_Success == status) && (event->stepIndex < event->stepCount))
+        {
+            event->period += event->steps[event->stepIndex].delay;
+            APP_SCHED_Insert(sched, event);
+            return;
+        }
+    }
+
+    if (event->callback != NULL)
+    {
+        event->callback(event, status, event->userData);
+    }
+}
+
+/*
+ * Tick timer flag, once per period: dispatches the slot of the new period. Events of a later
+ * wheel turn are put back at the tail, which keeps the posting order of each period. The tick has
+ * no fixed phase in the PWM period, the engine writes each staged channel at its own period start.
+ */
+APP_HOT_CODE static void APP_SCHED_HandleIRQ(void *base, void *handle)
+{
+    app_sched_t *sched = (app_sched_t *)handle;
+    uint32_t period    = sched->period + 1U;
+    list_handle_t slot = &sched->wheel[period & (APP_SCHED_WHEEL_SLOTS - 1U)];
+    uint32_t count     = LIST_GetSize(slot);
+    app_sched_event_t *event;
+
+    FLEXIO_ClearTimerStatusFlags((FLEXIO_Type *)base, sched->timerMask);
+
+    sched->period = period;
+    sched->update = false;
+
+    while (count-- != 0U)
+    {
+        event = (app_sched_event_t *)(void *)LIST_RemoveHead(slot);
+        if ((int32_t)(event->period - period) > 0)
+        {
+            (void)LIST_AddTail(slot, &event->link);
+        }
+        else
+        {
+            APP_SCHED_Dispatch(sched, event);
+        }
+    }
+
+    if (sched->update)
+    {
+        FLEXIO_CPWM_Update(sched->cpwm);
+    }
+}
+
+/*!
+ * brief Gets the default configuration: FlexIO timer 7.
+ *
+ * param config Pointer to the configuration structure.
+ */
+void APP_SCHED_GetDefaultConfig(app_sched_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->tickTimer = 7U;
+}
+
+/*!
+ * brief Starts counting the periods of an engine, from 0.
+ *
+ * param handle Running engine handle.
+ * param config Scheduler configuration.
+ * retval kStatus_Success Counting started.
+ * retval kStatus_InvalidArgument The timer is out of range or used by the engine.
+ * retval kStatus_Busy The tick timer flag is owned by another FlexIO handler.
+ */
+status_t APP_SCHED_Init(flexio_cpwm_handle_t *handle, const app_sched_config_t *config)
+{
+    assert(handle != NULL);
+    assert(config != NULL);
+
+    FLEXIO_Type *base = handle->base;
+    uint8_t timer     = config->tickTimer;
+    uint32_t i;
+
+    if ((timer >= FLEXIO_TIMCTL_COUNT) || (timer == handle->periodTimer) || (timer == handle->burstTimer))
+    {
+        return kStatus_InvalidArgument;
+    }
+    for (i = 0U; i < handle->channelCount; i++)
+    {
+        if (timer == handle->channel[i].timer)
+        {
+            return kStatus_InvalidArgument;
+        }
+    }
+
+    APP_SCHED_Deinit();
+
+    (void)memset(&s_sched, 0, sizeof(s_sched));
+    s_sched.cpwm      = handle;
+    s_sched.timerMask = 1UL << timer;
+    for (i = 0U; i < APP_SCHED_WHEEL_SLOTS; i++)
+    {
+        LIST_Init(&s_sched.wheel[i], 0U);
+    }
+
+    if (kStatus_Success !=
+        FLEXIO_RegisterFlagHandlerIRQ(base, 0U, s_sched.timerMask, &s_sched, APP_SCHED_HandleIRQ))
+    {
+        s_sched.cpwm = NULL;
+        return kStatus_Busy;
+    }
+
+    /* Tick timer: decrements on both period timer edges and reloads on compare, once per period. */
+    base->TIMCTL[timer] = 0U;
+    base->TIMCMP[timer] = 1U;
+    base->TIMCFG[timer] = FLEXIO_TIMCFG_TIMOUT(kFLEXIO_TimerOutputOneNotAffectedByReset) |
+                          FLEXIO_TIMCFG_TIMDEC(kFLEXIO_TimerDecSrcOnTriggerInputShiftTimerOutput) |
+                          FLEXIO_TIMCFG_TIMRST(kFLEXIO_TimerResetNever) |
+                          FLEXIO_TIMCFG_TIMDIS(kFLEXIO_TimerDisableNever) |
+                          FLEXIO_TIMCFG_TIMENA(kFLEXIO_TimerEnabledAlways);
+    FLEXIO_ClearTimerStatusFlags(base, s_sched.timerMask);
+    FLEXIO_EnableTimerStatusInterrupts(base, s_sched.timerMask);
+    base->TIMCTL[timer] = FLEXIO_TIMCTL_TRGSEL(FLEXIO_TIMER_TRIGGER_SEL_TIMn(handle->periodTimer)) |
+                          FLEXIO_TIMCTL_TRGPOL(kFLEXIO_TimerTriggerPolarityActiveHigh) |
+                          FLEXIO_TIMCTL_TRGSRC(kFLEXIO_TimerTriggerSourceInternal) |
+                          FLEXIO_TIMCTL_PINCFG(kFLEXIO_PinConfigOutputDisabled) |
+                          FLEXIO_TIMCTL_TIMOD(kFLEXIO_TimerModeSingle16Bit);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops counting, the pending events are dropped without callback.
+ */
+void APP_SCHED_Deinit(void)
+{
+    flexio_cpwm_handle_t *cpwm = s_sched.cpwm;
+    uint32_t timer;
+    uint32_t i;
+
+    if (cpwm == NULL)
+    {
+        return;
+    }
+
+    timer = 31U - __CLZ(s_sched.timerMask);
+    FLEXIO_DisableTimerStatusInterrupts(cpwm->base, s_sched.timerMask);
+    cpwm->base->TIMCTL[timer] = 0U;
+    FLEXIO_ClearTimerStatusFlags(cpwm->base, s_sched.timerMask);
+    (void)FLEXIO_UnregisterFlagHandlerIRQ(cpwm->base, &s_sched);
+    s_sched.cpwm = NULL;
+
+    /* Leave the events orphan, they can be posted again. */
+    for (i = 0U; i < APP_SCHED_WHEEL_SLOTS; i++)
+    {
+        while (NULL != LIST_RemoveHead(&s_sched.wheel[i]))
+        {
+        }
+    }
+}
+
+/*!
+ * brief Gets the current period, the last one dispatched.
+ *
+ * return Periods counted since APP_SCHED_Init(), wraps around.
+ */
+uint32_t APP_SCHED_GetPeriod(void)
+{
+    return s_sched.period;
+}
+
+/* Links a filled event, the current period cannot move between the check and the insertion. */
+static status_t APP_SCHED_Schedule(app_sched_event_t *event, uint32_t period)
+{
+    uint32_t primask;
+
+    if (s_sched.cpwm == NULL)
+    {
+        return kStatus_Fail;
+    }
+
+    primask = DisableGlobalIRQ();
+
+    if (NULL != LIST_GetList(&event->link))
+    {
+        EnableGlobalIRQ(primask);
+        return kStatus_Busy;
+    }
+
+    if ((int32_t)(period - s_sched.period) <= 0)
+    {
+        period = s_sched.period + 1U;
+    }
+    event->period = period;
+    APP_SCHED_Insert(&s_sched, event);
+
+    EnableGlobalIRQ(primask);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Schedules a single action.
+ *
+ * param event  Event, not pending.
+ * param period Period to dispatch the event at, less than 2^31 periods ahead.
+ * retval kStatus_Success The event is pending.
+ * retval kStatus_InvalidArgument The action is out of range.
+ * retval kStatus_Busy The event is already pending.
+ * retval kStatus_Fail The scheduler is not running.
+ */
+status_t APP_SCHED_Post(app_sched_event_t *event, uint32_t period)
+{
+    assert(event != NULL);
+
+    if (event->action >= (uint8_t)kAPP_SchedProfile)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    return APP_SCHED_Schedule(event, period);
+}
+
+/*!
+ * brief Schedules a profile, played by the event.
+ *
+ * param event     Event, not pending. callback and userData are used.
+ * param steps     Step table, must stay valid until the profile completes.
+ * param stepCount Number of steps, not 0.
+ * param period    Start period.
+ * retval kStatus_Success The profile is pending.
+ * retval kStatus_InvalidArgument No step.
+ * retval kStatus_Busy The event is already pending.
+ * retval kStatus_Fail The scheduler is not running.
+ */
+status_t APP_SCHED_PostProfile(app_sched_event_t *event,
+                               const app_sched_step_t *steps,
+                               uint32_t stepCount,
+                               uint32_t period)
+{
+    assert(event != NULL);
+
+    if ((steps == NULL) || (stepCount == 0U))
+    {
+        return kStatus_InvalidArgument;
+    }
+    if (NULL != LIST_GetList(&event->link))
+    {
+        return kStatus_Busy;
+    }
+
+    event->action    = (uint8_t)kAPP_SchedProfile;
+    event->steps     = steps;
+    event->stepCount = stepCount;
+    event->stepIndex = 0U;
+
+    return APP_SCHED_Schedule(event, period + steps[0].delay);
+}
+
+/*!
+ * brief Removes a pending event, without callback.
+ *
+ * param event Event.
+ * retval true The event was pending and will not be dispatched.
+ * retval false The event was not pending, it may have been dispatched.
+ */
+bool APP_SCHED_Cancel(app_sched_event_t *event)
+{
+    assert(event != NULL);
+
+    return (kLIST_Ok == LIST_RemoveElement(&event->link));
+}
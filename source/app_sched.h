@@ -0,0 +1,208 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_SCHED_H_
+#define APP_SCHED_H_
+
+#include "fsl_common.h"
+#include "fsl_component_generic_list.h"
+#include "flexio_cpwm.h"
+
+/*!
+ * @addtogroup app_sched
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Waveform changes scheduled by PWM period count.
+ *
+ * A spare FlexIO timer counts the period timer edges and raises its flag once per PWM period. Its
+ * interrupt advances the period count and dispatches the events due. The tick starts at either
+ * period timer edge, so a dispatch can fall anywhere in the PWM period: the staged duties go
+ * through FLEXIO_CPWM_Update() and each channel takes them from its first period start after the
+ * dispatch, never in mid period. The changes of consecutive periods land on consecutive periods.
+ * kAPP_SchedMode goes the same way, parking is a 0% or 100% duty. Ramps do not disturb the count,
+ * their eDMA acknowledges the period timer flag, not this one.
+ *
+ * Limitation: kAPP_SchedFrequency and kAPP_SchedBurst are not tied to a period start. They are
+ * applied at the tick, wherever it falls in the PWM period: FLEXIO_CPWM_SetFrequency() writes the
+ * channel compares at once and the new period timer compare at its next edge, and
+ * FLEXIO_CPWM_StartBurst()/FLEXIO_CPWM_StopBurst() stop and restart the period timer at once. The
+ * period they are applied in can be cut short or stretched; post them where one such period is
+ * acceptable, e.g. with the outputs parked.
+ *
+ * Pending events sit in a timer wheel of APP_SCHED_WHEEL_SLOTS generic lists, the slot of an event
+ * is its period modulo the wheel size. Posting appends to a slot and each period scans one slot,
+ * both O(1) while events are less than a wheel turn ahead; farther events stay in their slot and
+ * are skipped until their turn. Events are owned by the caller and linked in place, nothing is
+ * allocated.
+ *
+ * A profile is a table of steps played by one event, which moves itself to the slot of the next
+ * step as it goes: thousands of steps cost one slot entry at a time.
+ *
+ * The count stops with the period timer, e.g. when a burst has completed and parked the outputs,
+ * until FLEXIO_CPWM_StopBurst() restarts it.
+ */
+
+/*! @brief Slots of the timer wheel, a power of two: the periods an event can be ahead at O(1). */
+#ifndef APP_SCHED_WHEEL_SLOTS
+#define APP_SCHED_WHEEL_SLOTS (64U)
+#endif
+
+/*! @brief Scheduled actions. */
+typedef enum _app_sched_action
+{
+    kAPP_SchedDutyTicks = 0U, /*!< value: on-time in FlexIO clocks, [0, period]. */
+    kAPP_SchedFrequency = 1U, /*!< value: PWM frequency in Hz, channel unused. Applied at the tick. */
+    kAPP_SchedMode      = 2U, /*!< value: app_sched_mode_t of the channel. */
+    kAPP_SchedBurst     = 3U, /*!< value: pulses, 0 stops the burst; channel: idle high mask. Applied at the tick. */
+    kAPP_SchedProfile   = 4U, /*!< Set by APP_SCHED_PostProfile(). */
+} app_sched_action_t;
+
+/*! @brief Channel modes. */
+typedef enum _app_sched_mode
+{
+    kAPP_SchedModeRun      = 0U, /*!< Toggling with its duty. */
+    kAPP_SchedModeParkLow  = 1U, /*!< Static low, the duty is kept for kAPP_SchedModeRun. */
+    kAPP_SchedModeParkHigh = 2U, /*!< Static high, the duty is kept for kAPP_SchedModeRun. */
+} app_sched_mode_t;
+
+/*! @brief One step of a profile. */
+typedef struct _app_sched_step
+{
+    uint16_t delay;  /*!< Periods after the previous step, after the start period for the first one. */
+    uint8_t action;  /*!< app_sched_action_t, not kAPP_SchedProfile. */
+    uint8_t channel; /*!< Engine channel, or idle mask of a burst. */
+    uint32_t value;  /*!< Action parameter. */
+} app_sched_step_t;
+
+/* Forward declaration of the event type */
+typedef struct _app_sched_event app_sched_event_t;
+
+/*!
+ * @brief Reports a dispatched event, from the FlexIO interrupt.
+ *
+ * A profile reports once, after its last step or at the first step which failed. The event is
+ * free again and may be posted from the callback.
+ */
+typedef void (*app_sched_callback_t)(app_sched_event_t *event, status_t status, void *userData);
+
+/*! @brief Scheduled event, zero it before its first use. */
+struct _app_sched_event
+{
+    list_element_t link;           /*!< Wheel link, owned by the scheduler. */
+    uint32_t period;               /*!< Period at which the event is dispatched, set by the post functions. */
+    uint8_t action;                /*!< app_sched_action_t. */
+    uint8_t channel;               /*!< Engine channel, or idle mask of a burst. */
+    uint32_t value;                /*!< Action parameter. */
+    const app_sched_step_t *steps; /*!< Profile steps. */
+    uint32_t stepCount;            /*!< Number of profile steps. */
+    uint32_t stepIndex;            /*!< Next profile step. */
+    app_sched_callback_t callback; /*!< Dispatch callback, NULL if not needed. */
+    void *userData;                /*!< Callback parameter. */
+};
+
+/*! @brief Scheduler configuration. */
+typedef struct _app_sched_config
+{
+    uint8_t tickTimer; /*!< Spare FlexIO timer of the engine instance counting the periods. */
+} app_sched_config_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Gets the default configuration: FlexIO timer 7.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void APP_SCHED_GetDefaultConfig(app_sched_config_t *config);
+
+/*!
+ * @brief Starts counting the periods of an engine, from 0.
+ *
+ * The tick interrupt runs once per PWM period until APP_SCHED_Deinit().
+ *
+ * @param handle Running engine handle.
+ * @param config Scheduler configuration.
+ * @retval kStatus_Success Counting started.
+ * @retval kStatus_InvalidArgument The timer is out of range or used by the engine.
+ * @retval kStatus_Busy The tick timer flag is owned by another FlexIO handler.
+ */
+status_t APP_SCHED_Init(flexio_cpwm_handle_t *handle, const app_sched_config_t *config);
+
+/*!
+ * @brief Stops counting, the pending events are dropped without callback.
+ */
+void APP_SCHED_Deinit(void);
+
+/*!
+ * @brief Gets the current period, the last one dispatched.
+ *
+ * @return Periods counted since APP_SCHED_Init(), wraps around.
+ */
+uint32_t APP_SCHED_GetPeriod(void);
+
+/*!
+ * @brief Schedules a single action.
+ *
+ * Fill action, channel, value, callback and userData of the event first. A period which is not
+ * ahead of the current one is taken as the next period.
+ *
+ * @param event  Event, not pending.
+ * @param period Period to dispatch the event at, less than 2^31 periods ahead.
+ * @retval kStatus_Success The event is pending.
+ * @retval kStatus_InvalidArgument The action is out of range.
+ * @retval kStatus_Busy The event is already pending.
+ * @retval kStatus_Fail The scheduler is not running.
+ */
+status_t APP_SCHED_Post(app_sched_event_t *event, uint32_t period);
+
+/*!
+ * @brief Schedules a profile, played by the event.
+ *
+ * The first step is dispatched at period + steps[0].delay, each following one delay periods after
+ * the previous one. Steps with a delay of 0 are applied in the same period as the previous one.
+ *
+ * @param event     Event, not pending. callback and userData are used.
+ * @param steps     Step table, must stay valid until the profile completes.
+ * @param stepCount Number of steps, not 0.
+ * @param period    Start period.
+ * @retval kStatus_Success The profile is pending.
+ * @retval kStatus_InvalidArgument No step.
+ * @retval kStatus_Busy The event is already pending.
+ * @retval kStatus_Fail The scheduler is not running.
+ */
+status_t APP_SCHED_PostProfile(app_sched_event_t *event,
+                               const app_sched_step_t *steps,
+                               uint32_t stepCount,
+                               uint32_t period);
+
+/*!
+ * @brief Removes a pending event, without callback.
+ *
+ * @param event Event.
+ * @retval true The event was pending and will not be dispatched.
+ * @retval false The event was not pending, it may have been dispatched.
+ */
+bool APP_SCHED_Cancel(app_sched_event_t *event);
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_SCHED_H_ */
@@ -0,0 +1,687 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "app_telemetry.h"
+#include "app_edma.h"
+#include "app_placement.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#if ((APP_TELEMETRY_SAMPLE_RING & (APP_TELEMETRY_SAMPLE_RING - 1U)) != 0U)
+#error "APP_TELEMETRY_SAMPLE_RING must be a power of two."
+#endif
+
+/* Type, sequence and CRC around every body. */
+#define APP_TELEMETRY_FRAME_OVERHEAD (4U)
+
+/* Duty body before the samples. */
+#define APP_TELEMETRY_DUTY_HEADER (8U)
+
+#if ((APP_TELEMETRY_FRAME_OVERHEAD + APP_TELEMETRY_DUTY_HEADER + \
+      (APP_TELEMETRY_DUTY_BATCH * FLEXIO_CPWM_MAX_CHANNELS * 2U)) > APP_TELEMETRY_MAX_PAYLOAD)
+#error "APP_TELEMETRY_DUTY_BATCH does not fit a frame."
+#endif
+
+/* Largest encoded frame: one COBS overhead byte and the delimiter. */
+#define APP_TELEMETRY_MAX_ENCODED (APP_TELEMETRY_MAX_PAYLOAD + 2U)
+
+#if (APP_TELEMETRY_TX_BUFFER_SIZE < APP_TELEMETRY_MAX_ENCODED)
+#error "APP_TELEMETRY_TX_BUFFER_SIZE cannot hold a frame."
+#endif
+
+/* One sample, written by the sample interrupt. */
+typedef struct _app_telemetry_sample
+{
+    uint32_t index;
+    uint16_t halfTicks[FLEXIO_CPWM_MAX_CHANNELS];
+} app_telemetry_sample_t;
+
+/* Cycle statistics, reset at every timing frame. */
+typedef struct _app_telemetry_stats
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+} app_telemetry_stats_t;
+
+/* Sample side, touched by the sample interrupt. head is written by the interrupt, tail by Poll. */
+typedef struct _app_telemetry_sampler
+{
+    flexio_cpwm_handle_t *cpwm;
+    uint32_t timerMask;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint32_t index;
+    uint32_t lastCycles;
+    uint32_t lateCycles;
+    volatile uint32_t faults;
+    uint32_t dropCount;
+    uint32_t lateCount;
+    app_telemetry_stats_t interval;
+    app_telemetry_stats_t handler;
+    app_telemetry_sample_t ring[APP_TELEMETRY_SAMPLE_RING];
+} app_telemetry_sampler_t;
+
+/* Transmit side, thread level only. */
+typedef struct _app_telemetry_tx
+{
+    LPUART_Type *uart;
+    uint8_t dmaChannel;
+    bool dmaActive;
+    uint8_t fill;
+    uint8_t sequence;
+    uint16_t divider;
+    uint32_t length[2];
+    uint32_t frameDrops;
+    uint32_t dmaErrors;
+    uint32_t nextStatusIndex;
+    uint32_t lastPollCycles;
+    uint32_t lateSrcClock_Hz;
+    uint32_t latePeriodTicks;
+    app_telemetry_stats_t poll;
+    uint8_t payload[APP_TELEMETRY_MAX_PAYLOAD];
+    uint8_t buffer[2][APP_TELEMETRY_TX_BUFFER_SIZE];
+} app_telemetry_tx_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void APP_TELEMETRY_HandleIRQ(void *base, void *handle);
+static void APP_TELEMETRY_StatsAdd(app_telemetry_stats_t *stats, uint32_t cycles);
+static uint8_t *APP_TELEMETRY_Put16(uint8_t *dst, uint32_t value);
+static uint8_t *APP_TELEMETRY_Put32(uint8_t *dst, uint32_t value);
+static uint8_t *APP_TELEMETRY_PutStats(uint8_t *dst, const app_telemetry_stats_t *stats);
+static uint16_t APP_TELEMETRY_Crc16(const uint8_t *data, uint32_t size);
+static bool APP_TELEMETRY_SendFrame(app_telemetry_frame_type_t type, uint32_t bodySize);
+static bool APP_TELEMETRY_SendDuty(void);
+static void APP_TELEMETRY_SendStatus(bool periodic);
+static void APP_TELEMETRY_UpdateLateLimit(void);
+static void APP_TELEMETRY_ServiceDma(void);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Written from the FlexIO interrupt, kept in SRAMH with the engine handle. */
+APP_HOT_BSS static app_telemetry_sampler_t s_telemetrySampler;
+
+static app_telemetry_tx_t s_telemetryTx;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+APP_HOT_CODE static void APP_TELEMETRY_StatsAdd(app_telemetry_stats_t *stats, uint32_t cycles)
+{
+    if ((stats->count == 0U) || (cycles < stats->min))
+    {
+        stats->min = cycles;
+    }
+    if (cycles > stats->max)
+    {
+        stats->max = cycles;
+    }
+    stats->sum += cycles;
+    stats->count++;
+}
+
+/*
+ * Sample timer flag: reads the compare of every channel back, the eDMA ramps write them behind
+ * the engine state.
+ */
+APP_HOT_CODE static void APP_TELEMETRY_HandleIRQ(void *base, void *handle)
+{
+    app_telemetry_sampler_t *sampler = (app_telemetry_sampler_t *)handle;
+    FLEXIO_Type *flexioBase          = (FLEXIO_Type *)base;
+    flexio_cpwm_handle_t *cpwm       = sampler->cpwm;
+    uint32_t now                     = DWT->CYCCNT;
+    uint32_t halfPeriod              = cpwm->periodTicks / 2U;
+    uint32_t head                    = sampler->head;
+    app_telemetry_sample_t *sample;
+    uint32_t interval;
+    uint32_t timctl;
+    uint32_t half;
+    uint8_t i;
+
+    FLEXIO_ClearTimerStatusFlags(flexioBase, sampler->timerMask);
+
+    interval = now - sampler->lastCycles;
+    if (sampler->index != 0U)
+    {
+        APP_TELEMETRY_StatsAdd(&sampler->interval, interval);
+        if ((sampler->lateCycles != 0U) && (interval > sampler->lateCycles))
+        {
+            sampler->lateCount++;
+            sampler->faults |= (uint32_t)kAPP_TelemetryFaultSampleLate;
+        }
+    }
+    sampler->lastCycles = now;
+
+    if ((head - sampler->tail) >= APP_TELEMETRY_SAMPLE_RING)
+    {
+        sampler->dropCount++;
+        sampler->faults |= (uint32_t)kAPP_TelemetryFaultSampleOverflow;
+    }
+    else
+    {
+        sample        = &sampler->ring[head & (APP_TELEMETRY_SAMPLE_RING - 1U)];
+        sample->index = sampler->index;
+        for (i = 0U; i < cpwm->channelCount; i++)
+        {
+            timctl = flexioBase->TIMCTL[cpwm->channel[i].timer];
+            if (0U == (timctl & FLEXIO_TIMCTL_TIMOD_MASK))
+            {
+                /* Static level, the pin polarity selects high. */
+                half = (0U != (timctl & FLEXIO_TIMCTL_PINPOL_MASK)) ? APP_TELEMETRY_DUTY_HIGH : 0U;
+            }
+            else
+            {
+                /* onTicks = periodTicks - 2 * (TIMCMP + 1), see flexio_cpwm.h. */
+                half = halfPeriod - ((flexioBase->TIMCMP[cpwm->channel[i].timer] & FLEXIO_TIMCMP_CMP_MASK) + 1U);
+                if (half >= APP_TELEMETRY_DUTY_HIGH)
+                {
+                    half = APP_TELEMETRY_DUTY_HIGH - 1U;
+                }
+            }
+            sample->halfTicks[i] = (uint16_t)half;
+        }
+        __DMB();
+        sampler->head = head + 1U;
+    }
+    sampler->index++;
+
+    APP_TELEMETRY_StatsAdd(&sampler->handler, DWT->CYCCNT - now);
+}
+
+/*!
+ * brief Gets the default configuration: eDMA channel 13, FlexIO timer 6, default divider and rate.
+ *
+ * param config Pointer to the configuration structure.
+ */
+void APP_TELEMETRY_GetDefaultConfig(app_telemetry_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->baudRate_Bps = APP_TELEMETRY_DEFAULT_BAUDRATE;
+    config->dmaChannel   = 13U;
+    config->sampleTimer  = 6U;
+    config->divider      = APP_TELEMETRY_DEFAULT_DIVIDER;
+}
+
+/*!
+ * brief Takes over the LPUART and starts sampling the engine.
+ *
+ * param handle Running engine handle.
+ * param config Telemetry configuration.
+ * retval kStatus_Success Sampling started.
+ * retval kStatus_InvalidArgument The divider or the timer is out of range.
+ * retval kStatus_Busy The sample timer flag is owned by another FlexIO handler.
+ * retval kStatus_LPUART_BaudrateNotSupport The line rate cannot be produced from the LPUART clock.
+ */
+status_t APP_TELEMETRY_Init(flexio_cpwm_handle_t *handle, const app_telemetry_config_t *config)
+{
+    assert(handle != NULL);
+    assert(config != NULL);
+    assert(config->uart != NULL);
+
+    FLEXIO_Type *base = handle->base;
+    uint8_t timer     = config->sampleTimer;
+    lpuart_config_t uartConfig;
+    status_t status;
+
+    if ((config->divider == 0U) || ((2UL * config->divider) > (FLEXIO_TIMCMP_CMP_MASK + 1U)) ||
+        (timer >= FLEXIO_TIMCTL_COUNT) || (timer == handle->periodTimer) || (timer == handle->burstTimer))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    APP_TELEMETRY_Deinit();
+
+    LPUART_GetDefaultConfig(&uartConfig);
+    uartConfig.baudRate_Bps = config->baudRate_Bps;
+    uartConfig.enableTx     = true;
+    uartConfig.enableRx     = false;
+    status                  = LPUART_Init(config->uart, &uartConfig, config->uartClock_Hz);
+    if (kStatus_Success != status)
+    {
+        return status;
+    }
+    LPUART_EnableTxDMA(config->uart, true);
+
+    APP_EDMA_Init();
+    APP_EDMA_ResetChannel(config->dmaChannel, config->dmaRequest);
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    (void)memset(&s_telemetryTx, 0, sizeof(s_telemetryTx));
+    s_telemetryTx.uart            = config->uart;
+    s_telemetryTx.dmaChannel      = config->dmaChannel;
+    s_telemetryTx.divider         = config->divider;
+    s_telemetryTx.lastPollCycles  = DWT->CYCCNT;
+    s_telemetryTx.nextStatusIndex = 0U;
+    /* A leading delimiter, the host drops whatever it received before as one bad frame. */
+    s_telemetryTx.buffer[0][0] = 0U;
+    s_telemetryTx.length[0]    = 1U;
+
+    (void)memset(&s_telemetrySampler, 0, sizeof(s_telemetrySampler));
+    s_telemetrySampler.cpwm      = handle;
+    s_telemetrySampler.timerMask = 1UL << timer;
+    APP_TELEMETRY_UpdateLateLimit();
+
+    if (kStatus_Success != FLEXIO_RegisterFlagHandlerIRQ(base, 0U, s_telemetrySampler.timerMask,
+                                                         &s_telemetrySampler, APP_TELEMETRY_HandleIRQ))
+    {
+        s_telemetrySampler.cpwm = NULL;
+        return kStatus_Busy;
+    }
+
+    /*
+     * Sample timer: decrements on both period timer edges and reloads on compare, its flag is set
+     * every 2 * divider edges, i.e. every divider PWM periods.
+     */
+    base->TIMCTL[timer] = 0U;
+    base->TIMCMP[timer] = (2UL * config->divider) - 1U;
+    base->TIMCFG[timer] = FLEXIO_TIMCFG_TIMOUT(kFLEXIO_TimerOutputOneNotAffectedByReset) |
+                          FLEXIO_TIMCFG_TIMDEC(kFLEXIO_TimerDecSrcOnTriggerInputShiftTimerOutput) |
+                          FLEXIO_TIMCFG_TIMRST(kFLEXIO_TimerResetNever) |
+                          FLEXIO_TIMCFG_TIMDIS(kFLEXIO_TimerDisableNever) |
+                          FLEXIO_TIMCFG_TIMENA(kFLEXIO_TimerEnabledAlways);
+    FLEXIO_ClearTimerStatusFlags(base, s_telemetrySampler.timerMask);
+    FLEXIO_EnableTimerStatusInterrupts(base, s_telemetrySampler.timerMask);
+    base->TIMCTL[timer] = FLEXIO_TIMCTL_TRGSEL(FLEXIO_TIMER_TRIGGER_SEL_TIMn(handle->periodTimer)) |
+                          FLEXIO_TIMCTL_TRGPOL(kFLEXIO_TimerTriggerPolarityActiveHigh) |
+                          FLEXIO_TIMCTL_TRGSRC(kFLEXIO_TimerTriggerSourceInternal) |
+                          FLEXIO_TIMCTL_PINCFG(kFLEXIO_PinConfigOutputDisabled) |
+                          FLEXIO_TIMCTL_TIMOD(kFLEXIO_TimerModeSingle16Bit);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops sampling and the eDMA, the frames not yet sent are lost.
+ */
+void APP_TELEMETRY_Deinit(void)
+{
+    flexio_cpwm_handle_t *cpwm = s_telemetrySampler.cpwm;
+    uint32_t timer;
+
+    if (cpwm == NULL)
+    {
+        return;
+    }
+
+    timer = 31U - __CLZ(s_telemetrySampler.timerMask);
+    FLEXIO_DisableTimerStatusInterrupts(cpwm->base, s_telemetrySampler.timerMask);
+    cpwm->base->TIMCTL[timer] = 0U;
+    FLEXIO_ClearTimerStatusFlags(cpwm->base, s_telemetrySampler.timerMask);
+    (void)FLEXIO_UnregisterFlagHandlerIRQ(cpwm->base, &s_telemetrySampler);
+    s_telemetrySampler.cpwm = NULL;
+
+    APP_EDMA_StopChannel(s_telemetryTx.dmaChannel);
+    LPUART_EnableTxDMA(s_telemetryTx.uart, false);
+    s_telemetryTx.dmaActive = false;
+}
+
+/*!
+ * brief Latches application fault flags, sent with the next fault frame.
+ *
+ * param faults Fault bits, the application may use the bits above kAPP_TelemetryFaultDmaError.
+ */
+void APP_TELEMETRY_ReportFault(uint32_t faults)
+{
+    uint32_t regPrimask = DisableGlobalIRQ();
+
+    s_telemetrySampler.faults |= faults;
+
+    EnableGlobalIRQ(regPrimask);
+}
+
+static uint8_t *APP_TELEMETRY_Put16(uint8_t *dst, uint32_t value)
+{
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8U);
+
+    return &dst[2];
+}
+
+static uint8_t *APP_TELEMETRY_Put32(uint8_t *dst, uint32_t value)
+{
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8U);
+    dst[2] = (uint8_t)(value >> 16U);
+    dst[3] = (uint8_t)(value >> 24U);
+
+    return &dst[4];
+}
+
+/* min, mean, max. */
+static uint8_t *APP_TELEMETRY_PutStats(uint8_t *dst, const app_telemetry_stats_t *stats)
+{
+    dst = APP_TELEMETRY_Put32(dst, stats->min);
+    dst = APP_TELEMETRY_Put32(dst, (stats->count != 0U) ? (uint32_t)(stats->sum / stats->count) : 0U);
+
+    return APP_TELEMETRY_Put32(dst, stats->max);
+}
+
+/* CRC-16/CCITT-FALSE, a byte at a time without table. */
+static uint16_t APP_TELEMETRY_Crc16(const uint8_t *data, uint32_t size)
+{
+    uint32_t crc = 0xFFFFU;
+    uint32_t x;
+
+    while (size-- != 0U)
+    {
+        x = ((crc >> 8U) ^ *data++) & 0xFFU;
+        x ^= x >> 4U;
+        crc = ((crc << 8U) ^ (x << 12U) ^ (x << 5U) ^ x) & 0xFFFFU;
+    }
+
+    return (uint16_t)crc;
+}
+
+/*
+ * Completes the payload built in s_telemetryTx.payload after the type and sequence bytes, and
+ * appends its COBS encoding to the buffer being filled. Returns false if the buffer is full.
+ */
+static bool APP_TELEMETRY_SendFrame(app_telemetry_frame_type_t type, uint32_t bodySize)
+{
+    app_telemetry_tx_t *tx = &s_telemetryTx;
+    uint32_t size          = 2U + bodySize;
+    uint8_t *dst           = &tx->buffer[tx->fill][tx->length[tx->fill]];
+    uint8_t *code;
+    uint32_t i;
+
+    tx->payload[0] = (uint8_t)type;
+    tx->payload[1] = tx->sequence++;
+    (void)APP_TELEMETRY_Put16(&tx->payload[size], APP_TELEMETRY_Crc16(tx->payload, size));
+    size += 2U;
+
+    if ((APP_TELEMETRY_TX_BUFFER_SIZE - tx->length[tx->fill]) < (size + 2U))
+    {
+        return false;
+    }
+
+    /* COBS: every zero becomes the distance to the next one, the payload is never over 254 bytes. */
+    code  = dst++;
+    *code = 1U;
+    for (i = 0U; i < size; i++)
+    {
+        if (tx->payload[i] == 0U)
+        {
+            code  = dst++;
+            *code = 1U;
+        }
+        else
+        {
+            *dst++ = tx->payload[i];
+            (*code)++;
+        }
+    }
+    *dst++ = 0U;
+
+    tx->length[tx->fill] = (uint32_t)(dst - &tx->buffer[tx->fill][0]);
+
+    return true;
+}
+
+/* Packs up to APP_TELEMETRY_DUTY_BATCH consecutive samples, false if none is queued or no room. */
+static bool APP_TELEMETRY_SendDuty(void)
+{
+    app_telemetry_sampler_t *sampler = &s_telemetrySampler;
+    uint32_t tail                    = sampler->tail;
+    uint32_t count                   = sampler->head - tail;
+    uint8_t channels                 = sampler->cpwm->channelCount;
+    const app_telemetry_sample_t *first;
+    const app_telemetry_sample_t *sample;
+    uint8_t *dst;
+    uint32_t n;
+    uint8_t i;
+
+    if (count < APP_TELEMETRY_DUTY_BATCH)
+    {
+        return false;
+    }
+    /* The samples up to head are complete. */
+    __DMB();
+
+    first = &sampler->ring[tail & (APP_TELEMETRY_SAMPLE_RING - 1U)];
+    dst   = &s_telemetryTx.payload[2U + APP_TELEMETRY_DUTY_HEADER];
+    for (n = 0U; n < APP_TELEMETRY_DUTY_BATCH; n++)
+    {
+        sample = &sampler->ring[(tail + n) & (APP_TELEMETRY_SAMPLE_RING - 1U)];
+        /* A dropped sample ends the frame, the next one starts at the new index. */
+        if (sample->index != (first->index + n))
+        {
+            break;
+        }
+        for (i = 0U; i < channels; i++)
+        {
+            dst = APP_TELEMETRY_Put16(dst, sample->halfTicks[i]);
+        }
+    }
+
+    dst = APP_TELEMETRY_Put32(&s_telemetryTx.payload[2], first->index);
+    dst[0] = channels;
+    dst[1] = (uint8_t)n;
+    (void)APP_TELEMETRY_Put16(&dst[2], s_telemetryTx.divider);
+
+    if (!APP_TELEMETRY_SendFrame(kAPP_TelemetryFrameDuty, APP_TELEMETRY_DUTY_HEADER + (n * channels * 2U)))
+    {
+        /* Left in the ring, it fills up and the sample interrupt counts the loss. */
+        s_telemetryTx.sequence--;
+        return false;
+    }
+
+    __DMB();
+    sampler->tail = tail + n;
+
+    return true;
+}
+
+/* State and timing frames every APP_TELEMETRY_STATUS_SAMPLES samples, fault frames when latched. */
+static void APP_TELEMETRY_SendStatus(bool periodic)
+{
+    app_telemetry_sampler_t *sampler = &s_telemetrySampler;
+    flexio_cpwm_handle_t *cpwm       = sampler->cpwm;
+    app_telemetry_stats_t interval;
+    app_telemetry_stats_t handler;
+    uint32_t regPrimask;
+    uint32_t faults;
+    uint32_t index;
+    uint32_t staged;
+    uint8_t flags;
+    uint8_t *dst;
+    uint8_t i;
+
+    regPrimask = DisableGlobalIRQ();
+    index      = sampler->index;
+    faults     = sampler->faults;
+    sampler->faults = 0U;
+    interval   = sampler->interval;
+    handler    = sampler->handler;
+    if (periodic)
+    {
+        (void)memset(&sampler->interval, 0, sizeof(sampler->interval));
+        (void)memset(&sampler->handler, 0, sizeof(sampler->handler));
+    }
+    EnableGlobalIRQ(regPrimask);
+
+    if (periodic)
+    {
+        flags  = cpwm->rampActive ? (uint8_t)kAPP_TelemetryStateRamp : 0U;
+        flags |= cpwm->burstActive ? (uint8_t)kAPP_TelemetryStateBurst : 0U;
+        flags |= (cpwm->retimeSrcClock_Hz != 0U) ? (uint8_t)kAPP_TelemetryStateClockChange : 0U;
+        staged = cpwm->stagedMask;
+
+        dst    = APP_TELEMETRY_Put32(&s_telemetryTx.payload[2], index);
+        dst    = APP_TELEMETRY_Put32(dst, DWT->CYCCNT);
+        dst    = APP_TELEMETRY_Put32(dst, cpwm->srcClock_Hz);
+        dst    = APP_TELEMETRY_Put32(dst, SystemCoreClock);
+        dst    = APP_TELEMETRY_Put32(dst, cpwm->periodTicks);
+        dst    = APP_TELEMETRY_Put16(dst, s_telemetryTx.divider);
+        *dst++ = cpwm->channelCount;
+        *dst++ = flags;
+        dst    = APP_TELEMETRY_Put32(dst, staged);
+        for (i = 0U; i < cpwm->channelCount; i++)
+        {
+            dst = APP_TELEMETRY_Put32(dst, cpwm->channel[i].onTicks);
+            dst = APP_TELEMETRY_Put32(dst, cpwm->channel[i].stagedOnTicks);
+        }
+        if (!APP_TELEMETRY_SendFrame(kAPP_TelemetryFrameState, (uint32_t)(dst - &s_telemetryTx.payload[2])))
+        {
+            s_telemetryTx.frameDrops++;
+            faults |= (uint32_t)kAPP_TelemetryFaultTxOverflow;
+        }
+
+        dst = APP_TELEMETRY_Put32(&s_telemetryTx.payload[2], index);
+        dst = APP_TELEMETRY_Put32(dst, interval.count);
+        dst = APP_TELEMETRY_PutStats(dst, &interval);
+        dst = APP_TELEMETRY_Put32(dst, (handler.count != 0U) ? (uint32_t)(handler.sum / handler.count) : 0U);
+        dst = APP_TELEMETRY_Put32(dst, handler.max);
+        dst = APP_TELEMETRY_PutStats(dst, &s_telemetryTx.poll);
+        (void)memset(&s_telemetryTx.poll, 0, sizeof(s_telemetryTx.poll));
+        if (!APP_TELEMETRY_SendFrame(kAPP_TelemetryFrameTiming, (uint32_t)(dst - &s_telemetryTx.payload[2])))
+        {
+            s_telemetryTx.frameDrops++;
+            faults |= (uint32_t)kAPP_TelemetryFaultTxOverflow;
+        }
+    }
+
+    if ((faults != 0U) || periodic)
+    {
+        dst = APP_TELEMETRY_Put32(&s_telemetryTx.payload[2], index);
+        dst = APP_TELEMETRY_Put32(dst, faults);
+        dst = APP_TELEMETRY_Put32(dst, sampler->dropCount);
+        dst = APP_TELEMETRY_Put32(dst, s_telemetryTx.frameDrops);
+        dst = APP_TELEMETRY_Put32(dst, sampler->lateCount);
+        dst = APP_TELEMETRY_Put32(dst, s_telemetryTx.dmaErrors);
+        if (!APP_TELEMETRY_SendFrame(kAPP_TelemetryFrameFault, (uint32_t)(dst - &s_telemetryTx.payload[2])))
+        {
+            /* Reported again with the next fault frame. */
+            s_telemetryTx.frameDrops++;
+            APP_TELEMETRY_ReportFault(faults | (uint32_t)kAPP_TelemetryFaultTxOverflow);
+        }
+    }
+}
+
+/* A sample more than half an interval late is a fault, recomputed after FlexIO clock changes. */
+static void APP_TELEMETRY_UpdateLateLimit(void)
+{
+    flexio_cpwm_handle_t *cpwm = s_telemetrySampler.cpwm;
+    uint64_t cycles;
+
+    if ((cpwm->srcClock_Hz == s_telemetryTx.lateSrcClock_Hz) && (cpwm->periodTicks == s_telemetryTx.latePeriodTicks))
+    {
+        return;
+    }
+    s_telemetryTx.lateSrcClock_Hz = cpwm->srcClock_Hz;
+    s_telemetryTx.latePeriodTicks = cpwm->periodTicks;
+
+    cycles = (cpwm->srcClock_Hz != 0U) ? (((uint64_t)s_telemetryTx.divider * cpwm->periodTicks * SystemCoreClock) /
+                                          cpwm->srcClock_Hz) :
+                                         0U;
+    cycles += cycles / 2U;
+    s_telemetrySampler.lateCycles = (cycles > UINT32_MAX) ? 0U : (uint32_t)cycles;
+}
+
+/* Retires the finished transfer and starts the filled buffer. */
+static void APP_TELEMETRY_ServiceDma(void)
+{
+    app_telemetry_tx_t *tx = &s_telemetryTx;
+    uint8_t channel        = tx->dmaChannel;
+    uint8_t sending        = tx->fill ^ 1U;
+
+    if (tx->dmaActive)
+    {
+        if (0U != (APP_EDMA_BASEADDR->CH[channel].CH_ES & DMA_CH_ES_ERR_MASK))
+        {
+            APP_EDMA_StopChannel(channel);
+            APP_EDMA_BASEADDR->CH[channel].CH_ES = DMA_CH_ES_ERR_MASK;
+            tx->dmaErrors++;
+            APP_TELEMETRY_ReportFault((uint32_t)kAPP_TelemetryFaultDmaError);
+        }
+        else if (!APP_EDMA_IsDone(channel))
+        {
+            return;
+        }
+        else
+        {
+            /* Sent. */
+        }
+        tx->dmaActive       = false;
+        tx->length[sending] = 0U;
+    }
+
+    if (tx->length[tx->fill] == 0U)
+    {
+        return;
+    }
+
+    APP_EDMA_BASEADDR->CH[channel].CH_CSR            = DMA_CH_CSR_DONE_MASK;
+    APP_EDMA_BASEADDR->CH[channel].TCD_SADDR         = (uint32_t)&tx->buffer[tx->fill][0];
+    APP_EDMA_BASEADDR->CH[channel].TCD_SOFF          = 1U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_ATTR          = DMA_TCD_ATTR_SSIZE(APP_EDMA_SIZE_1BYTE) |
+                                                       DMA_TCD_ATTR_DSIZE(APP_EDMA_SIZE_1BYTE);
+    APP_EDMA_BASEADDR->CH[channel].TCD_NBYTES_MLOFFNO = 1U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_SLAST_SDA     = 0U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_DADDR         = LPUART_GetDataRegisterAddress(tx->uart);
+    APP_EDMA_BASEADDR->CH[channel].TCD_DOFF          = 0U;
+    APP_EDMA_BASEADDR->CH[channel].TCD_CITER_ELINKNO = (uint16_t)tx->length[tx->fill];
+    APP_EDMA_BASEADDR->CH[channel].TCD_BITER_ELINKNO = (uint16_t)tx->length[tx->fill];
+    APP_EDMA_BASEADDR->CH[channel].TCD_DLAST_SGA     = 0U;
+    /* The request is dropped at the end of the major loop, DONE tells the buffer is free. */
+    APP_EDMA_BASEADDR->CH[channel].TCD_CSR = DMA_TCD_CSR_DREQ_MASK;
+    APP_EDMA_EnableRequest(channel);
+
+    tx->dmaActive = true;
+    tx->fill ^= 1U;
+}
+
+/*!
+ * brief Builds the frames and restarts the eDMA, call it from the main loop.
+ */
+void APP_TELEMETRY_Poll(void)
+{
+    uint32_t now = DWT->CYCCNT;
+
+    if (s_telemetrySampler.cpwm == NULL)
+    {
+        return;
+    }
+
+    APP_TELEMETRY_StatsAdd(&s_telemetryTx.poll, now - s_telemetryTx.lastPollCycles);
+    s_telemetryTx.lastPollCycles = now;
+
+    APP_TELEMETRY_ServiceDma();
+    APP_TELEMETRY_UpdateLateLimit();
+
+    while (APP_TELEMETRY_SendDuty())
+    {
+    }
+
+    if ((int32_t)(s_telemetrySampler.index - s_telemetryTx.nextStatusIndex) >= 0)
+    {
+        s_telemetryTx.nextStatusIndex = s_telemetrySampler.index + APP_TELEMETRY_STATUS_SAMPLES;
+        APP_TELEMETRY_SendStatus(true);
+    }
+    else if (s_telemetrySampler.faults != 0U)
+    {
+        APP_TELEMETRY_SendStatus(false);
+    }
+    else
+    {
+        /* Nothing to report. */
+    }
+
+    APP_TELEMETRY_ServiceDma();
+}
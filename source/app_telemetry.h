@@ -0,0 +1,185 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_TELEMETRY_H_
+#define APP_TELEMETRY_H_
+
+#include "fsl_common.h"
+#include "fsl_lpuart.h"
+#include "flexio_cpwm.h"
+
+/*!
+ * @addtogroup app_telemetry
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Binary PWM telemetry, streamed by eDMA to an LPUART at Mbaud rates for loop tuning.
+ *
+ * A spare FlexIO timer counts the period timer edges and raises its flag every `divider` PWM
+ * periods. Its interrupt reads back the compare of every channel, so eDMA ramps are seen as they
+ * are played, and queues the sample with no formatting. APP_TELEMETRY_Poll() packs the samples and
+ * the status into frames, the eDMA sends them from a ping-pong buffer while the next one fills.
+ *
+ * Frame on the wire: COBS(payload), then a 0x00 delimiter. Payload, little endian:
+ * - type, one of app_telemetry_frame_type_t;
+ * - sequence, incremented for every frame built, dropped ones included;
+ * - body of the type;
+ * - CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) of the type, sequence and body.
+ *
+ * Bodies:
+ * - duty: first sample index (u32), channel count (u8), sample count (u8), divider (u16), then per
+ *   sample and channel the on-time in half FlexIO clocks (u16), 0xFFFF for a static high output;
+ * - state: sample index, DWT timestamp, FlexIO clock, core clock, period ticks (u32), divider
+ *   (u16), channel count (u8), flags (u8, app_telemetry_state_flags_t), staged mask (u32), then per
+ *   channel the committed and the staged on-time (u32);
+ * - fault: sample index, faults latched since the previous fault frame (u32,
+ *   app_telemetry_faults_t), dropped samples, dropped frames, late samples, eDMA errors (u32);
+ * - timing: sample index, samples in the window, sample interval min/mean/max, sample handler
+ *   mean/max, poll interval min/mean/max, all in core cycles (u32).
+ *
+ * tools/telemetry_decode.py turns a capture into CSV.
+ */
+
+/*! @brief Periods per duty sample, the sample interrupt runs at the PWM frequency divided by this. */
+#ifndef APP_TELEMETRY_DEFAULT_DIVIDER
+#define APP_TELEMETRY_DEFAULT_DIVIDER (8U)
+#endif
+
+/*! @brief Default line rate, 12 MHz / (4 * 1) with the LPUART oversampling by 4. */
+#ifndef APP_TELEMETRY_DEFAULT_BAUDRATE
+#define APP_TELEMETRY_DEFAULT_BAUDRATE (3000000U)
+#endif
+
+/*! @brief Samples queued between the sample interrupt and APP_TELEMETRY_Poll(), a power of two. */
+#ifndef APP_TELEMETRY_SAMPLE_RING
+#define APP_TELEMETRY_SAMPLE_RING (256U)
+#endif
+
+/*! @brief Samples per duty frame. */
+#ifndef APP_TELEMETRY_DUTY_BATCH
+#define APP_TELEMETRY_DUTY_BATCH (16U)
+#endif
+
+/*! @brief Samples between two state/timing frames. */
+#ifndef APP_TELEMETRY_STATUS_SAMPLES
+#define APP_TELEMETRY_STATUS_SAMPLES (1024U)
+#endif
+
+/*! @brief Size of each of the two eDMA transmit buffers in bytes. */
+#ifndef APP_TELEMETRY_TX_BUFFER_SIZE
+#define APP_TELEMETRY_TX_BUFFER_SIZE (512U)
+#endif
+
+/*! @brief Largest payload, a COBS frame of it has a single overhead byte. */
+#define APP_TELEMETRY_MAX_PAYLOAD (254U)
+
+/*! @brief Duty value of a channel parked at a static high level. */
+#define APP_TELEMETRY_DUTY_HIGH (0xFFFFU)
+
+/*! @brief Frame types. */
+typedef enum _app_telemetry_frame_type
+{
+    kAPP_TelemetryFrameDuty   = 1U, /*!< Per period on-times. */
+    kAPP_TelemetryFrameState  = 2U, /*!< Engine state snapshot. */
+    kAPP_TelemetryFrameFault  = 3U, /*!< Fault flags and counters. */
+    kAPP_TelemetryFrameTiming = 4U, /*!< Sample and poll loop timing. */
+} app_telemetry_frame_type_t;
+
+/*! @brief Flags of the state frame. */
+typedef enum _app_telemetry_state_flags
+{
+    kAPP_TelemetryStateRamp        = (1U << 0U), /*!< An eDMA ramp is streaming. */
+    kAPP_TelemetryStateBurst       = (1U << 1U), /*!< A burst is running. */
+    kAPP_TelemetryStateClockChange = (1U << 2U), /*!< A FlexIO clock change is prepared. */
+} app_telemetry_state_flags_t;
+
+/*! @brief Fault flags. */
+typedef enum _app_telemetry_faults
+{
+    kAPP_TelemetryFaultSampleOverflow = (1U << 0U), /*!< Sample ring full, samples dropped. */
+    kAPP_TelemetryFaultTxOverflow     = (1U << 1U), /*!< Transmit buffer full, a status frame dropped. */
+    kAPP_TelemetryFaultSampleLate     = (1U << 2U), /*!< A sample came more than half an interval late. */
+    kAPP_TelemetryFaultDmaError       = (1U << 3U), /*!< The eDMA reported a transfer error. */
+} app_telemetry_faults_t;
+
+/*! @brief Telemetry configuration. */
+typedef struct _app_telemetry_config
+{
+    LPUART_Type *uart;     /*!< LPUART carrying the stream. */
+    uint32_t uartClock_Hz; /*!< LPUART functional clock. */
+    uint32_t baudRate_Bps; /*!< Line rate. */
+    uint8_t dmaChannel;    /*!< eDMA channel feeding the LPUART. */
+    uint32_t dmaRequest;   /*!< LPUART transmit request, one of the kDma0RequestMux* values. */
+    uint8_t sampleTimer;   /*!< Spare FlexIO timer of the engine instance dividing the periods. */
+    uint16_t divider;      /*!< PWM periods per duty sample, [1, 32768]. */
+} app_telemetry_config_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Gets the default configuration: eDMA channel 13, FlexIO timer 6, default divider and rate.
+ *
+ * uart, uartClock_Hz and dmaRequest are left zero and must be filled by the caller.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void APP_TELEMETRY_GetDefaultConfig(app_telemetry_config_t *config);
+
+/*!
+ * @brief Takes over the LPUART and starts sampling the engine.
+ *
+ * The LPUART is reinitialized for transmit only, the debug console must be released first if it
+ * uses the same instance. The DWT cycle counter is started for the timestamps.
+ *
+ * @param handle Running engine handle.
+ * @param config Telemetry configuration.
+ * @retval kStatus_Success Sampling started.
+ * @retval kStatus_InvalidArgument The divider or the timer is out of range.
+ * @retval kStatus_Busy The sample timer flag is owned by another FlexIO handler.
+ * @retval kStatus_LPUART_BaudrateNotSupport The line rate cannot be produced from the LPUART clock.
+ */
+status_t APP_TELEMETRY_Init(flexio_cpwm_handle_t *handle, const app_telemetry_config_t *config);
+
+/*!
+ * @brief Stops sampling and the eDMA, the frames not yet sent are lost.
+ */
+void APP_TELEMETRY_Deinit(void);
+
+/*!
+ * @brief Builds the frames and restarts the eDMA, call it from the main loop.
+ *
+ * The DWT cycle counter stops while the core sleeps, call it from a loop which does not enter
+ * low power modes to keep the timing frames meaningful.
+ */
+void APP_TELEMETRY_Poll(void);
+
+/*!
+ * @brief Latches application fault flags, sent with the next fault frame.
+ *
+ * Can be called from any context.
+ *
+ * @param faults Fault bits, the application may use the bits above kAPP_TelemetryFaultDmaError.
+ */
+void APP_TELEMETRY_ReportFault(uint32_t faults);
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_TELEMETRY_H_ */
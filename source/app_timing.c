@@ -0,0 +1,142 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "app_timing.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* MPU attribute indexes. */
+#define APP_TIMING_ATTR_FLASH_CACHED (0U)
+#define APP_TIMING_ATTR_NORMAL_NC    (1U)
+#define APP_TIMING_ATTR_DEVICE       (2U)
+
+/* MPU regions. */
+#define APP_TIMING_REGION_FLASH  (0U)
+#define APP_TIMING_REGION_SRAMX  (1U)
+#define APP_TIMING_REGION_SRAM   (2U)
+#define APP_TIMING_REGION_FLEXIO (3U)
+#define APP_TIMING_REGION_COUNT  (4U)
+
+/* FlexIO register block, one 4 KB peripheral slot. */
+#define APP_TIMING_FLEXIO_SIZE (0x1000U)
+
+/* LPCAC control bits owned by the presets. */
+#define APP_TIMING_LPCAC_MASK (SYSCON_LPCAC_CTRL_DIS_LPCAC_MASK | SYSCON_LPCAC_CTRL_FRC_NO_ALLOC_MASK)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void APP_TIMING_ClearLpcac(void);
+static void APP_TIMING_LoadMpu(bool flashCached);
+
+/* Memory boundaries from the generated linker script. */
+extern char __base_Flash[];
+extern char __top_Flash2[];
+extern char __base_SRAMX[];
+extern char __top_SRAMX[];
+extern char __base_SRAM[];
+extern char __top_SRAMH[];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void APP_TIMING_ClearLpcac(void)
+{
+    SYSCON->LPCAC_CTRL |= SYSCON_LPCAC_CTRL_CLR_LPCAC_MASK;
+    SYSCON->LPCAC_CTRL &= ~SYSCON_LPCAC_CTRL_CLR_LPCAC_MASK;
+    __DSB();
+    __ISB();
+}
+
+static void APP_TIMING_LoadMpu(bool flashCached)
+{
+    uint32_t regions = (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+    uint32_t flexioBase = (uint32_t)FLEXIO0_BASE;
+    uint32_t i;
+
+    ARM_MPU_Disable();
+
+    ARM_MPU_SetMemAttr(APP_TIMING_ATTR_FLASH_CACHED,
+                       ARM_MPU_ATTR(ARM_MPU_ATTR_MEMORY_(1U, 0U, 1U, 0U), ARM_MPU_ATTR_MEMORY_(1U, 0U, 1U, 0U)));
+    ARM_MPU_SetMemAttr(APP_TIMING_ATTR_NORMAL_NC, ARM_MPU_ATTR(ARM_MPU_ATTR_NON_CACHEABLE, ARM_MPU_ATTR_NON_CACHEABLE));
+    ARM_MPU_SetMemAttr(APP_TIMING_ATTR_DEVICE, ARM_MPU_ATTR(ARM_MPU_ATTR_DEVICE, ARM_MPU_ATTR_DEVICE_nGnRE));
+
+    ARM_MPU_SetRegion(APP_TIMING_REGION_FLASH, ARM_MPU_RBAR((uint32_t)__base_Flash, ARM_MPU_SH_NON, 1U, 1U, 0U),
+                      ARM_MPU_RLAR((uint32_t)__top_Flash2 - 1U,
+                                   flashCached ? APP_TIMING_ATTR_FLASH_CACHED : APP_TIMING_ATTR_NORMAL_NC));
+    ARM_MPU_SetRegion(APP_TIMING_REGION_SRAMX, ARM_MPU_RBAR((uint32_t)__base_SRAMX, ARM_MPU_SH_NON, 0U, 1U, 0U),
+                      ARM_MPU_RLAR((uint32_t)__top_SRAMX - 1U, APP_TIMING_ATTR_NORMAL_NC));
+    /* SRAMA..SRAMG and SRAMH are contiguous, .ramfunc code may live there too. */
+    ARM_MPU_SetRegion(APP_TIMING_REGION_SRAM, ARM_MPU_RBAR((uint32_t)__base_SRAM, ARM_MPU_SH_NON, 0U, 1U, 0U),
+                      ARM_MPU_RLAR((uint32_t)__top_SRAMH - 1U, APP_TIMING_ATTR_NORMAL_NC));
+    ARM_MPU_SetRegion(APP_TIMING_REGION_FLEXIO, ARM_MPU_RBAR(flexioBase, ARM_MPU_SH_NON, 0U, 1U, 1U),
+                      ARM_MPU_RLAR(flexioBase + APP_TIMING_FLEXIO_SIZE - 1U, APP_TIMING_ATTR_DEVICE));
+
+    for (i = APP_TIMING_REGION_COUNT; i < regions; i++)
+    {
+        ARM_MPU_ClrRegion(i);
+    }
+
+    /* Everything not listed keeps the default memory map. */
+    ARM_MPU_Enable(MPU_CTRL_PRIVDEFENA_Msk);
+}
+
+/*!
+ * brief Applies a timing preset to the LPCAC and the MPU.
+ *
+ * param preset   Timing preset.
+ * param warmup   Warm-up of the hot path, required by kAPP_TimingLockedCache, ignored otherwise.
+ * param userData Warm-up parameter.
+ * retval kStatus_Success The preset is applied.
+ * retval kStatus_InvalidArgument Unknown preset or missing warm-up.
+ */
+status_t APP_TIMING_ApplyPreset(app_timing_preset_t preset, app_timing_warmup_t warmup, void *userData)
+{
+    uint32_t primask;
+    uint32_t lpcac;
+
+    if ((preset > kAPP_TimingUncached) || ((preset == kAPP_TimingLockedCache) && (warmup == NULL)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    primask = DisableGlobalIRQ();
+
+    lpcac = SYSCON->LPCAC_CTRL & ~APP_TIMING_LPCAC_MASK;
+
+    switch (preset)
+    {
+        case kAPP_TimingAverage:
+            ARM_MPU_Disable();
+            SYSCON->LPCAC_CTRL = lpcac;
+            break;
+
+        case kAPP_TimingLockedCache:
+            APP_TIMING_LoadMpu(true);
+            /* Start empty so that only the hot path is in the cache when allocation stops. */
+            SYSCON->LPCAC_CTRL = lpcac;
+            APP_TIMING_ClearLpcac();
+            warmup(userData);
+            SYSCON->LPCAC_CTRL = lpcac | SYSCON_LPCAC_CTRL_FRC_NO_ALLOC_MASK;
+            break;
+
+        default:
+            APP_TIMING_LoadMpu(false);
+            SYSCON->LPCAC_CTRL = lpcac | SYSCON_LPCAC_CTRL_DIS_LPCAC_MASK;
+            break;
+    }
+
+    __DSB();
+    __ISB();
+
+    EnableGlobalIRQ(primask);
+
+    return kStatus_Success;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef APP_TIMING_H_
+#define APP_TIMING_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup app_timing
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Timing determinism presets. Code fetched from flash goes through the LPCAC: a hit costs no wait
+ * state, a miss costs the flash wait states, so the worst case of an interrupt depends on what ran
+ * before it. The presets trade average speed for a bounded worst case:
+ * - kAPP_TimingAverage: reset state, MPU off, LPCAC allocating on every miss.
+ * - kAPP_TimingLockedCache: the caller's warm-up loads the hot flash code into the LPCAC, then
+ *   allocation stops, so the background code cannot evict it. The background code still hits the
+ *   lines it shares with the hot code and otherwise runs at the flash speed.
+ * - kAPP_TimingUncached: LPCAC off, every flash fetch pays the wait states, slow but constant.
+ * The last two also load the MPU map below, with PRIVDEFENA for everything else:
+ * - flash:          normal, read-only, executable, write-through read-allocate (non-cacheable when uncached);
+ * - SRAMX:          normal, non-cacheable, executable, holds the RAM resident update path;
+ * - SRAMA..SRAMH:   normal, non-cacheable;
+ * - FlexIO (PWM):   device nGnRE, execute never, the channel writes are posted and do not stall the ISR.
+ */
+
+/*! @brief Timing presets. */
+typedef enum _app_timing_preset
+{
+    kAPP_TimingAverage = 0U, /*!< Reset state, best average, unbounded cache misses. */
+    kAPP_TimingLockedCache,  /*!< Warmed LPCAC, no further allocation. */
+    kAPP_TimingUncached,     /*!< LPCAC disabled, flash wait states on every fetch. */
+} app_timing_preset_t;
+
+/*!
+ * @brief Warm-up of the hot path, runs the code to keep in the LPCAC at least once.
+ *
+ * @param userData Parameter passed to APP_TIMING_ApplyPreset().
+ */
+typedef void (*app_timing_warmup_t)(void *userData);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Applies a timing preset to the LPCAC and the MPU.
+ *
+ * Runs with interrupts masked, the warm-up included.
+ *
+ * @param preset   Timing preset.
+ * @param warmup   Warm-up of the hot path, required by kAPP_TimingLockedCache, ignored otherwise.
+ * @param userData Warm-up parameter.
+ * @retval kStatus_Success The preset is applied.
+ * @retval kStatus_InvalidArgument Unknown preset or missing warm-up.
+ */
+status_t APP_TIMING_ApplyPreset(app_timing_preset_t preset, app_timing_warmup_t warmup, void *userData);
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* APP_TIMING_H_ */
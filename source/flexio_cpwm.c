@@ -0,0 +1,1151 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "flexio_cpwm.h"
+#include "app_edma.h"
+#include "app_placement.h"
+#include "app_log.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Smallest distance between on-time and period which still produces two edges. */
+#define FLEXIO_CPWM_MIN_OFF_TICKS (2U)
+
+/* Fixed point used by the ramp profiles. */
+#define FLEXIO_CPWM_RAMP_Q      (16U)
+#define FLEXIO_CPWM_RAMP_ONE    (1UL << FLEXIO_CPWM_RAMP_Q)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void FLEXIO_CPWM_WriteChannel(flexio_cpwm_handle_t *handle, uint8_t channel, uint32_t onTicks);
+static void FLEXIO_CPWM_RecordShadow(flexio_cpwm_handle_t *handle, uint8_t channel, uint32_t timctl, uint32_t timcmp);
+static uint32_t FLEXIO_CPWM_ClampOnTicks(const flexio_cpwm_handle_t *handle, uint32_t onTicks);
+static void FLEXIO_CPWM_RampHandoff(flexio_cpwm_handle_t *handle, uint32_t onTicks);
+static void FLEXIO_CPWM_BurstComplete(flexio_cpwm_handle_t *handle);
+static bool FLEXIO_CPWM_IsPeriodRunning(const flexio_cpwm_handle_t *handle);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Keeps an on-time inside the range a toggling channel timer can produce. */
+APP_HOT_CODE static uint32_t FLEXIO_CPWM_ClampOnTicks(const flexio_cpwm_handle_t *handle, uint32_t onTicks)
+{
+    if (onTicks < FLEXIO_CPWM_MIN_OFF_TICKS)
+    {
+        onTicks = FLEXIO_CPWM_MIN_OFF_TICKS;
+    }
+    if (onTicks > (handle->periodTicks - FLEXIO_CPWM_MIN_OFF_TICKS))
+    {
+        onTicks = handle->periodTicks - FLEXIO_CPWM_MIN_OFF_TICKS;
+    }
+
+    return onTicks;
+}
+
+/* Records what a channel timer was written with, control loops read it instead of the registers. */
+APP_HOT_CODE static void FLEXIO_CPWM_RecordShadow(flexio_cpwm_handle_t *handle,
+                                                  uint8_t channel,
+                                                  uint32_t timctl,
+                                                  uint32_t timcmp)
+{
+    flexio_cpwm_shadow_t *shadow = &handle->channel[channel].shadow;
+
+    shadow->timctl      = timctl;
+    shadow->timcmp      = timcmp;
+    shadow->periodTicks = handle->periodTicks;
+
+    if (0U != (timctl & FLEXIO_TIMCTL_TIMOD_MASK))
+    {
+        /* onTicks = periodTicks - 2 * (TIMCMP + 1), the rising edge comes TIMCMP + 1 after the period start. */
+        shadow->mode       = kFLEXIO_CPWM_ChannelToggling;
+        shadow->phaseTicks = timcmp + 1U;
+        shadow->onTicks    =
+            (handle->periodTicks > (2U * (timcmp + 1U))) ? (handle->periodTicks - (2U * (timcmp + 1U))) : 0U;
+    }
+    else if (0U != (timctl & FLEXIO_TIMCTL_PINPOL_MASK))
+    {
+        shadow->mode       = kFLEXIO_CPWM_ChannelHigh;
+        shadow->phaseTicks = 0U;
+        shadow->onTicks    = handle->periodTicks;
+    }
+    else
+    {
+        shadow->mode       = kFLEXIO_CPWM_ChannelLow;
+        shadow->phaseTicks = 0U;
+        shadow->onTicks    = 0U;
+    }
+
+    shadow->generation++;
+}
+
+/*
+ * Writes one channel. 0% and 100% cannot be produced by a toggling timer, the timer is disabled
+ * and the pin polarity selects the static level instead. The timer words are patched in an image
+ * of the channel timer and written by FLEXIO_ApplyTimerImage(), no register is read back.
+ */
+APP_HOT_CODE static void FLEXIO_CPWM_WriteChannel(flexio_cpwm_handle_t *handle, uint8_t channel, uint32_t onTicks)
+{
+    flexio_cpwm_channel_t *ch = &handle->channel[channel];
+    flexio_timer_image_t image;
+
+    image.timcfg = ch->timcfg;
+    image.timcmp = ch->shadow.timcmp;
+
+    if (onTicks == 0U)
+    {
+        image.timctl = ch->timctl & ~(FLEXIO_TIMCTL_TIMOD_MASK | FLEXIO_TIMCTL_PINPOL_MASK);
+    }
+    else if (onTicks >= (handle->periodTicks - 1U))
+    {
+        image.timctl = (ch->timctl & ~FLEXIO_TIMCTL_TIMOD_MASK) | FLEXIO_TIMCTL_PINPOL_MASK;
+    }
+    else
+    {
+        onTicks      = FLEXIO_CPWM_ClampOnTicks(handle, onTicks);
+        image.timcmp = FLEXIO_CPWM_OnTicksToCompare(handle->periodTicks, onTicks);
+        image.timctl = ch->timctl;
+    }
+
+    FLEXIO_ApplyTimerImage(handle->base, ch->timer, &image);
+
+    ch->onTicks = onTicks;
+    FLEXIO_CPWM_RecordShadow(handle, channel, image.timctl, image.timcmp);
+}
+
+/*!
+ * brief Gets the default engine configuration matching the BOARD_InitPeripherals() state machine.
+ *
+ * param config Pointer to the configuration structure.
+ */
+void FLEXIO_CPWM_GetDefaultConfig(flexio_cpwm_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->periodTimer      = 4U;
+    config->channelCount     = 2U;
+    config->channelTimer[0]  = 0U;
+    config->channelTimer[1]  = 2U;
+    config->rampDmaChannel   = 0U;
+    config->burstTimer       = 5U;
+    config->stateShifterMask = 0x1FU;
+}
+
+/*!
+ * brief Attaches the engine to a FlexIO instance already configured by BOARD_InitPeripherals().
+ *
+ * param handle Engine handle.
+ * param base   FlexIO peripheral base address.
+ * param config Engine configuration.
+ * retval kStatus_Success The engine is ready.
+ * retval kStatus_InvalidArgument The frequency cannot be produced with a 16-bit period timer.
+ * retval kStatus_Busy The period or burst timer flag is owned by another FlexIO handler.
+ */
+status_t FLEXIO_CPWM_Init(flexio_cpwm_handle_t *handle, FLEXIO_Type *base, const flexio_cpwm_config_t *config)
+{
+    assert(handle != NULL);
+    assert(config != NULL);
+    assert(config->channelCount <= FLEXIO_CPWM_MAX_CHANNELS);
+
+    uint32_t periodTicks;
+    uint32_t runningTicks;
+    uint32_t compare;
+    uint8_t i;
+    IRQn_Type flexioIrqs[] = FLEXIO_IRQS;
+
+    /* A previous init of this handle may still own the flags, release them before clearing it. */
+    FLEXIO_DisableTimerStatusInterrupts(base, (1UL << config->periodTimer) | (1UL << config->burstTimer));
+    (void)FLEXIO_UnregisterFlagHandlerIRQ(base, handle);
+
+    (void)memset(handle, 0, sizeof(*handle));
+
+    runningTicks = 2U * ((base->TIMCMP[config->periodTimer] & FLEXIO_TIMCMP_CMP_MASK) + 1U);
+    periodTicks  = runningTicks;
+
+    if (config->freq_Hz != 0U)
+    {
+        /* Round to the nearest even number of clocks, the period timer counts half periods. */
+        periodTicks = ((config->srcClock_Hz + config->freq_Hz) / (2U * config->freq_Hz)) * 2U;
+        if ((periodTicks < 4U) || (periodTicks > (2U * (FLEXIO_TIMCMP_CMP_MASK + 1U))))
+        {
+            return kStatus_InvalidArgument;
+        }
+    }
+
+    handle->base             = base;
+    handle->srcClock_Hz      = config->srcClock_Hz;
+    handle->periodTicks      = periodTicks;
+    handle->periodTimer      = config->periodTimer;
+    handle->channelCount     = config->channelCount;
+    handle->rampDmaChannel   = config->rampDmaChannel;
+    handle->burstTimer       = config->burstTimer;
+    handle->periodTimctl     = base->TIMCTL[config->periodTimer];
+    handle->periodTimcfg     = base->TIMCFG[config->periodTimer];
+    handle->stateShifterMask = config->stateShifterMask;
+
+    /* The state shifters are never written after BOARD_InitPeripherals(), remember their states. */
+    for (i = 0U; i < FLEXIO_SHIFTBUF_COUNT; i++)
+    {
+        if (0U != (config->stateShifterMask & (1UL << i)))
+        {
+            handle->stateShiftbuf[i] = base->SHIFTBUF[i];
+        }
+    }
+
+    /* Its level tells the period timer edges apart, see FLEXIO_CPWM_GetBoundaryMask(). */
+    handle->periodPin = (uint8_t)((handle->periodTimctl & FLEXIO_TIMCTL_PINSEL_MASK) >> FLEXIO_TIMCTL_PINSEL_SHIFT);
+
+    for (i = 0U; i < config->channelCount; i++)
+    {
+        flexio_cpwm_channel_t *ch = &handle->channel[i];
+
+        ch->timer  = config->channelTimer[i];
+        ch->timcfg = base->TIMCFG[ch->timer];
+        ch->timctl = base->TIMCTL[ch->timer];
+        FLEXIO_CPWM_RecordShadow(handle, i, ch->timctl, base->TIMCMP[ch->timer] & FLEXIO_TIMCMP_CMP_MASK);
+        if (0U == (ch->timctl & FLEXIO_TIMCTL_TRGPOL_MASK))
+        {
+            handle->risingMask |= 1UL << i;
+        }
+
+        /* Read back what the state machine is running so the outputs are not disturbed. */
+        if ((ch->timctl & FLEXIO_TIMCTL_TIMOD_MASK) == 0U)
+        {
+            ch->onTicks = (0U != (ch->timctl & FLEXIO_TIMCTL_PINPOL_MASK)) ? runningTicks : 0U;
+            ch->timctl  = (ch->timctl & ~FLEXIO_TIMCTL_PINPOL_MASK) |
+                         FLEXIO_TIMCTL_TIMOD(kFLEXIO_TimerModeSingle16Bit);
+        }
+        else
+        {
+            compare     = base->TIMCMP[ch->timer] & FLEXIO_TIMCMP_CMP_MASK;
+            ch->onTicks = (runningTicks > (2U * (compare + 1U))) ? (runningTicks - (2U * (compare + 1U))) : 0U;
+        }
+        ch->stagedOnTicks = ch->onTicks;
+    }
+
+    /* New period, e.g. after a FlexIO clock change: keep the duty ratio of every channel. */
+    if (periodTicks != runningTicks)
+    {
+        base->TIMCMP[config->periodTimer] = (periodTicks / 2U) - 1U;
+        for (i = 0U; i < config->channelCount; i++)
+        {
+            flexio_cpwm_channel_t *ch = &handle->channel[i];
+
+            FLEXIO_CPWM_WriteChannel(handle, i,
+                                     (uint32_t)((((uint64_t)ch->onTicks * periodTicks) + (runningTicks / 2U)) /
+                                                runningTicks));
+            ch->stagedOnTicks = ch->onTicks;
+        }
+    }
+
+    /* The engine owns the period and burst timer flags, other FlexIO users are not called for them. */
+    if (kStatus_Success != FLEXIO_RegisterFlagHandlerIRQ(base, 0U,
+                                                         (1UL << config->periodTimer) | (1UL << config->burstTimer),
+                                                         handle, FLEXIO_CPWM_HandleIRQ))
+    {
+        return kStatus_Busy;
+    }
+    NVIC_ClearPendingIRQ(flexioIrqs[FLEXIO_GetInstance(base)]);
+    (void)EnableIRQ(flexioIrqs[FLEXIO_GetInstance(base)]);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stages a new on-time for a channel, in FlexIO clocks.
+ *
+ * param handle  Engine handle.
+ * param channel Engine channel index.
+ * param onTicks On-time in FlexIO clocks, [0, periodTicks].
+ * retval kStatus_Success The value is staged.
+ * retval kStatus_FLEXIO_CPWM_RampBusy The channel is being ramped.
+ */
+APP_HOT_CODE status_t FLEXIO_CPWM_SetDutyTicks(flexio_cpwm_handle_t *handle, uint8_t channel, uint32_t onTicks)
+{
+    assert(channel < handle->channelCount);
+
+    if (handle->rampActive && (handle->rampChannel == channel))
+    {
+        return kStatus_FLEXIO_CPWM_RampBusy;
+    }
+
+    if (onTicks > handle->periodTicks)
+    {
+        onTicks = handle->periodTicks;
+    }
+
+    handle->channel[channel].stagedOnTicks = onTicks;
+    SDK_ATOMIC_LOCAL_SET(&handle->stagedMask, 1UL << channel);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stages a new duty for a channel.
+ *
+ * param handle  Engine handle.
+ * param channel Engine channel index.
+ * param duty    Duty in unit of %, [0, 100].
+ * retval kStatus_Success The value is staged.
+ * retval kStatus_FLEXIO_CPWM_RampBusy The channel is being ramped.
+ */
+status_t FLEXIO_CPWM_SetDuty(flexio_cpwm_handle_t *handle, uint8_t channel, uint8_t duty)
+{
+    if (duty > 100U)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    return FLEXIO_CPWM_SetDutyTicks(handle, channel, (handle->periodTicks * duty) / 100U);
+}
+
+/*!
+ * brief Commits the staged channels at the next period boundary.
+ *
+ * param handle Engine handle.
+ */
+APP_HOT_CODE void FLEXIO_CPWM_Update(flexio_cpwm_handle_t *handle)
+{
+    if (handle->stagedMask != 0U)
+    {
+        /*
+         * The flag is set at every edge, a stale one would commit at once. Only a fresh flag marks a
+         * period edge, while a ramp streams the eDMA owns the flag.
+         */
+        if (!handle->rampActive)
+        {
+            FLEXIO_ClearTimerStatusFlags(handle->base, 1UL << handle->periodTimer);
+        }
+        FLEXIO_EnableTimerStatusInterrupts(handle->base, 1UL << handle->periodTimer);
+    }
+}
+
+/*!
+ * brief Writes the staged channels immediately, without waiting for a period boundary.
+ *
+ * param handle Engine handle.
+ */
+APP_HOT_CODE void FLEXIO_CPWM_Commit(flexio_cpwm_handle_t *handle)
+{
+    uint32_t primask = DisableGlobalIRQ();
+    uint32_t staged  = handle->stagedMask;
+    uint8_t i;
+
+    handle->stagedMask = 0U;
+    for (i = 0U; i < handle->channelCount; i++)
+    {
+        if (0U != (staged & (1UL << i)))
+        {
+            FLEXIO_CPWM_WriteChannel(handle, i, handle->channel[i].stagedOnTicks);
+        }
+    }
+
+    EnableGlobalIRQ(primask);
+}
+
+/*!
+ * brief Commits the staged channels of several engines in the same PWM period.
+ *
+ * param handles Engine handles, the first one gives the period edge.
+ * param count   Number of engines.
+ * retval kStatus_Success The staged channels are written.
+ * retval kStatus_InvalidArgument The engines differ in FlexIO instance, FlexIO clock or period.
+ * retval kStatus_FLEXIO_CPWM_RampBusy A ramp is streaming on one of the engines.
+ * retval kStatus_FLEXIO_CPWM_BurstBusy A burst is running on one of the engines.
+ */
+status_t FLEXIO_CPWM_CommitGroup(flexio_cpwm_handle_t *const handles[], uint8_t count)
+{
+    assert(handles != NULL);
+    assert(count > 0U);
+
+    flexio_cpwm_handle_t *leader = handles[0];
+    uint32_t periodMask          = 1UL << leader->periodTimer;
+    flexio_cpwm_handle_t *handle;
+    uint32_t primask;
+    uint32_t staged;
+    uint8_t n;
+    uint8_t i;
+
+    for (n = 0U; n < count; n++)
+    {
+        handle = handles[n];
+        /* A ramp acknowledges the period flag by eDMA, a burst stops the period timer. */
+        if (handle->rampActive)
+        {
+            return kStatus_FLEXIO_CPWM_RampBusy;
+        }
+        if (handle->burstActive)
+        {
+            return kStatus_FLEXIO_CPWM_BurstBusy;
+        }
+        /* Only the timers of one instance share a start, FLEXEN, and so their period edges. */
+        if ((handle->base != leader->base) || (handle->srcClock_Hz != leader->srcClock_Hz) ||
+            (handle->periodTicks != leader->periodTicks))
+        {
+            return kStatus_InvalidArgument;
+        }
+    }
+
+    primask = DisableGlobalIRQ();
+
+    /* Same wait as FLEXIO_CPWM_AlignClockChange(): only a fresh flag marks a period edge. */
+    if (FLEXIO_CPWM_IsPeriodRunning(leader))
+    {
+        FLEXIO_ClearTimerStatusFlags(leader->base, periodMask);
+        while (0U == (FLEXIO_GetTimerStatusFlags(leader->base) & periodMask))
+        {
+        }
+    }
+
+    for (n = 0U; n < count; n++)
+    {
+        handle             = handles[n];
+        staged             = handle->stagedMask;
+        handle->stagedMask = 0U;
+        for (i = 0U; i < handle->channelCount; i++)
+        {
+            if (0U != (staged & (1UL << i)))
+            {
+                FLEXIO_CPWM_WriteChannel(handle, i, handle->channel[i].stagedOnTicks);
+            }
+        }
+        /* A pending FLEXIO_CPWM_Update() has nothing left to write. */
+        FLEXIO_DisableTimerStatusInterrupts(handle->base, 1UL << handle->periodTimer);
+    }
+
+    EnableGlobalIRQ(primask);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Changes the PWM frequency on the running FlexIO clock, keeping the duty of every channel.
+ *
+ * param handle  Engine handle.
+ * param freq_Hz New PWM frequency.
+ * retval kStatus_Success The new period is written.
+ * retval kStatus_FLEXIO_CPWM_RampBusy A ramp is streaming.
+ * retval kStatus_FLEXIO_CPWM_BurstBusy A burst is running.
+ * retval kStatus_InvalidArgument The frequency cannot be produced with a 16-bit period timer.
+ */
+APP_HOT_CODE status_t FLEXIO_CPWM_SetFrequency(flexio_cpwm_handle_t *handle, uint32_t freq_Hz)
+{
+    uint32_t oldTicks = handle->periodTicks;
+    bool running      = FLEXIO_CPWM_IsPeriodRunning(handle);
+    uint32_t periodTicks;
+    uint32_t onTicks;
+    uint32_t primask;
+    uint8_t i;
+
+    if (handle->rampActive)
+    {
+        return kStatus_FLEXIO_CPWM_RampBusy;
+    }
+    if (handle->burstActive)
+    {
+        return kStatus_FLEXIO_CPWM_BurstBusy;
+    }
+    if (freq_Hz == 0U)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Same rounding as FLEXIO_CPWM_Init(). */
+    periodTicks = ((handle->srcClock_Hz + freq_Hz) / (2U * freq_Hz)) * 2U;
+    if ((periodTicks < 4U) || (periodTicks > (2U * (FLEXIO_TIMCMP_CMP_MASK + 1U))))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    primask = DisableGlobalIRQ();
+
+    handle->base->TIMCMP[handle->periodTimer] = (periodTicks / 2U) - 1U;
+    handle->periodTicks                       = periodTicks;
+
+    for (i = 0U; i < handle->channelCount; i++)
+    {
+        flexio_cpwm_channel_t *ch = &handle->channel[i];
+
+        onTicks = (0U != (handle->stagedMask & (1UL << i))) ? ch->stagedOnTicks : ch->onTicks;
+        onTicks = (uint32_t)((((uint64_t)onTicks * periodTicks) + (oldTicks / 2U)) / oldTicks);
+        if (running)
+        {
+            FLEXIO_CPWM_WriteChannel(handle, i, onTicks);
+        }
+        else
+        {
+            /* Parked outputs keep their level, FLEXIO_CPWM_StopBurst() writes the compares. */
+            ch->onTicks = onTicks;
+        }
+        ch->stagedOnTicks = ch->onTicks;
+    }
+
+    /* Staged updates are part of the new compares. */
+    handle->stagedMask = 0U;
+    FLEXIO_DisableTimerStatusInterrupts(handle->base, 1UL << handle->periodTimer);
+
+    EnableGlobalIRQ(primask);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Gets the shadow of a channel timer, from RAM.
+ *
+ * param handle  Engine handle.
+ * param channel Engine channel index.
+ * param shadow  Pointer to the shadow copy.
+ */
+APP_HOT_CODE void FLEXIO_CPWM_GetShadow(flexio_cpwm_handle_t *handle, uint8_t channel, flexio_cpwm_shadow_t *shadow)
+{
+    assert(channel < handle->channelCount);
+    assert(shadow != NULL);
+
+    uint32_t primask = DisableGlobalIRQ();
+
+    *shadow = handle->channel[channel].shadow;
+
+    EnableGlobalIRQ(primask);
+}
+
+/*!
+ * brief Compares the shadow state with the FlexIO registers, call it from the main loop.
+ *
+ * param handle    Engine handle.
+ * param faultMask Bit n for channel n, FLEXIO_CPWM_FAULT_PERIOD and FLEXIO_CPWM_FAULT_SHIFTER(), may be NULL.
+ * retval kStatus_Success Every register matches.
+ * retval kStatus_FLEXIO_CPWM_ShadowMismatch A register differs, see faultMask.
+ */
+status_t FLEXIO_CPWM_CheckShadow(flexio_cpwm_handle_t *handle, uint32_t *faultMask)
+{
+    FLEXIO_Type *base = handle->base;
+    uint32_t faults   = 0U;
+    uint32_t primask;
+    uint8_t i;
+
+    for (i = 0U; i < handle->channelCount; i++)
+    {
+        flexio_cpwm_channel_t *ch = &handle->channel[i];
+
+        /*
+         * Masked, so a commit cannot land between the register and the shadow reads. A parked timer
+         * keeps a stale TIMCMP, the eDMA rewrites the one of a ramped channel.
+         */
+        primask = DisableGlobalIRQ();
+        if ((base->TIMCTL[ch->timer] != ch->shadow.timctl) ||
+            ((ch->shadow.mode == kFLEXIO_CPWM_ChannelToggling) && !(handle->rampActive && (handle->rampChannel == i)) &&
+             ((base->TIMCMP[ch->timer] & FLEXIO_TIMCMP_CMP_MASK) != ch->shadow.timcmp)))
+        {
+            faults |= 1UL << i;
+        }
+        EnableGlobalIRQ(primask);
+    }
+
+    primask = DisableGlobalIRQ();
+    if (((base->TIMCMP[handle->periodTimer] & FLEXIO_TIMCMP_CMP_MASK) != ((handle->periodTicks / 2U) - 1U)) ||
+        (!handle->periodGated && ((base->TIMCTL[handle->periodTimer] != handle->periodTimctl) ||
+                                  (base->TIMCFG[handle->periodTimer] != handle->periodTimcfg))))
+    {
+        faults |= FLEXIO_CPWM_FAULT_PERIOD;
+    }
+    EnableGlobalIRQ(primask);
+
+    for (i = 0U; i < FLEXIO_SHIFTBUF_COUNT; i++)
+    {
+        if ((0U != (handle->stateShifterMask & (1UL << i))) && (base->SHIFTBUF[i] != handle->stateShiftbuf[i]))
+        {
+            faults |= FLEXIO_CPWM_FAULT_SHIFTER(i);
+        }
+    }
+
+    if (faultMask != NULL)
+    {
+        *faultMask = faults;
+    }
+
+    return (faults == 0U) ? kStatus_Success : kStatus_FLEXIO_CPWM_ShadowMismatch;
+}
+
+/*!
+ * brief Precomputes a duty ramp into a compare table.
+ *
+ * param handle   Engine handle.
+ * param config   Ramp configuration.
+ * param steps    Table to fill, must stay valid until the ramp completes.
+ * param maxSteps Number of entries in the table.
+ * retval kStatus_Success The ramp is ready to start.
+ * retval kStatus_FLEXIO_CPWM_RampBusy Another ramp is streaming.
+ * retval kStatus_FLEXIO_CPWM_RampTableTooSmall The table is too short for the ramp length.
+ * retval kStatus_InvalidArgument Invalid channel, duty or length.
+ */
+status_t FLEXIO_CPWM_PrepareRamp(flexio_cpwm_handle_t *handle,
+                                 const flexio_cpwm_ramp_config_t *config,
+                                 flexio_cpwm_ramp_step_t *steps,
+                                 uint32_t maxSteps)
+{
+    assert(config != NULL);
+    assert(steps != NULL);
+
+    uint32_t periods;
+    uint32_t stepCount;
+    uint32_t startTicks;
+    uint32_t targetTicks;
+    uint32_t onTicks;
+    uint32_t x;
+    uint32_t i;
+    uint32_t statusClear = 1UL << handle->periodTimer;
+
+    if (handle->rampActive)
+    {
+        return kStatus_FLEXIO_CPWM_RampBusy;
+    }
+
+    if ((config->channel >= handle->channelCount) || (config->startDuty > 100U) || (config->targetDuty > 100U))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if (config->duration_us != 0U)
+    {
+        periods = (uint32_t)(((uint64_t)config->duration_us * handle->srcClock_Hz) /
+                             ((uint64_t)handle->periodTicks * 1000000U));
+    }
+    else
+    {
+        periods = config->periods;
+    }
+
+    if (periods == 0U)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* The period timer expires twice per PWM period. */
+    stepCount = 2U * periods;
+    if ((stepCount > maxSteps) || (stepCount > DMA_TCD_CITER_ELINKNO_CITER_MASK))
+    {
+        return kStatus_FLEXIO_CPWM_RampTableTooSmall;
+    }
+
+    startTicks  = (handle->periodTicks * config->startDuty) / 100U;
+    targetTicks = (handle->periodTicks * config->targetDuty) / 100U;
+
+    for (i = 0U; i < stepCount; i++)
+    {
+        /* Ramp position in Q16, the last step lands exactly on the target. */
+        x = (stepCount > 1U) ? (uint32_t)(((uint64_t)i * FLEXIO_CPWM_RAMP_ONE) / (stepCount - 1U)) :
+                               FLEXIO_CPWM_RAMP_ONE;
+
+        if (config->profile == kFLEXIO_CPWM_RampSCurve)
+        {
+            /* Smoothstep: x * x * (3 - 2 * x) */
+            x = (uint32_t)(((((uint64_t)x * x) >> FLEXIO_CPWM_RAMP_Q) * ((3U * FLEXIO_CPWM_RAMP_ONE) - (2U * x))) >>
+                           FLEXIO_CPWM_RAMP_Q);
+        }
+
+        if (targetTicks >= startTicks)
+        {
+            onTicks = startTicks + (uint32_t)(((uint64_t)(targetTicks - startTicks) * x) >> FLEXIO_CPWM_RAMP_Q);
+        }
+        else
+        {
+            onTicks = startTicks - (uint32_t)(((uint64_t)(startTicks - targetTicks) * x) >> FLEXIO_CPWM_RAMP_Q);
+        }
+
+        /* The ramp only streams compares, 0% and 100% are applied by the handoff. */
+        steps[i].compare =
+            FLEXIO_CPWM_OnTicksToCompare(handle->periodTicks, FLEXIO_CPWM_ClampOnTicks(handle, onTicks));
+        steps[i].statusClear = statusClear;
+    }
+
+    handle->rampChannel     = config->channel;
+    handle->rampTargetTicks = targetTicks;
+    handle->rampSteps       = steps;
+    handle->rampStepCount   = stepCount;
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Starts streaming the prepared ramp. No CPU work is needed until it completes.
+ *
+ * param handle Engine handle.
+ * retval kStatus_Success The ramp started.
+ * retval kStatus_FLEXIO_CPWM_RampIdle No ramp is prepared.
+ * retval kStatus_FLEXIO_CPWM_RampBusy The ramp is already streaming.
+ */
+status_t FLEXIO_CPWM_StartRamp(flexio_cpwm_handle_t *handle)
+{
+    FLEXIO_Type *base         = handle->base;
+    flexio_cpwm_channel_t *ch = &handle->channel[handle->rampChannel];
+    uint8_t dmaCh             = handle->rampDmaChannel;
+    uint32_t first            = 0U;
+    int32_t doff;
+
+    if (handle->rampSteps == NULL)
+    {
+        return kStatus_FLEXIO_CPWM_RampIdle;
+    }
+    if (handle->rampActive)
+    {
+        return kStatus_FLEXIO_CPWM_RampBusy;
+    }
+    if (handle->burstActive)
+    {
+        return kStatus_FLEXIO_CPWM_BurstBusy;
+    }
+
+    /* A pending staged value of the ramped channel would fight with the stream. */
+    SDK_ATOMIC_LOCAL_CLEAR(&handle->stagedMask, 1UL << handle->rampChannel);
+
+    /*
+     * Every step is stored once, by the eDMA at its period timer edge. A timer parked at a static
+     * 0%/100% level runs no period: it takes the first step with its toggling TIMCTL now, before it
+     * is enabled, and the stream starts at the second step.
+     */
+    if (ch->shadow.mode != kFLEXIO_CPWM_ChannelToggling)
+    {
+        base->TIMCMP[ch->timer] = handle->rampSteps[0].compare;
+        base->TIMCTL[ch->timer] = ch->timctl;
+        first                   = 1U;
+    }
+    FLEXIO_CPWM_RecordShadow(handle, handle->rampChannel, ch->timctl, handle->rampSteps[0].compare);
+
+    APP_EDMA_Init();
+    APP_EDMA_ResetChannel(dmaCh, APP_EDMA_GetFlexioRequest(FLEXIO_GetInstance(base), handle->periodTimer));
+
+    /*
+     * Each minor loop writes TIMCMP of the channel then acknowledges the period timer in TIMSTAT,
+     * the minor loop offset moves the destination back to TIMCMP.
+     */
+    doff = (int32_t)((uint32_t)&base->TIMSTAT - (uint32_t)&base->TIMCMP[ch->timer]);
+
+    APP_EDMA_BASEADDR->CH[dmaCh].TCD_SADDR = (uint32_t)&handle->rampSteps[first];
+    APP_EDMA_BASEADDR->CH[dmaCh].TCD_SOFF  = 4U;
+    APP_EDMA_BASEADDR->CH[dmaCh].TCD_ATTR =
+        DMA_TCD_ATTR_SSIZE(APP_EDMA_SIZE_4BYTES) | DMA_TCD_ATTR_DSIZE(APP_EDMA_SIZE_4BYTES);
+    APP_EDMA_BASEADDR->CH[dmaCh].TCD_NBYTES_MLOFFYES = DMA_TCD_NBYTES_MLOFFYES_DMLOE(1U) |
+                                                       DMA_TCD_NBYTES_MLOFFYES_MLOFF((uint32_t)(-2 * doff)) |
+                                                       DMA_TCD_NBYTES_MLOFFYES_NBYTES(sizeof(flexio_cpwm_ramp_step_t));
+    APP_EDMA_BASEADDR->CH[dmaCh].TCD_DADDR         = (uint32_t)&base->TIMCMP[ch->timer];
+    APP_EDMA_BASEADDR->CH[dmaCh].TCD_DOFF          = (uint16_t)doff;
+    APP_EDMA_BASEADDR->CH[dmaCh].TCD_CITER_ELINKNO = (uint16_t)(handle->rampStepCount - first);
+    APP_EDMA_BASEADDR->CH[dmaCh].TCD_BITER_ELINKNO = (uint16_t)(handle->rampStepCount - first);
+    /* Drop the request once the table is exhausted. */
+    APP_EDMA_BASEADDR->CH[dmaCh].TCD_CSR = DMA_TCD_CSR_DREQ_MASK;
+
+    handle->rampActive = true;
+
+    if (handle->rampStepCount > first)
+    {
+        FLEXIO_ClearTimerStatusFlags(base, 1UL << handle->periodTimer);
+        APP_EDMA_EnableRequest(dmaCh);
+        base->TIMERSDEN |= FLEXIO_TIMERSDEN_TSDE(1UL << handle->periodTimer);
+    }
+    else
+    {
+        FLEXIO_CPWM_RampHandoff(handle, handle->rampTargetTicks);
+    }
+
+    return kStatus_Success;
+}
+
+/* Gives the ramped channel back to the regular update path. */
+static void FLEXIO_CPWM_RampHandoff(flexio_cpwm_handle_t *handle, uint32_t onTicks)
+{
+    handle->base->TIMERSDEN &= ~FLEXIO_TIMERSDEN_TSDE(1UL << handle->periodTimer);
+    APP_EDMA_StopChannel(handle->rampDmaChannel);
+
+    FLEXIO_CPWM_WriteChannel(handle, handle->rampChannel, onTicks);
+    handle->channel[handle->rampChannel].stagedOnTicks = handle->channel[handle->rampChannel].onTicks;
+
+    handle->rampSteps  = NULL;
+    handle->rampActive = false;
+}
+
+/*!
+ * brief Aborts a ramp. The channel keeps the last streamed duty, which becomes the committed duty.
+ *
+ * param handle Engine handle.
+ */
+void FLEXIO_CPWM_AbortRamp(flexio_cpwm_handle_t *handle)
+{
+    uint32_t compare;
+
+    if (!handle->rampActive)
+    {
+        return;
+    }
+
+    /* Stop the stream first, TIMCMP then holds the last step the hardware is running. */
+    handle->base->TIMERSDEN &= ~FLEXIO_TIMERSDEN_TSDE(1UL << handle->periodTimer);
+    APP_EDMA_StopChannel(handle->rampDmaChannel);
+
+    compare = handle->base->TIMCMP[handle->channel[handle->rampChannel].timer] & FLEXIO_TIMCMP_CMP_MASK;
+    FLEXIO_CPWM_RampHandoff(handle, handle->periodTicks - (2U * (compare + 1U)));
+}
+
+/*!
+ * brief Gets the ramp status, handing the channel back to the regular update path once done.
+ *
+ * param handle Engine handle.
+ * retval kStatus_Success No ramp is streaming.
+ * retval kStatus_FLEXIO_CPWM_RampBusy The ramp is streaming.
+ */
+status_t FLEXIO_CPWM_GetRampStatus(flexio_cpwm_handle_t *handle)
+{
+    if (!handle->rampActive)
+    {
+        return kStatus_Success;
+    }
+
+    if (!APP_EDMA_IsDone(handle->rampDmaChannel))
+    {
+        return kStatus_FLEXIO_CPWM_RampBusy;
+    }
+
+    /* Applies the exact target, including a static 0% or 100% level. */
+    FLEXIO_CPWM_RampHandoff(handle, handle->rampTargetTicks);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Installs the event callback, e.g. for kStatus_FLEXIO_CPWM_BurstComplete.
+ *
+ * param handle   Engine handle.
+ * param callback Callback function, NULL to remove.
+ * param userData Callback parameter.
+ */
+void FLEXIO_CPWM_SetCallback(flexio_cpwm_handle_t *handle, flexio_cpwm_callback_t callback, void *userData)
+{
+    handle->callback = callback;
+    handle->userData = userData;
+}
+
+/*!
+ * brief Emits exactly pulseCount center aligned periods, then parks the outputs.
+ *
+ * param handle     Engine handle.
+ * param pulseCount Number of PWM periods, [1, FLEXIO_CPWM_MAX_BURST_PERIODS].
+ * param idleMask   Bit n set parks channel n high after the burst, cleared parks it low.
+ * retval kStatus_Success The burst started.
+ * retval kStatus_FLEXIO_CPWM_BurstBusy A burst is already running.
+ * retval kStatus_FLEXIO_CPWM_RampBusy A ramp is streaming.
+ * retval kStatus_InvalidArgument pulseCount is out of range.
+ */
+status_t FLEXIO_CPWM_StartBurst(flexio_cpwm_handle_t *handle, uint32_t pulseCount, uint32_t idleMask)
+{
+    FLEXIO_Type *base  = handle->base;
+    uint8_t period     = handle->periodTimer;
+    uint8_t burst      = handle->burstTimer;
+    uint32_t burstMask = 1UL << burst;
+    uint8_t i;
+
+    if ((pulseCount == 0U) || (pulseCount > FLEXIO_CPWM_MAX_BURST_PERIODS))
+    {
+        return kStatus_InvalidArgument;
+    }
+    if (handle->burstActive)
+    {
+        return kStatus_FLEXIO_CPWM_BurstBusy;
+    }
+    if (handle->rampActive)
+    {
+        return kStatus_FLEXIO_CPWM_RampBusy;
+    }
+
+    /* Stop the period, the channel timers are disabled by the falling period timer output. */
+    handle->periodGated  = true;
+    base->TIMCTL[period] = handle->periodTimctl & ~FLEXIO_TIMCTL_TIMOD_MASK;
+    base->TIMCTL[burst]  = 0U;
+
+    /* Leave a static 0%/100% level of a previous burst or update. */
+    for (i = 0U; i < handle->channelCount; i++)
+    {
+        FLEXIO_CPWM_WriteChannel(handle, i, handle->channel[i].onTicks);
+    }
+
+    /*
+     * Burst timer: output high while enabled, decrements on both period timer edges and disables
+     * itself on compare, i.e. after 2 * pulseCount edges.
+     */
+    base->TIMCMP[burst] = (2U * pulseCount) - 1U;
+    base->TIMCFG[burst] = FLEXIO_TIMCFG_TIMOUT(kFLEXIO_TimerOutputOneNotAffectedByReset) |
+                          FLEXIO_TIMCFG_TIMDEC(kFLEXIO_TimerDecSrcOnTriggerInputShiftTimerOutput) |
+                          FLEXIO_TIMCFG_TIMRST(kFLEXIO_TimerResetNever) |
+                          FLEXIO_TIMCFG_TIMDIS(kFLEXIO_TimerDisableOnTimerCompare) |
+                          FLEXIO_TIMCFG_TIMENA(kFLEXIO_TimerEnabledAlways);
+
+    /* Period timer: runs while the burst timer output is high. */
+    base->TIMCFG[period] = (handle->periodTimcfg & ~(FLEXIO_TIMCFG_TIMENA_MASK | FLEXIO_TIMCFG_TIMDIS_MASK)) |
+                           FLEXIO_TIMCFG_TIMENA(kFLEXIO_TimerEnableOnTriggerHigh) |
+                           FLEXIO_TIMCFG_TIMDIS(kFLEXIO_TimerDisableOnTriggerFallingEdge);
+    base->TIMCTL[period] = (handle->periodTimctl &
+                            ~(FLEXIO_TIMCTL_TRGSEL_MASK | FLEXIO_TIMCTL_TRGPOL_MASK | FLEXIO_TIMCTL_TRGSRC_MASK)) |
+                           FLEXIO_TIMCTL_TRGSEL(FLEXIO_TIMER_TRIGGER_SEL_TIMn(burst)) |
+                           FLEXIO_TIMCTL_TRGPOL(kFLEXIO_TimerTriggerPolarityActiveHigh) |
+                           FLEXIO_TIMCTL_TRGSRC(kFLEXIO_TimerTriggerSourceInternal);
+
+    handle->burstIdleMask = idleMask;
+    handle->burstActive   = true;
+
+    FLEXIO_ClearTimerStatusFlags(base, burstMask);
+    FLEXIO_EnableTimerStatusInterrupts(base, burstMask);
+
+    /* Enabling the burst timer starts the first period. */
+    base->TIMCTL[burst] = FLEXIO_TIMCTL_TRGSEL(FLEXIO_TIMER_TRIGGER_SEL_TIMn(period)) |
+                          FLEXIO_TIMCTL_TRGPOL(kFLEXIO_TimerTriggerPolarityActiveHigh) |
+                          FLEXIO_TIMCTL_TRGSRC(kFLEXIO_TimerTriggerSourceInternal) |
+                          FLEXIO_TIMCTL_PINCFG(kFLEXIO_PinConfigOutputDisabled) |
+                          FLEXIO_TIMCTL_TIMOD(kFLEXIO_TimerModeSingle16Bit);
+
+    return kStatus_Success;
+}
+
+/* Parks the outputs once the burst timer has gated the period timer off. */
+static void FLEXIO_CPWM_BurstComplete(flexio_cpwm_handle_t *handle)
+{
+    uint8_t i;
+
+    FLEXIO_DisableTimerStatusInterrupts(handle->base, 1UL << handle->burstTimer);
+    FLEXIO_ClearTimerStatusFlags(handle->base, 1UL << handle->burstTimer);
+    handle->base->TIMCTL[handle->burstTimer] = 0U;
+
+    for (i = 0U; i < handle->channelCount; i++)
+    {
+        uint32_t onTicks = (0U != (handle->burstIdleMask & (1UL << i))) ? handle->periodTicks : 0U;
+        uint32_t ticks   = handle->channel[i].onTicks;
+
+        /* Park the pin, keep the duty so FLEXIO_CPWM_StopBurst() can resume it. */
+        FLEXIO_CPWM_WriteChannel(handle, i, onTicks);
+        handle->channel[i].onTicks = ticks;
+    }
+
+    handle->burstActive = false;
+}
+
+/*!
+ * brief Stops a running burst and returns the period timer to free running operation.
+ *
+ * param handle Engine handle.
+ */
+void FLEXIO_CPWM_StopBurst(flexio_cpwm_handle_t *handle)
+{
+    FLEXIO_Type *base = handle->base;
+    uint8_t i;
+
+    FLEXIO_DisableTimerStatusInterrupts(base, 1UL << handle->burstTimer);
+    base->TIMCTL[handle->burstTimer] = 0U;
+    FLEXIO_ClearTimerStatusFlags(base, 1UL << handle->burstTimer);
+    handle->burstActive = false;
+
+    base->TIMCTL[handle->periodTimer] = handle->periodTimctl & ~FLEXIO_TIMCTL_TIMOD_MASK;
+    base->TIMCFG[handle->periodTimer] = handle->periodTimcfg;
+
+    for (i = 0U; i < handle->channelCount; i++)
+    {
+        FLEXIO_CPWM_WriteChannel(handle, i, handle->channel[i].onTicks);
+    }
+
+    base->TIMCTL[handle->periodTimer] = handle->periodTimctl;
+    handle->periodGated               = false;
+}
+
+/* The period timer runs free unless a burst gates it or left it parked. */
+static bool FLEXIO_CPWM_IsPeriodRunning(const flexio_cpwm_handle_t *handle)
+{
+    return (handle->base->TIMCFG[handle->periodTimer] == handle->periodTimcfg) &&
+           (0U != (handle->base->TIMCTL[handle->periodTimer] & FLEXIO_TIMCTL_TIMOD_MASK));
+}
+
+/*!
+ * brief Computes the compares for a new FlexIO clock, first step of a clock change.
+ *
+ * param handle         Engine handle.
+ * param newSrcClock_Hz FlexIO clock frequency after the change.
+ * retval kStatus_Success The change is prepared.
+ * retval kStatus_FLEXIO_CPWM_RampBusy A ramp is streaming.
+ * retval kStatus_FLEXIO_CPWM_BurstBusy A burst is running.
+ * retval kStatus_InvalidArgument The PWM frequency cannot be produced from the new clock.
+ */
+status_t FLEXIO_CPWM_PrepareClockChange(flexio_cpwm_handle_t *handle, uint32_t newSrcClock_Hz)
+{
+    uint32_t periodTicks;
+    uint32_t onTicks;
+    uint8_t i;
+
+    if (handle->rampActive)
+    {
+        return kStatus_FLEXIO_CPWM_RampBusy;
+    }
+    if (handle->burstActive)
+    {
+        return kStatus_FLEXIO_CPWM_BurstBusy;
+    }
+    if ((handle->srcClock_Hz == 0U) || (newSrcClock_Hz == 0U))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Same frequency on the new clock, rounded to an even number of clocks. */
+    periodTicks = (uint32_t)((((uint64_t)handle->periodTicks * newSrcClock_Hz) + handle->srcClock_Hz) /
+                             (2U * (uint64_t)handle->srcClock_Hz)) *
+                  2U;
+    if ((periodTicks < 4U) || (periodTicks > (2U * (FLEXIO_TIMCMP_CMP_MASK + 1U))))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    for (i = 0U; i < handle->channelCount; i++)
+    {
+        flexio_cpwm_channel_t *ch = &handle->channel[i];
+
+        onTicks = (0U != (handle->stagedMask & (1UL << i))) ? ch->stagedOnTicks : ch->onTicks;
+        ch->retimeOnTicks =
+            (uint32_t)((((uint64_t)onTicks * periodTicks) + (handle->periodTicks / 2U)) / handle->periodTicks);
+    }
+
+    handle->retimePeriodTicks = periodTicks;
+    handle->retimeSrcClock_Hz = newSrcClock_Hz;
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Waits for the next period timer edge, call it with interrupts masked.
+ *
+ * param handle Engine handle.
+ */
+void FLEXIO_CPWM_AlignClockChange(flexio_cpwm_handle_t *handle)
+{
+    uint32_t periodMask = 1UL << handle->periodTimer;
+
+    if ((handle->retimeSrcClock_Hz == 0U) || !FLEXIO_CPWM_IsPeriodRunning(handle))
+    {
+        return;
+    }
+
+    /* The flag may be pending from any earlier edge, only a fresh one marks the period start. */
+    FLEXIO_ClearTimerStatusFlags(handle->base, periodMask);
+    while (0U == (FLEXIO_GetTimerStatusFlags(handle->base) & periodMask))
+    {
+    }
+}
+
+/*!
+ * brief Writes the compares prepared for the new clock, call it right after the clock switch.
+ *
+ * param handle Engine handle.
+ */
+void FLEXIO_CPWM_CompleteClockChange(flexio_cpwm_handle_t *handle)
+{
+    bool running = FLEXIO_CPWM_IsPeriodRunning(handle);
+    uint8_t i;
+
+    if (handle->retimeSrcClock_Hz == 0U)
+    {
+        return;
+    }
+
+    handle->base->TIMCMP[handle->periodTimer] = (handle->retimePeriodTicks / 2U) - 1U;
+    handle->periodTicks                       = handle->retimePeriodTicks;
+    handle->srcClock_Hz                       = handle->retimeSrcClock_Hz;
+
+    for (i = 0U; i < handle->channelCount; i++)
+    {
+        flexio_cpwm_channel_t *ch = &handle->channel[i];
+
+        if (running)
+        {
+            FLEXIO_CPWM_WriteChannel(handle, i, ch->retimeOnTicks);
+        }
+        else
+        {
+            /* Parked outputs keep their level, FLEXIO_CPWM_StopBurst() writes the compares. */
+            ch->onTicks = ch->retimeOnTicks;
+        }
+        ch->stagedOnTicks = ch->onTicks;
+    }
+
+    /* Staged updates are part of the new compares. */
+    handle->stagedMask = 0U;
+    FLEXIO_DisableTimerStatusInterrupts(handle->base, 1UL << handle->periodTimer);
+
+    handle->retimeSrcClock_Hz = 0U;
+}
+
+/*!
+ * brief Drops a prepared clock change.
+ *
+ * param handle Engine handle.
+ */
+void FLEXIO_CPWM_CancelClockChange(flexio_cpwm_handle_t *handle)
+{
+    handle->retimeSrcClock_Hz = 0U;
+}
+
+/*!
+ * brief Engine interrupt handler, registered through FLEXIO_RegisterFlagHandlerIRQ().
+ *
+ * param base   FlexIO peripheral base address.
+ * param handle Engine handle.
+ */
+APP_HOT_CODE void FLEXIO_CPWM_HandleIRQ(void *base, void *handle)
+{
+    flexio_cpwm_handle_t *cpwmHandle = (flexio_cpwm_handle_t *)handle;
+    FLEXIO_Type *flexioBase          = (FLEXIO_Type *)base;
+    uint32_t periodMask              = 1UL << cpwmHandle->periodTimer;
+    uint32_t flags                   = FLEXIO_GetTimerStatusFlags(flexioBase) & flexioBase->TIMIEN;
+    uint32_t staged;
+    uint8_t i;
+
+    if (cpwmHandle->burstActive && (0U != (flags & (1UL << cpwmHandle->burstTimer))))
+    {
+        FLEXIO_CPWM_BurstComplete(cpwmHandle);
+        APP_LOG("cpwm: burst complete, flags 0x%x\n", flags);
+        if (cpwmHandle->callback != NULL)
+        {
+            cpwmHandle->callback(cpwmHandle, kStatus_FLEXIO_CPWM_BurstComplete, cpwmHandle->userData);
+        }
+    }
+
+    if (0U == (flags & periodMask))
+    {
+        return;
+    }
+
+    /* While a ramp streams the eDMA acknowledges the period timer. */
+    if (!cpwmHandle->rampActive)
+    {
+        FLEXIO_ClearTimerStatusFlags(flexioBase, periodMask);
+    }
+
+    /* Only the channels whose period starts at this edge, the others wait for the next one. */
+    staged = cpwmHandle->stagedMask & FLEXIO_CPWM_GetBoundaryMask(cpwmHandle);
+    cpwmHandle->stagedMask &= ~staged;
+
+    for (i = 0U; i < cpwmHandle->channelCount; i++)
+    {
+        if (0U != (staged & (1UL << i)))
+        {
+            FLEXIO_CPWM_WriteChannel(cpwmHandle, i, cpwmHandle->channel[i].stagedOnTicks);
+            APP_LOG("cpwm: ch%u committed %u/%u ticks\n", i, cpwmHandle->channel[i].onTicks,
+                    cpwmHandle->periodTicks);
+        }
+    }
+
+    if (cpwmHandle->stagedMask == 0U)
+    {
+        FLEXIO_DisableTimerStatusInterrupts(flexioBase, periodMask);
+    }
+}
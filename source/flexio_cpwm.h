@@ -0,0 +1,521 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef FLEXIO_CPWM_H_
+#define FLEXIO_CPWM_H_
+
+#include "fsl_flexio.h"
+
+/*!
+ * @addtogroup flexio_cpwm
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * The center aligned PWM is produced by the FlexIO state machine configured in peripherals.c:
+ * - the period timer runs as a free running 16-bit counter, its output toggles every half period,
+ *   so one PWM period is 2 * (TIMCMP + 1) FlexIO clocks;
+ * - every channel timer is enabled/disabled by the period timer edges and its TIMCMP holds the
+ *   distance between the period edge and the channel edge. The state machine mirrors that edge
+ *   around the period centre, an on-time of onTicks therefore needs TIMCMP = (period - onTicks) / 2 - 1.
+ *
+ * A channel timer reloads TIMCMP only when it is enabled by the period timer, so a compare
+ * written at a period-timer expiry takes effect at the next period without glitches.
+ *
+ * The period timer expires twice per period. The period of a channel starts at the edge which
+ * enables its timer, the rising edge of the period timer output, or the falling one for a channel
+ * triggered active low. FLEXIO_CPWM_Update() commits every channel at its own period start, the
+ * edge is told from the level of the period timer output pin, FXIO_D28 in BOARD_InitPeripherals().
+ */
+
+/*! @brief Maximum number of channels handled by one PWM engine. */
+#define FLEXIO_CPWM_MAX_CHANNELS (4U)
+
+/*! @brief Status group of the center aligned PWM engine. */
+#define kStatusGroup_FLEXIO_CPWM kStatusGroup_ApplicationRangeStart
+
+/*! @brief Error codes of the center aligned PWM engine. */
+enum
+{
+    kStatus_FLEXIO_CPWM_RampBusy = MAKE_STATUS(kStatusGroup_FLEXIO_CPWM, 0), /*!< A ramp is streaming. */
+    kStatus_FLEXIO_CPWM_RampIdle = MAKE_STATUS(kStatusGroup_FLEXIO_CPWM, 1), /*!< No ramp prepared. */
+    kStatus_FLEXIO_CPWM_RampTableTooSmall =
+        MAKE_STATUS(kStatusGroup_FLEXIO_CPWM, 2), /*!< Ramp table cannot hold all steps. */
+    kStatus_FLEXIO_CPWM_BurstBusy     = MAKE_STATUS(kStatusGroup_FLEXIO_CPWM, 3), /*!< A burst is running. */
+    kStatus_FLEXIO_CPWM_BurstComplete = MAKE_STATUS(kStatusGroup_FLEXIO_CPWM, 4), /*!< Burst finished. */
+    kStatus_FLEXIO_CPWM_ShadowMismatch =
+        MAKE_STATUS(kStatusGroup_FLEXIO_CPWM, 5), /*!< Registers differ from the shadow state. */
+};
+
+/*! @brief Largest burst, the burst timer counts both period timer edges with a 16-bit counter. */
+#define FLEXIO_CPWM_MAX_BURST_PERIODS ((FLEXIO_TIMCMP_CMP_MASK + 1U) / 2U)
+
+/*! @brief Fault bit of the period timer in the FLEXIO_CPWM_CheckShadow() mask, channel n uses bit n. */
+#define FLEXIO_CPWM_FAULT_PERIOD (1UL << 8U)
+/*! @brief Fault bit of state shifter n in the FLEXIO_CPWM_CheckShadow() mask. */
+#define FLEXIO_CPWM_FAULT_SHIFTER(n) (1UL << (16U + (uint32_t)(n)))
+
+/*! @brief Duty ramp profile. */
+typedef enum _flexio_cpwm_ramp_profile
+{
+    kFLEXIO_CPWM_RampLinear = 0U, /*!< Duty changes by the same amount every step. */
+    kFLEXIO_CPWM_RampSCurve,      /*!< Smoothstep profile, zero slope at both ends. */
+} flexio_cpwm_ramp_profile_t;
+
+/*! @brief PWM engine configuration. */
+typedef struct _flexio_cpwm_config
+{
+    uint8_t periodTimer;                            /*!< FlexIO timer which sets the PWM period. */
+    uint8_t channelCount;                           /*!< Number of PWM channels. */
+    uint8_t channelTimer[FLEXIO_CPWM_MAX_CHANNELS]; /*!< FlexIO timer driving each channel. */
+    uint32_t srcClock_Hz;                           /*!< FlexIO clock frequency. */
+    uint32_t freq_Hz;                               /*!< PWM frequency, 0 keeps the period already programmed. */
+    uint8_t rampDmaChannel;                         /*!< eDMA channel used to stream duty ramps. */
+    uint8_t burstTimer;                             /*!< Spare FlexIO timer counting burst periods. */
+    uint8_t stateShifterMask;                       /*!< State shifters checked by FLEXIO_CPWM_CheckShadow(). */
+} flexio_cpwm_config_t;
+
+/*! @brief One step of a precomputed ramp, written by eDMA at every period-timer expiry. */
+typedef struct _flexio_cpwm_ramp_step
+{
+    uint32_t compare;     /*!< TIMCMP value of the ramped channel. */
+    uint32_t statusClear; /*!< TIMSTAT write which acknowledges the period timer. */
+} flexio_cpwm_ramp_step_t;
+
+/*! @brief Duty ramp configuration. */
+typedef struct _flexio_cpwm_ramp_config
+{
+    uint8_t channel;                    /*!< Engine channel index to ramp. */
+    uint8_t startDuty;                  /*!< Start duty in unit of %, [0, 100]. */
+    uint8_t targetDuty;                 /*!< Target duty in unit of %, [0, 100]. */
+    flexio_cpwm_ramp_profile_t profile; /*!< Ramp profile. */
+    uint32_t periods;                   /*!< Ramp length in PWM periods, used when duration_us is 0. */
+    uint32_t duration_us;               /*!< Ramp length in microseconds. */
+} flexio_cpwm_ramp_config_t;
+
+/* Forward declaration of the handle type */
+typedef struct _flexio_cpwm_handle flexio_cpwm_handle_t;
+
+/*! @brief Engine event callback, called from the FlexIO interrupt. */
+typedef void (*flexio_cpwm_callback_t)(flexio_cpwm_handle_t *handle, status_t status, void *userData);
+
+/*! @brief Output of a channel timer. */
+typedef enum _flexio_cpwm_channel_mode
+{
+    kFLEXIO_CPWM_ChannelLow = 0U, /*!< Timer disabled, output parked low, 0%. */
+    kFLEXIO_CPWM_ChannelHigh,     /*!< Timer disabled, output parked high, 100%. */
+    kFLEXIO_CPWM_ChannelToggling, /*!< Timer toggling, center aligned pulse. */
+} flexio_cpwm_channel_mode_t;
+
+/*!
+ * @brief Shadow of what a channel timer was last written with, see FLEXIO_CPWM_GetShadow().
+ *
+ * onTicks is the on-time the compare produces, it can be one clock below the requested one.
+ */
+typedef struct _flexio_cpwm_shadow
+{
+    uint32_t onTicks;                /*!< On-time in FlexIO clocks. */
+    uint32_t periodTicks;            /*!< PWM period of the write in FlexIO clocks. */
+    uint32_t phaseTicks;             /*!< Period start to rising edge in FlexIO clocks, 0 when parked. */
+    flexio_cpwm_channel_mode_t mode; /*!< Output of the timer. */
+    uint32_t timcmp;                 /*!< TIMCMP written, meaningful while toggling. */
+    uint32_t timctl;                 /*!< TIMCTL written. */
+    uint32_t generation;             /*!< Writes of the channel since FLEXIO_CPWM_Init(). */
+} flexio_cpwm_shadow_t;
+
+/*! @brief Per channel state. */
+typedef struct _flexio_cpwm_channel
+{
+    uint8_t timer;               /*!< FlexIO timer index. */
+    uint32_t timcfg;             /*!< TIMCFG value set up by BOARD_InitPeripherals(). */
+    uint32_t timctl;             /*!< TIMCTL value while the channel is toggling. */
+    uint32_t onTicks;            /*!< Committed on-time in FlexIO clocks. */
+    uint32_t stagedOnTicks;      /*!< On-time waiting for the next period boundary. */
+    uint32_t retimeOnTicks;      /*!< On-time on the new clock, see FLEXIO_CPWM_PrepareClockChange(). */
+    flexio_cpwm_shadow_t shadow; /*!< Last write of the timer. */
+} flexio_cpwm_channel_t;
+
+/*! @brief PWM engine handle. */
+struct _flexio_cpwm_handle
+{
+    FLEXIO_Type *base;                                       /*!< FlexIO instance. */
+    uint32_t srcClock_Hz;                                    /*!< FlexIO clock frequency. */
+    uint32_t periodTicks;                                    /*!< PWM period in FlexIO clocks. */
+    uint8_t periodTimer;                                     /*!< Period timer index. */
+    uint8_t channelCount;                                    /*!< Number of channels. */
+    flexio_cpwm_channel_t channel[FLEXIO_CPWM_MAX_CHANNELS]; /*!< Channel state. */
+    volatile uint32_t stagedMask;                            /*!< Channels with a staged update. */
+
+    uint8_t rampDmaChannel;                   /*!< eDMA channel used for ramps. */
+    uint8_t rampChannel;                      /*!< Channel of the prepared ramp. */
+    volatile bool rampActive;                 /*!< Ramp is streaming. */
+    uint32_t rampTargetTicks;                 /*!< On-time reached at the end of the ramp. */
+    const flexio_cpwm_ramp_step_t *rampSteps; /*!< Prepared ramp table. */
+    uint32_t rampStepCount;                   /*!< Number of steps in the ramp table. */
+
+    uint8_t burstTimer;          /*!< Timer counting burst periods. */
+    volatile bool burstActive;   /*!< Burst is running. */
+    uint32_t burstIdleMask;      /*!< Channels parked high after the burst. */
+    uint32_t periodTimctl;       /*!< Free running TIMCTL of the period timer. */
+    uint32_t periodTimcfg;       /*!< Free running TIMCFG of the period timer. */
+    uint8_t periodPin;           /*!< Pin of the period timer output. */
+    uint32_t risingMask;         /*!< Channels whose period starts at the rising period timer edge. */
+    volatile bool periodGated;   /*!< Period timer gated by the burst timer until FLEXIO_CPWM_StopBurst(). */
+
+    uint8_t stateShifterMask;                      /*!< State shifters checked against stateShiftbuf. */
+    uint32_t stateShiftbuf[FLEXIO_SHIFTBUF_COUNT]; /*!< SHIFTBUF of the state shifters at init. */
+
+    uint32_t retimeSrcClock_Hz; /*!< FlexIO clock of a prepared clock change, 0 if none. */
+    uint32_t retimePeriodTicks; /*!< PWM period on the new clock. */
+
+    flexio_cpwm_callback_t callback; /*!< Event callback. */
+    void *userData;                  /*!< Callback parameter. */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus*/
+
+/*!
+ * @brief Gets the default engine configuration matching the BOARD_InitPeripherals() state machine.
+ *
+ * Timer 4 is the period timer, timers 0 and 2 drive the two channels, shifters 0 to 4 hold the
+ * states. srcClock_Hz and freq_Hz are left zero and must be filled by the caller.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void FLEXIO_CPWM_GetDefaultConfig(flexio_cpwm_config_t *config);
+
+/*!
+ * @brief Attaches the engine to a FlexIO instance already configured by BOARD_InitPeripherals().
+ *
+ * The current channel compares are read back as the committed duty, so the outputs keep running.
+ * When freq_Hz gives a period different from the running one, e.g. after a FlexIO clock change,
+ * the period is reprogrammed and every channel compare is rescaled to keep its duty ratio.
+ *
+ * @param handle Engine handle.
+ * @param base   FlexIO peripheral base address.
+ * @param config Engine configuration.
+ * @retval kStatus_Success The engine is ready.
+ * @retval kStatus_InvalidArgument The frequency cannot be produced with a 16-bit period timer.
+ * @retval kStatus_Busy The period or burst timer flag is owned by another FlexIO handler.
+ */
+status_t FLEXIO_CPWM_Init(flexio_cpwm_handle_t *handle, FLEXIO_Type *base, const flexio_cpwm_config_t *config);
+
+/*!
+ * @brief Stages a new on-time for a channel, in FlexIO clocks.
+ *
+ * The value is written by FLEXIO_CPWM_Update() at the next period boundary.
+ *
+ * @param handle  Engine handle.
+ * @param channel Engine channel index.
+ * @param onTicks On-time in FlexIO clocks, [0, periodTicks].
+ * @retval kStatus_Success The value is staged.
+ * @retval kStatus_FLEXIO_CPWM_RampBusy The channel is being ramped.
+ */
+status_t FLEXIO_CPWM_SetDutyTicks(flexio_cpwm_handle_t *handle, uint8_t channel, uint32_t onTicks);
+
+/*!
+ * @brief Stages a new duty for a channel.
+ *
+ * @param handle  Engine handle.
+ * @param channel Engine channel index.
+ * @param duty    Duty in unit of %, [0, 100].
+ * @retval kStatus_Success The value is staged.
+ * @retval kStatus_FLEXIO_CPWM_RampBusy The channel is being ramped.
+ */
+status_t FLEXIO_CPWM_SetDuty(flexio_cpwm_handle_t *handle, uint8_t channel, uint8_t duty);
+
+/*!
+ * @brief Commits the staged channels at the next period boundary.
+ *
+ * Clears the period timer flag and enables its interrupt. FLEXIO_CPWM_HandleIRQ() writes the staged
+ * channels whose period starts at the edge it handles, and disables the interrupt once none is left.
+ * The handler must run within half a period of the edge.
+ *
+ * @param handle Engine handle.
+ */
+void FLEXIO_CPWM_Update(flexio_cpwm_handle_t *handle);
+
+/*!
+ * @brief Writes the staged channels immediately, without waiting for a period boundary.
+ *
+ * Meant for start-up, before the outputs are routed to the pins, or while the period timer is
+ * stopped. On a running output the compare may change in the middle of a period.
+ *
+ * @param handle Engine handle.
+ */
+void FLEXIO_CPWM_Commit(flexio_cpwm_handle_t *handle);
+
+/*!
+ * @brief Commits the staged channels of several engines in the same PWM period.
+ *
+ * The engines must run on one FlexIO instance, each with its own period timer. Nothing starts
+ * timers of different instances in sync, so those are refused. On one instance, the period timers
+ * set up before BOARD_InitPeripherals() sets FLEXEN start on the same FlexIO clock; with the same
+ * period their edges coincide. With interrupts masked, the first engine's next period timer edge
+ * is awaited, then the staged compares of every engine are written and all take effect at the same
+ * period boundary. The wait lasts up to half a PWM period and the writes must end within the half
+ * period after the edge.
+ *
+ * @param handles Engine handles, the first one gives the period edge.
+ * @param count   Number of engines.
+ * @retval kStatus_Success The staged channels are written.
+ * @retval kStatus_InvalidArgument The engines differ in FlexIO instance, FlexIO clock or period.
+ * @retval kStatus_FLEXIO_CPWM_RampBusy A ramp is streaming on one of the engines.
+ * @retval kStatus_FLEXIO_CPWM_BurstBusy A burst is running on one of the engines.
+ */
+status_t FLEXIO_CPWM_CommitGroup(flexio_cpwm_handle_t *const handles[], uint8_t count);
+
+/*!
+ * @brief Changes the PWM frequency on the running FlexIO clock, keeping the duty of every channel.
+ *
+ * The period and channel compares are written at once, staged on-times included. Called right
+ * after a period timer edge, e.g. from its interrupt, the new period is complete from the next
+ * period boundary on; the period in progress may be asymmetric by one half period.
+ *
+ * @param handle  Engine handle.
+ * @param freq_Hz New PWM frequency.
+ * @retval kStatus_Success The new period is written.
+ * @retval kStatus_FLEXIO_CPWM_RampBusy A ramp is streaming.
+ * @retval kStatus_FLEXIO_CPWM_BurstBusy A burst is running.
+ * @retval kStatus_InvalidArgument The frequency cannot be produced with a 16-bit period timer.
+ */
+status_t FLEXIO_CPWM_SetFrequency(flexio_cpwm_handle_t *handle, uint32_t freq_Hz);
+
+/*!
+ * @brief Gets the committed on-time of a channel.
+ *
+ * @param handle  Engine handle.
+ * @param channel Engine channel index.
+ * @return On-time in FlexIO clocks.
+ */
+static inline uint32_t FLEXIO_CPWM_GetDutyTicks(flexio_cpwm_handle_t *handle, uint8_t channel)
+{
+    return handle->channel[channel].onTicks;
+}
+
+/*!
+ * @brief Gets the channels whose period starts at the period timer edge which just passed.
+ *
+ * Reads the period timer output pin, valid until the next edge, half a period later.
+ *
+ * @param handle Engine handle.
+ * @return Bit n set for channel n.
+ */
+static inline uint32_t FLEXIO_CPWM_GetBoundaryMask(const flexio_cpwm_handle_t *handle)
+{
+#if defined(FSL_FEATURE_FLEXIO_HAS_PIN_STATUS) && FSL_FEATURE_FLEXIO_HAS_PIN_STATUS
+    /* The pin is the period timer output, inverted by its pin polarity. */
+    bool rising = (0U != (handle->base->PIN & (1UL << handle->periodPin))) !=
+                  (0U != (handle->periodTimctl & FLEXIO_TIMCTL_PINPOL_MASK));
+
+    return rising ? handle->risingMask : (~handle->risingMask & ((1UL << handle->channelCount) - 1U));
+#else
+    return (1UL << handle->channelCount) - 1U;
+#endif
+}
+
+/*!
+ * @brief Gets the number of writes of a channel timer, from RAM.
+ *
+ * A control loop compares it with a saved value to learn that the output changed.
+ *
+ * @param handle  Engine handle.
+ * @param channel Engine channel index.
+ * @return Writes since FLEXIO_CPWM_Init().
+ */
+static inline uint32_t FLEXIO_CPWM_GetGeneration(flexio_cpwm_handle_t *handle, uint8_t channel)
+{
+    return handle->channel[channel].shadow.generation;
+}
+
+/*!
+ * @brief Gets the shadow of a channel timer, from RAM.
+ *
+ * The copy is taken with interrupts masked, a commit of the FlexIO interrupt cannot tear it.
+ * While a ramp streams the channel, the shadow holds the first ramp step.
+ *
+ * @param handle  Engine handle.
+ * @param channel Engine channel index.
+ * @param shadow  Pointer to the shadow copy.
+ */
+void FLEXIO_CPWM_GetShadow(flexio_cpwm_handle_t *handle, uint8_t channel, flexio_cpwm_shadow_t *shadow);
+
+/*!
+ * @brief Compares the shadow state with the FlexIO registers, call it from the main loop.
+ *
+ * TIMCTL and TIMCMP of every channel timer, TIMCMP, TIMCTL and TIMCFG of the period timer and
+ * SHIFTBUF of the state shifters are read back, one timer at a time with interrupts masked. A
+ * channel streamed by a ramp and the period timer gated by a burst are skipped. The registers are
+ * only reported, not repaired.
+ *
+ * @param handle    Engine handle.
+ * @param faultMask Bit n for channel n, FLEXIO_CPWM_FAULT_PERIOD and FLEXIO_CPWM_FAULT_SHIFTER(),
+ *                  may be NULL.
+ * @retval kStatus_Success Every register matches.
+ * @retval kStatus_FLEXIO_CPWM_ShadowMismatch A register differs, see faultMask.
+ */
+status_t FLEXIO_CPWM_CheckShadow(flexio_cpwm_handle_t *handle, uint32_t *faultMask);
+
+/*!
+ * @brief Converts an on-time to the channel timer compare value.
+ *
+ * @param periodTicks PWM period in FlexIO clocks.
+ * @param onTicks     On-time in FlexIO clocks, (0, periodTicks - 2].
+ * @return TIMCMP value.
+ */
+static inline uint32_t FLEXIO_CPWM_OnTicksToCompare(uint32_t periodTicks, uint32_t onTicks)
+{
+    return ((periodTicks - onTicks) >> 1U) - 1U;
+}
+
+/*!
+ * @brief Precomputes a duty ramp into a compare table.
+ *
+ * The table holds one step per period-timer expiry, i.e. two steps per PWM period.
+ *
+ * @param handle   Engine handle.
+ * @param config   Ramp configuration.
+ * @param steps    Table to fill, must stay valid until the ramp completes.
+ * @param maxSteps Number of entries in the table.
+ * @retval kStatus_Success The ramp is ready to start.
+ * @retval kStatus_FLEXIO_CPWM_RampBusy Another ramp is streaming.
+ * @retval kStatus_FLEXIO_CPWM_RampTableTooSmall The table is too short for the ramp length.
+ * @retval kStatus_InvalidArgument Invalid channel, duty or length.
+ */
+status_t FLEXIO_CPWM_PrepareRamp(flexio_cpwm_handle_t *handle,
+                                 const flexio_cpwm_ramp_config_t *config,
+                                 flexio_cpwm_ramp_step_t *steps,
+                                 uint32_t maxSteps);
+
+/*!
+ * @brief Starts streaming the prepared ramp. No CPU work is needed until it completes.
+ *
+ * @param handle Engine handle.
+ * @retval kStatus_Success The ramp started.
+ * @retval kStatus_FLEXIO_CPWM_RampIdle No ramp is prepared.
+ * @retval kStatus_FLEXIO_CPWM_RampBusy The ramp is already streaming.
+ */
+status_t FLEXIO_CPWM_StartRamp(flexio_cpwm_handle_t *handle);
+
+/*!
+ * @brief Aborts a ramp. The channel keeps the last streamed duty, which becomes the committed duty.
+ *
+ * @param handle Engine handle.
+ */
+void FLEXIO_CPWM_AbortRamp(flexio_cpwm_handle_t *handle);
+
+/*!
+ * @brief Gets the ramp status, handing the channel back to the regular update path once done.
+ *
+ * @param handle Engine handle.
+ * @retval kStatus_Success No ramp is streaming.
+ * @retval kStatus_FLEXIO_CPWM_RampBusy The ramp is streaming.
+ */
+status_t FLEXIO_CPWM_GetRampStatus(flexio_cpwm_handle_t *handle);
+
+/*!
+ * @brief Installs the event callback, e.g. for kStatus_FLEXIO_CPWM_BurstComplete.
+ *
+ * @param handle   Engine handle.
+ * @param callback Callback function, NULL to remove.
+ * @param userData Callback parameter.
+ */
+void FLEXIO_CPWM_SetCallback(flexio_cpwm_handle_t *handle, flexio_cpwm_callback_t callback, void *userData);
+
+/*!
+ * @brief Emits exactly pulseCount center aligned periods, then parks the outputs.
+ *
+ * The burst timer counts the period timer edges and gates the period timer off at the end of the
+ * last period, the pulse count does not depend on interrupt latency. The interrupt only parks the
+ * outputs at their idle level and reports kStatus_FLEXIO_CPWM_BurstComplete through the callback.
+ *
+ * @param handle     Engine handle.
+ * @param pulseCount Number of PWM periods, [1, FLEXIO_CPWM_MAX_BURST_PERIODS].
+ * @param idleMask   Bit n set parks channel n high after the burst, cleared parks it low.
+ * @retval kStatus_Success The burst started.
+ * @retval kStatus_FLEXIO_CPWM_BurstBusy A burst is already running.
+ * @retval kStatus_FLEXIO_CPWM_RampBusy A ramp is streaming.
+ * @retval kStatus_InvalidArgument pulseCount is out of range.
+ */
+status_t FLEXIO_CPWM_StartBurst(flexio_cpwm_handle_t *handle, uint32_t pulseCount, uint32_t idleMask);
+
+/*!
+ * @brief Stops a running burst and returns the period timer to free running operation.
+ *
+ * Also called after a completed burst to resume continuous output with the committed duties.
+ *
+ * @param handle Engine handle.
+ */
+void FLEXIO_CPWM_StopBurst(flexio_cpwm_handle_t *handle);
+
+/*!
+ * @brief Computes the compares for a new FlexIO clock, first step of a clock change.
+ *
+ * A FlexIO clock change keeps the PWM frequency and every duty ratio when it is done in three
+ * steps: FLEXIO_CPWM_PrepareClockChange() computes the new period and channel on-times, then,
+ * with interrupts masked, FLEXIO_CPWM_AlignClockChange() waits for a period timer edge, the
+ * caller switches the clock and FLEXIO_CPWM_CompleteClockChange() writes the compares. Every timer
+ * counts the same clock, so the half period running across the switch is stretched or shrunk as a
+ * whole and keeps its duty ratio, the compares take effect at the next edge. Staged updates are
+ * folded into the change.
+ *
+ * @param handle         Engine handle.
+ * @param newSrcClock_Hz FlexIO clock frequency after the change.
+ * @retval kStatus_Success The change is prepared.
+ * @retval kStatus_FLEXIO_CPWM_RampBusy A ramp is streaming.
+ * @retval kStatus_FLEXIO_CPWM_BurstBusy A burst is running.
+ * @retval kStatus_InvalidArgument The PWM frequency cannot be produced from the new clock.
+ */
+status_t FLEXIO_CPWM_PrepareClockChange(flexio_cpwm_handle_t *handle, uint32_t newSrcClock_Hz);
+
+/*!
+ * @brief Waits for the next period timer edge, call it with interrupts masked.
+ *
+ * Returns immediately when the period timer is stopped, e.g. parked after a burst.
+ *
+ * @param handle Engine handle.
+ */
+void FLEXIO_CPWM_AlignClockChange(flexio_cpwm_handle_t *handle);
+
+/*!
+ * @brief Writes the compares prepared for the new clock, call it right after the clock switch.
+ *
+ * @param handle Engine handle.
+ */
+void FLEXIO_CPWM_CompleteClockChange(flexio_cpwm_handle_t *handle);
+
+/*!
+ * @brief Drops a prepared clock change.
+ *
+ * @param handle Engine handle.
+ */
+void FLEXIO_CPWM_CancelClockChange(flexio_cpwm_handle_t *handle);
+
+/*!
+ * @brief Engine interrupt handler, registered through FLEXIO_RegisterFlagHandlerIRQ().
+ *
+ * @param base   FlexIO peripheral base address.
+ * @param handle Engine handle.
+ */
+void FLEXIO_CPWM_HandleIRQ(void *base, void *handle);
+
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus*/
+
+/*! @} */
+
+#endif /* FLEXIO_CPWM_H_ */
@@ -9,200 +9,714 @@
 #include "fsl_device_registers.h"
 #include "fsl_debug_console.h"
 #include "fsl_flexio.h"
+#include "flexio_cpwm.h"
+#include "app_lowpower.h"
+#include "app_clock.h"
+#include "app_placement.h"
+#include "app_bench.h"
+#include "app_timing.h"
+#include "app_mailbox.h"
+#include "app_log.h"
+#include "app_telemetry.h"
+#include "app_command.h"
+#include "app_sched.h"
+#include "app_pattern.h"
+#include "app_capture.h"
+#include "boot_multicore_slave.h"
 #include "pin_mux.h"
 #include "clock_config.h"
 #include "peripherals.h"
 #include "board.h"
+#include "startup_init.h"
 
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
-#define DEMO_FLEXIO_BASEADDR  FLEXIO0
-#define DEMO_FLEXIO_OUTPUTPIN 0U /* Select FXIO_D0 as PWM output */
-#define DEMO_FLEXIO_TIMER_CH  0U /* Flexio timer0 used */
+#define DEMO_FLEXIO_BASEADDR FLEXIO0
 
 #define DEMO_FLEXIO_CLOCK_FREQUENCY CLOCK_GetFlexioClkFreq()
-#define DEMO_FLEXIO_FREQUENCY       100000U
 
-#define FLEXIO_MAX_FREQUENCY (DEMO_FLEXIO_CLOCK_FREQUENCY / 2U)
-#define FLEXIO_MIN_FREQUENCY (DEMO_FLEXIO_CLOCK_FREQUENCY / 512U)
+/* Center aligned PWM produced by the state machine of BOARD_InitPeripherals() */
+#define DEMO_CPWM_FREQUENCY 120000U
+/* Soft start of channel 0, from 0% to DEMO_CPWM_SOFT_START_DUTY in DEMO_CPWM_SOFT_START_PERIODS periods */
+#define DEMO_CPWM_SOFT_START_CHANNEL 0U
+#define DEMO_CPWM_SOFT_START_DUTY    75U
+#define DEMO_CPWM_SOFT_START_PERIODS 500U
 
-/* flexio timer number */
-#define FLEXIO_TIMER_CHANNELS (8)
+/* Bytes of lazy .bss zeroed per step while the soft start runs */
+#define DEMO_LAZY_BSS_STEP 1024U
+
+/* FlexIO clock once the soft start is done, FRO_HF 48 MHz keeps running in deep sleep */
+#define DEMO_LIGHT_LOAD_FLEXIO_CLOCK   kFRO_HF_to_FLEXIO
+#define DEMO_LIGHT_LOAD_FLEXIO_DIVIDER 1U
+
+/* Idle mode of the main loop, the core only wakes up to commit queued duty updates */
+#define DEMO_LOWPOWER_MODE kAPP_LowPowerDeepSleep
+
+/* 1 prints the cycles of the duty update path, warm and with a flushed code cache */
+#ifndef DEMO_PLACEMENT_BENCHMARK
+#define DEMO_PLACEMENT_BENCHMARK 0
+#endif
+#define DEMO_PLACEMENT_BENCHMARK_CHANNEL    1U
+#define DEMO_PLACEMENT_BENCHMARK_ITERATIONS 256U
+
+/* Flash cache and MPU setup once the PWM runs, see app_timing.h */
+#define DEMO_TIMING_PRESET kAPP_TimingLockedCache
+
+/* 1 prints the update interrupt jitter under background memory load for every timing preset */
+#ifndef DEMO_TIMING_BENCHMARK
+#define DEMO_TIMING_BENCHMARK 0
+#endif
+#define DEMO_TIMING_BENCHMARK_ITERATIONS  256U
+#define DEMO_TIMING_BENCHMARK_DMA_CHANNEL 14U
+
+/* 1 prints the cycles of memcpy/memset/memmove/memcmp against the byte loops they replace */
+#ifndef DEMO_MEMORY_BENCHMARK
+#define DEMO_MEMORY_BENCHMARK 0
+#endif
+#define DEMO_MEMORY_BENCHMARK_ITERATIONS 64U
+
+/*
+ * 1 hands FLEXIO0 and the PWM loop to core1 (frdmmcxn947_flexio_state_mode_center_aligned_pwm_core1.c),
+ * core0 keeps the debug console. Needs the core1 image linked in as a slave project.
+ */
+#ifndef DEMO_DUAL_CORE
+#define DEMO_DUAL_CORE 0
+#endif
+/* Core1 telemetry snapshots (100 per second) between two console reports */
+#define DEMO_DUAL_CORE_REPORT_DIVIDER 100U
+
+/*
+ * 1 hands the debug UART over to the binary telemetry stream once the PWM runs, see app_telemetry.h.
+ * The console text stops there, capture with tools/telemetry_decode.py at DEMO_TELEMETRY_BAUDRATE.
+ */
+#ifndef DEMO_TELEMETRY
+#define DEMO_TELEMETRY 0
+#endif
+#define DEMO_TELEMETRY_BAUDRATE    APP_TELEMETRY_DEFAULT_BAUDRATE
+#define DEMO_TELEMETRY_DMA_REQUEST kDma0RequestMuxLpFlexcomm4Tx
+
+/*
+ * 1 takes live duty/frequency commands on the debug UART receiver, see app_command.h. The main loop
+ * then idles in sleep instead of deep sleep, the receive eDMA stops in deep sleep.
+ */
+#ifndef DEMO_COMMAND
+#define DEMO_COMMAND 0
+#endif
+#define DEMO_COMMAND_DMA_REQUEST kDma0RequestMuxLpFlexcomm4Rx
+
+/*
+ * 1 plays a triangle duty profile on DEMO_PLACEMENT_BENCHMARK_CHANNEL, one step per PWM period,
+ * from the period-scheduled change queue, see app_sched.h.
+ */
+#ifndef DEMO_SCHEDULE
+#define DEMO_SCHEDULE 0
+#endif
+#define DEMO_SCHEDULE_STEPS 1000U
+/* Periods between posting the profile and its first step */
+#define DEMO_SCHEDULE_LEAD 8U
+
+/*
+ * 1 replaces the PWM with a 4-bit counter on FXIO_D24..D27 and its sample clock on FXIO_D28, fed by
+ * eDMA from a ping-pong buffer, see app_pattern.h. FLEXIO0 is reset, the PWM stops for good.
+ */
+#ifndef DEMO_PATTERN
+#define DEMO_PATTERN 0
+#endif
+#define DEMO_PATTERN_RATE_HZ    10000000U
+#define DEMO_PATTERN_HALF_WORDS 256U
+/* Halves refilled between two console reports */
+#define DEMO_PATTERN_REPORT_REFILLS 100000U
+
+/*
+ * 1 records FXIO_D24..D31 around a rising edge of the channel 0 output once the PWM runs, and dumps
+ * the samples on the debug console, see app_capture.h. tools/capture_vcd.py turns the dump into VCD.
+ */
+#ifndef DEMO_CAPTURE
+#define DEMO_CAPTURE 0
+#endif
+#define DEMO_CAPTURE_RATE_HZ 10000000U
+#define DEMO_CAPTURE_WORDS   1024U
+/* Words after the trigger, the trigger lands a quarter into the record */
+#define DEMO_CAPTURE_POST_TRIGGER_WORDS 768U
+/* Polls without a trigger before the capture is given up */
+#define DEMO_CAPTURE_MAX_POLLS 10000000U
+
+/*
+ * 1 compares the PWM registers with the engine shadow state at every main loop pass and reports
+ * mismatches on the debug console, see FLEXIO_CPWM_CheckShadow().
+ */
+#ifndef DEMO_SHADOW_CHECK
+#define DEMO_SHADOW_CHECK 1
+#endif
+
+#if (defined(DEMO_COMMAND) && DEMO_COMMAND) && (defined(DEMO_TELEMETRY) && DEMO_TELEMETRY)
+#error "DEMO_COMMAND and DEMO_TELEMETRY both take the debug UART over"
+#endif
+#if (defined(DEMO_PATTERN) && DEMO_PATTERN) &&                                                 \
+    ((defined(DEMO_TELEMETRY) && DEMO_TELEMETRY) || (defined(DEMO_COMMAND) && DEMO_COMMAND) || \
+     (defined(DEMO_SCHEDULE) && DEMO_SCHEDULE))
+#error "DEMO_PATTERN stops the PWM the other modes drive"
+#endif
+#if (defined(DEMO_CAPTURE) && DEMO_CAPTURE) && (defined(DEMO_TELEMETRY) && DEMO_TELEMETRY)
+#error "DEMO_CAPTURE and DEMO_TELEMETRY both use FlexIO timer 6"
+#endif
+#if (defined(DEMO_COMMAND) && DEMO_COMMAND) && defined(DEBUG_CONSOLE_TRANSFER_NON_BLOCKING)
+#error "DEMO_COMMAND needs the LPUART interrupt, which the non-blocking console owns"
+#endif
+
+#if (defined(DEMO_DUAL_CORE) && DEMO_DUAL_CORE) && !defined(__MULTICORE_MASTER)
+#error "DEMO_DUAL_CORE needs the core1 image, build as multicore master"
+#endif
 
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
 /*!
- * @brief Configures the timer as a 8-bits PWM mode to generate the PWM waveform
+ * @brief Starts the center aligned PWM before the boot clocks and the debug console.
  *
- * @param freq_Hz PWM frequency in hertz, range is [FLEXIO_MIN_FREQUENCY, FLEXIO_MAX_FREQUENCY]
- * @param duty Specified duty in unit of %, with a range of [0, 100]
+ * Runs on the reset clocks, with FlexIO on FRO_HF. The outputs start at a safe duty and are
+ * routed to the pins only once FlexIO is configured, so the first edge is well defined.
  */
-static status_t flexio_pwm_init(uint32_t freq_Hz, uint32_t duty);
+static void DEMO_FastBootPwm(void);
 
 /*!
- * @brief Set PWM output in idle status (high or low).
- *
- * @param base               FlexIO peripheral base address
- * @param timerChannel       FlexIO timer channel
- * @param idleStatus         True: PWM output is high in idle status; false: PWM output is low in idle status
+ * @brief Retimes the PWM engine across FlexIO clock changes.
  */
-static void FLEXIO_SetPwmOutputToIdle(FLEXIO_Type *base, uint8_t timerChannel, bool idleStatus);
+static status_t DEMO_PwmClockNotify(app_clock_event_t event, uint32_t newFreq_Hz, void *userData);
 
-#if defined(FSL_FEATURE_FLEXIO_HAS_PIN_STATUS) && FSL_FEATURE_FLEXIO_HAS_PIN_STATUS
+#if (defined(DEMO_PLACEMENT_BENCHMARK) && DEMO_PLACEMENT_BENCHMARK)
 /*!
- * @brief Get the pwm dutycycle value.
- *
- * @param base        FlexIO peripheral base address
- * @param timerChannel  FlexIO timer channel
- * @param channel     FlexIO as pwm output channel number
+ * @brief Prints the update path cycles for the current memory placement.
+ */
+static void DEMO_PlacementBenchmark(void);
+#endif
+
+/*!
+ * @brief Runs the duty update path once, for the LPCAC of the locked cache preset.
+ */
+static void DEMO_TimingWarmup(void *userData);
+
+#if (defined(DEMO_TIMING_BENCHMARK) && DEMO_TIMING_BENCHMARK)
+/*!
+ * @brief Prints the update interrupt jitter under each timing preset.
+ */
+static void DEMO_TimingBenchmark(void);
+#endif
+
+#if (defined(DEMO_MEMORY_BENCHMARK) && DEMO_MEMORY_BENCHMARK)
+/*!
+ * @brief Prints the memory function cycles for a few sizes, aligned and unaligned.
+ */
+static void DEMO_MemoryBenchmark(void);
+#endif
+
+#if (defined(DEMO_DUAL_CORE) && DEMO_DUAL_CORE)
+/*!
+ * @brief Core0 side of the dual-core mode, does not return.
  *
- * @return Current channel dutycycle value.
+ * Sets up the clocks and the debug console, releases core1 with the shared mailbox, then forwards
+ * commands and reports the core1 telemetry. FLEXIO0 is left to core1.
  */
-static uint8_t PWM_GetPwmOutputState(FLEXIO_Type *base, uint8_t timerChannel, uint8_t channel);
+static void DEMO_DualCoreMain(void);
 #endif
 
+#if (defined(DEMO_TELEMETRY) && DEMO_TELEMETRY)
 /*!
- * @brief Get pwm duty cycle value.
+ * @brief Releases the debug console and streams the PWM telemetry on its UART, does not return.
  */
-static uint8_t s_flexioGetPwmDutyCycle[FLEXIO_TIMER_CHANNELS] = {0};
+static void DEMO_TelemetryMain(void);
+#endif
+
+#if (defined(DEMO_COMMAND) && DEMO_COMMAND)
+/*!
+ * @brief Acknowledges every received command on the debug console.
+ */
+static void DEMO_CommandResult(const app_command_t *command, status_t status, void *userData);
+#endif
+
+#if (defined(DEMO_SCHEDULE) && DEMO_SCHEDULE)
+/*!
+ * @brief Starts the period scheduler and posts the triangle duty profile.
+ */
+static void DEMO_ScheduleStart(void);
+
+/*!
+ * @brief Flags the end of the profile for the main loop, from the FlexIO interrupt.
+ */
+static void DEMO_ScheduleDone(app_sched_event_t *event, status_t status, void *userData);
+#endif
+
+#if (defined(DEMO_PATTERN) && DEMO_PATTERN)
+/*!
+ * @brief Replaces the PWM with the counter pattern and keeps it fed, does not return.
+ */
+static void DEMO_PatternMain(void);
+#endif
+
+#if (defined(DEMO_CAPTURE) && DEMO_CAPTURE)
+/*!
+ * @brief Records the PWM pins around a rising edge of channel 0 and dumps the samples as text.
+ */
+static void DEMO_CaptureDump(void);
+#endif
+
+#if (defined(DEMO_SHADOW_CHECK) && DEMO_SHADOW_CHECK)
+/*!
+ * @brief Checks the PWM registers against the engine shadow state, reports a new mismatch once.
+ */
+static void DEMO_ShadowCheck(void);
+#endif
+
+#if (defined(APP_LOG_ENABLE) && APP_LOG_ENABLE)
+/*!
+ * @brief Sends a block of the deferred log stream through the debug console.
+ */
+static void DEMO_LogWrite(const uint8_t *data, size_t size);
+#endif
 
 /*******************************************************************************
  * Variables
  *******************************************************************************/
+/* Touched by every update and by the FlexIO interrupt, kept in SRAMH */
+APP_HOT_BSS static flexio_cpwm_handle_t s_cpwmHandle;
+static app_clock_listener_t s_cpwmClockListener;
+
+/* Soft-start compare sequence, streamed by eDMA at every period timer expiry */
+static flexio_cpwm_ramp_step_t s_softStartSteps[2U * DEMO_CPWM_SOFT_START_PERIODS];
+
+#if (defined(DEMO_DUAL_CORE) && DEMO_DUAL_CORE)
+/* Shared with core1, SRAMH is left out of the core1 memory map */
+__attribute__((section(".bss.$SRAMH"))) static app_mailbox_t s_mailbox;
+#endif
+
+#if (defined(DEMO_SCHEDULE) && DEMO_SCHEDULE)
+/* Triangle duty profile and the event playing it */
+static app_sched_step_t s_scheduleSteps[DEMO_SCHEDULE_STEPS];
+static app_sched_event_t s_scheduleEvent;
+static volatile bool s_scheduleDone;
+static volatile status_t s_scheduleStatus;
+#endif
+
+#if (defined(DEMO_PATTERN) && DEMO_PATTERN)
+/* 0..15 on 4 pins, 8 samples per word, lowest nibble first */
+static const uint32_t s_patternCounter[] = {0x76543210U, 0xFEDCBA98U};
+static uint32_t s_patternBuffer[2U * DEMO_PATTERN_HALF_WORDS];
+#endif
+
+#if (defined(DEMO_CAPTURE) && DEMO_CAPTURE)
+static uint32_t s_captureBuffer[DEMO_CAPTURE_WORDS];
+#endif
+
+#if (defined(DEMO_SHADOW_CHECK) && DEMO_SHADOW_CHECK)
+/* Fault mask of the last check */
+static uint32_t s_shadowFaults;
+#endif
+
+/* Core cycles from main() entry to the PWM pins being routed, and the core clock they ran at */
+static uint32_t s_fastBootCycles;
+static uint32_t s_fastBootCoreClock;
 
 /*******************************************************************************
  * Code
  ******************************************************************************/
-static status_t flexio_pwm_init(uint32_t freq_Hz, uint32_t duty)
+static void DEMO_FastBootPwm(void)
 {
-    assert((freq_Hz < FLEXIO_MAX_FREQUENCY) && (freq_Hz > FLEXIO_MIN_FREQUENCY));
+    flexio_cpwm_config_t cpwmConfig;
 
-    uint32_t lowerValue = 0; /* Number of clock cycles in high logic state in one period */
-    uint32_t upperValue = 0; /* Number of clock cycles in low logic state in one period */
-    uint32_t sum        = 0; /* Number of clock cycles in one period */
-    flexio_timer_config_t fxioTimerConfig;
+    /* .data and .bss are initialized when main() is entered, count from here. */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    /* FRO_HF is running out of reset, use it undivided until the final clocks settle. */
+    CLOCK_SetClkDiv(kCLOCK_DivFlexioClk, 1u);
+    CLOCK_AttachClk(kFRO_HF_to_FLEXIO);
+
+    BOARD_InitBootPeripherals();
 
-    /* Configure the timer DEMO_FLEXIO_TIMER_CH for generating PWM */
-    fxioTimerConfig.triggerSelect   = FLEXIO_TIMER_TRIGGER_SEL_SHIFTnSTAT(0U);
-    fxioTimerConfig.triggerSource   = kFLEXIO_TimerTriggerSourceInternal;
-    fxioTimerConfig.triggerPolarity = kFLEXIO_TimerTriggerPolarityActiveLow;
-    fxioTimerConfig.pinConfig       = kFLEXIO_PinConfigOutput;
-    fxioTimerConfig.pinPolarity     = kFLEXIO_PinActiveHigh;
-    fxioTimerConfig.pinSelect       = DEMO_FLEXIO_OUTPUTPIN; /* Set pwm output */
-    fxioTimerConfig.timerMode       = kFLEXIO_TimerModeDisabled;
-    fxioTimerConfig.timerOutput     = kFLEXIO_TimerOutputOneNotAffectedByReset;
-    fxioTimerConfig.timerDecrement  = kFLEXIO_TimerDecSrcOnFlexIOClockShiftTimerOutput;
-    fxioTimerConfig.timerDisable    = kFLEXIO_TimerDisableNever;
-    fxioTimerConfig.timerEnable     = kFLEXIO_TimerEnabledAlways;
-    fxioTimerConfig.timerReset      = kFLEXIO_TimerResetNever;
-    fxioTimerConfig.timerStart      = kFLEXIO_TimerStartBitDisabled;
-    fxioTimerConfig.timerStop       = kFLEXIO_TimerStopBitDisabled;
+    FLEXIO_CPWM_GetDefaultConfig(&cpwmConfig);
+    cpwmConfig.srcClock_Hz = DEMO_FLEXIO_CLOCK_FREQUENCY;
+    cpwmConfig.freq_Hz     = DEMO_CPWM_FREQUENCY;
+    if (kStatus_Success == FLEXIO_CPWM_Init(&s_cpwmHandle, DEMO_FLEXIO_BASEADDR, &cpwmConfig))
+    {
+        /* The soft-started channel begins at 0%, the others keep their configured duty. */
+        (void)FLEXIO_CPWM_SetDuty(&s_cpwmHandle, DEMO_CPWM_SOFT_START_CHANNEL, 0U);
+        FLEXIO_CPWM_Commit(&s_cpwmHandle);
+    }
 
-    /* Calculate timer lower and upper values of TIMCMP */
-    /* Calculate the nearest integer value for sum, using formula round(x) = (2 * floor(x) + 1) / 2 */
-    /* sum = DEMO_FLEXIO_CLOCK_FREQUENCY / freq_H */
-    sum = (DEMO_FLEXIO_CLOCK_FREQUENCY * 2 / freq_Hz + 1) / 2;
+    BOARD_InitFlexioPwmPins();
 
-    /* Calculate the nearest integer value for lowerValue, the high period of the pwm output */
-    lowerValue = (sum * duty) / 100;
-    /* Calculate upper value, the low period of the pwm output */
-    upperValue = sum - lowerValue - 2;
+    s_fastBootCycles    = DWT->CYCCNT;
+    s_fastBootCoreClock = SystemCoreClock;
+}
 
-    fxioTimerConfig.timerCompare = ((upperValue << 8U) | (lowerValue));
+static status_t DEMO_PwmClockNotify(app_clock_event_t event, uint32_t newFreq_Hz, void *userData)
+{
+    flexio_cpwm_handle_t *handle = (flexio_cpwm_handle_t *)userData;
+    status_t status              = kStatus_Success;
 
-    if ((duty > 0) && (duty < 100))
+    switch (event)
     {
-        /* Set Timer mode to kFLEXIO_TimerModeDual8BitPWM to start timer */
-        fxioTimerConfig.timerMode = kFLEXIO_TimerModeDual8BitPWM;
+        case kAPP_ClockPrepare:
+            status = FLEXIO_CPWM_PrepareClockChange(handle, newFreq_Hz);
+            break;
+        case kAPP_ClockAlign:
+            FLEXIO_CPWM_AlignClockChange(handle);
+            break;
+        case kAPP_ClockCommit:
+            FLEXIO_CPWM_CompleteClockChange(handle);
+            break;
+        default:
+            FLEXIO_CPWM_CancelClockChange(handle);
+            break;
     }
-    else if (duty == 100)
+
+    return status;
+}
+
+#if (defined(DEMO_PLACEMENT_BENCHMARK) && DEMO_PLACEMENT_BENCHMARK)
+static void DEMO_PlacementBenchmark(void)
+{
+    app_bench_result_t warm;
+    app_bench_result_t cold;
+
+    if ((kStatus_Success != APP_BENCH_UpdatePath(&s_cpwmHandle, DEMO_PLACEMENT_BENCHMARK_CHANNEL,
+                                                 DEMO_PLACEMENT_BENCHMARK_ITERATIONS, false, &warm)) ||
+        (kStatus_Success != APP_BENCH_UpdatePath(&s_cpwmHandle, DEMO_PLACEMENT_BENCHMARK_CHANNEL,
+                                                 DEMO_PLACEMENT_BENCHMARK_ITERATIONS, true, &cold)))
     {
-        fxioTimerConfig.pinPolarity = kFLEXIO_PinActiveLow;
+        PRINTF("Update path benchmark failed.\r\n");
+        return;
     }
-    else if (duty == 0)
+
+    PRINTF("Update path from %s, cycles min/mean/max: warm %u/%u/%u, cold cache %u/%u/%u.\r\n",
+           (APP_PLACEMENT_ENABLE != 0) ? "SRAMX" : "flash", warm.minCycles, warm.meanCycles, warm.maxCycles,
+           cold.minCycles, cold.meanCycles, cold.maxCycles);
+}
+#endif
+
+static void DEMO_TimingWarmup(void *userData)
+{
+    flexio_cpwm_handle_t *handle = (flexio_cpwm_handle_t *)userData;
+    uint8_t channel              = DEMO_PLACEMENT_BENCHMARK_CHANNEL;
+
+    /* Same duty again, the output does not change. */
+    (void)FLEXIO_CPWM_SetDutyTicks(handle, channel, FLEXIO_CPWM_GetDutyTicks(handle, channel));
+    FLEXIO_CPWM_Update(handle);
+    FLEXIO_CPWM_Commit(handle);
+}
+
+#if (defined(DEMO_TIMING_BENCHMARK) && DEMO_TIMING_BENCHMARK)
+static void DEMO_TimingBenchmark(void)
+{
+    static const char *const presetNames[] = {"average", "locked cache", "uncached"};
+    app_bench_jitter_result_t jitter;
+    uint32_t preset;
+
+    for (preset = (uint32_t)kAPP_TimingAverage; preset <= (uint32_t)kAPP_TimingUncached; preset++)
     {
-        /* Set high level as active level */
-        fxioTimerConfig.pinPolarity = kFLEXIO_PinActiveHigh;
+        (void)APP_TIMING_ApplyPreset((app_timing_preset_t)preset, DEMO_TimingWarmup, &s_cpwmHandle);
+        if (kStatus_Success != APP_BENCH_IsrJitter(&s_cpwmHandle, DEMO_PLACEMENT_BENCHMARK_CHANNEL,
+                                                   DEMO_TIMING_BENCHMARK_ITERATIONS,
+                                                   DEMO_TIMING_BENCHMARK_DMA_CHANNEL, &jitter))
+        {
+            PRINTF("Update interrupt benchmark failed.\r\n");
+            break;
+        }
+        PRINTF("Preset %s, update interrupt cycles min/mean/max: latency %u/%u/%u, handler %u/%u/%u.\r\n",
+               presetNames[preset], jitter.latency.minCycles, jitter.latency.meanCycles,
+               jitter.latency.maxCycles, jitter.duration.minCycles, jitter.duration.meanCycles,
+               jitter.duration.maxCycles);
     }
-    else
+}
+#endif
+
+#if (defined(DEMO_MEMORY_BENCHMARK) && DEMO_MEMORY_BENCHMARK)
+static void DEMO_MemoryBenchmark(void)
+{
+    static const char *const functionNames[] = {"memcpy", "memset", "memmove", "memcmp"};
+    static const uint32_t sizes[]            = {4U, 16U, 64U, 256U, 1024U};
+    /* Destination and source offsets: both aligned, then both unaligned in different ways. */
+    static const uint8_t offsets[][2] = {{0U, 0U}, {1U, 3U}};
+    app_bench_mem_result_t mem;
+    uint32_t function;
+    uint32_t size;
+    uint32_t offset;
+
+    PRINTF("Memory functions, mean cycles library/byte loop:\r\n");
+    for (function = (uint32_t)kAPP_BenchMemcpy; function <= (uint32_t)kAPP_BenchMemcmp; function++)
     {
-        return kStatus_Fail;
+        for (offset = 0U; offset < ARRAY_SIZE(offsets); offset++)
+        {
+            PRINTF("%s %s:", functionNames[function], (offset == 0U) ? "aligned" : "unaligned");
+            for (size = 0U; size < ARRAY_SIZE(sizes); size++)
+            {
+                if (kStatus_Success != APP_BENCH_MemFunction((app_bench_mem_function_t)function, sizes[size],
+                                                             offsets[offset][0], offsets[offset][1],
+                                                             DEMO_MEMORY_BENCHMARK_ITERATIONS, &mem))
+                {
+                    PRINTF(" failed\r\n");
+                    return;
+                }
+                PRINTF(" %u: %u/%u", sizes[size], mem.library.meanCycles, mem.byteLoop.meanCycles);
+            }
+            PRINTF("\r\n");
+        }
     }
+}
+#endif
 
-    FLEXIO_SetTimerConfig(DEMO_FLEXIO_BASEADDR, DEMO_FLEXIO_TIMER_CH, &fxioTimerConfig);
+#if (defined(DEMO_DUAL_CORE) && DEMO_DUAL_CORE)
+static void DEMO_DualCoreMain(void)
+{
+    app_mailbox_command_t command;
+    app_mailbox_telemetry_t telemetry;
+    uint32_t snapshots = 0U;
 
-    s_flexioGetPwmDutyCycle[DEMO_FLEXIO_TIMER_CH] = duty;
+    /* attach FRO 12M to FLEXCOMM4 (debug console) */
+    CLOCK_SetClkDiv(kCLOCK_DivFlexcom4Clk, 1u);
+    CLOCK_AttachClk(BOARD_DEBUG_UART_CLK_ATTACH);
 
-    return kStatus_Success;
+    BOARD_InitPins();
+    BOARD_InitBootClocks();
+    BOARD_InitDebugConsole();
+
+    APP_MAILBOX_Init(&s_mailbox, SystemCoreClock, DEMO_FLEXIO_CLOCK_FREQUENCY);
+    APP_MAILBOX_Publish(&s_mailbox);
+    boot_multicore_slave();
+
+    while (0U == s_mailbox.core1Ready)
+    {
+    }
+    PRINTF("Core1 runs the PWM loop.\r\n");
+
+    command.type     = (uint8_t)kAPP_MailboxSetDuty;
+    command.channel  = DEMO_CPWM_SOFT_START_CHANNEL;
+    command.reserved = 0U;
+    command.value    = DEMO_CPWM_SOFT_START_DUTY;
+    (void)APP_MAILBOX_PostCommand(&s_mailbox, &command);
+
+    while (1)
+    {
+        if (kStatus_Success != APP_MAILBOX_GetTelemetry(&s_mailbox, &telemetry))
+        {
+            continue;
+        }
+        if (++snapshots < DEMO_DUAL_CORE_REPORT_DIVIDER)
+        {
+            continue;
+        }
+        snapshots = 0U;
+
+        PRINTF("Core1: %u loops, %u overruns, max %u cycles, %u commands, ch0 %u/%u ticks, %u telemetry drops.\r\n",
+               telemetry.loopCount, telemetry.overrunCount, telemetry.maxLoopCycles, telemetry.commandCount,
+               telemetry.onTicks[0], telemetry.periodTicks, s_mailbox.telemetryRing.drop);
+    }
 }
+#endif
 
-/*!
- * brief Set PWM output in idle status (high or low).
- *
- * param base               FlexIO peripheral base address
- * param timerChannel       FlexIO timer channel
- * param idleStatus         True: PWM output is high in idle status; false: PWM output is low in idle status
- */
-static void FLEXIO_SetPwmOutputToIdle(FLEXIO_Type *base, uint8_t timerChannel, bool idleStatus)
-{
-    flexio_timer_config_t fxioTimerConfig;
-
-    /* Configure the timer DEMO_FLEXIO_TIMER_CH for generating PWM */
-    fxioTimerConfig.triggerSelect   = FLEXIO_TIMER_TRIGGER_SEL_SHIFTnSTAT(0U);
-    fxioTimerConfig.triggerSource   = kFLEXIO_TimerTriggerSourceInternal;
-    fxioTimerConfig.triggerPolarity = kFLEXIO_TimerTriggerPolarityActiveLow;
-    fxioTimerConfig.pinConfig       = kFLEXIO_PinConfigOutput;
-    fxioTimerConfig.pinSelect       = DEMO_FLEXIO_OUTPUTPIN; /* Set pwm output */
-    fxioTimerConfig.timerMode       = kFLEXIO_TimerModeDisabled;
-    fxioTimerConfig.timerOutput     = kFLEXIO_TimerOutputOneNotAffectedByReset;
-    fxioTimerConfig.timerDecrement  = kFLEXIO_TimerDecSrcOnFlexIOClockShiftTimerOutput;
-    fxioTimerConfig.timerDisable    = kFLEXIO_TimerDisableNever;
-    fxioTimerConfig.timerEnable     = kFLEXIO_TimerEnabledAlways;
-    fxioTimerConfig.timerReset      = kFLEXIO_TimerResetNever;
-    fxioTimerConfig.timerStart      = kFLEXIO_TimerStartBitDisabled;
-    fxioTimerConfig.timerStop       = kFLEXIO_TimerStopBitDisabled;
-    fxioTimerConfig.timerCompare    = 0U;
-
-    /* Clear TIMCMP register */
-    base->TIMCMP[timerChannel] = 0;
-
-    if (idleStatus)
-    {
-        /* Set low level as active level */
-        fxioTimerConfig.pinPolarity = kFLEXIO_PinActiveLow;
+#if (defined(DEMO_TELEMETRY) && DEMO_TELEMETRY)
+static void DEMO_TelemetryMain(void)
+{
+    app_telemetry_config_t config;
+    status_t status;
+
+    APP_TELEMETRY_GetDefaultConfig(&config);
+    config.uart         = (LPUART_Type *)BOARD_DEBUG_UART_BASEADDR;
+    config.uartClock_Hz = BOARD_DEBUG_UART_CLK_FREQ;
+    config.baudRate_Bps = DEMO_TELEMETRY_BAUDRATE;
+    config.dmaRequest   = (uint32_t)DEMO_TELEMETRY_DMA_REQUEST;
+
+    PRINTF("Telemetry at %u baud from here.\r\n", DEMO_TELEMETRY_BAUDRATE);
+    (void)DbgConsole_Deinit();
+
+    status = APP_TELEMETRY_Init(&s_cpwmHandle, &config);
+    if (kStatus_Success != status)
+    {
+        /* Back to the console to tell why. */
+        BOARD_InitDebugConsole();
+        PRINTF("Telemetry not started, status %d.\r\n", status);
+        return;
+    }
+
+    /* No low power mode: the eDMA stops in deep sleep and the DWT timestamps in sleep. */
+    while (1)
+    {
+        APP_TELEMETRY_Poll();
+    }
+}
+#endif
+
+#if (defined(DEMO_COMMAND) && DEMO_COMMAND)
+static void DEMO_CommandResult(const app_command_t *command, status_t status, void *userData)
+{
+    if (command == NULL)
+    {
+        PRINTF("? syntax\r\n");
+    }
+    else if (kStatus_Success == status)
+    {
+        PRINTF("ok %c\r\n", command->opcode);
     }
     else
     {
-        /* Set high level as active level */
-        fxioTimerConfig.pinPolarity = kFLEXIO_PinActiveHigh;
+        PRINTF("error %c %d\r\n", command->opcode, status);
+    }
+}
+#endif
+
+#if (defined(DEMO_SCHEDULE) && DEMO_SCHEDULE)
+static void DEMO_ScheduleStart(void)
+{
+    app_sched_config_t config;
+    uint32_t half = DEMO_SCHEDULE_STEPS / 2U;
+    uint32_t rise;
+    uint32_t i;
+    status_t status;
+
+    /* Up from 0 to the full period and back down, in on-time ticks. */
+    for (i = 0U; i < DEMO_SCHEDULE_STEPS; i++)
+    {
+        rise                       = (i < half) ? i : (DEMO_SCHEDULE_STEPS - i);
+        s_scheduleSteps[i].delay   = 1U;
+        s_scheduleSteps[i].action  = (uint8_t)kAPP_SchedDutyTicks;
+        s_scheduleSteps[i].channel = DEMO_PLACEMENT_BENCHMARK_CHANNEL;
+        s_scheduleSteps[i].value   = (uint32_t)(((uint64_t)s_cpwmHandle.periodTicks * rise) / half);
     }
 
-    FLEXIO_SetTimerConfig(DEMO_FLEXIO_BASEADDR, timerChannel, &fxioTimerConfig);
+    APP_SCHED_GetDefaultConfig(&config);
+    status = APP_SCHED_Init(&s_cpwmHandle, &config);
+    if (kStatus_Success == status)
+    {
+        s_scheduleEvent.callback = DEMO_ScheduleDone;
+        status                   = APP_SCHED_PostProfile(&s_scheduleEvent, s_scheduleSteps, DEMO_SCHEDULE_STEPS,
+                                                         APP_SCHED_GetPeriod() + DEMO_SCHEDULE_LEAD);
+    }
 
-    s_flexioGetPwmDutyCycle[timerChannel] = 0;
+    if (kStatus_Success != status)
+    {
+        PRINTF("Schedule not started, status %d.\r\n", status);
+    }
 }
 
-#if defined(FSL_FEATURE_FLEXIO_HAS_PIN_STATUS) && FSL_FEATURE_FLEXIO_HAS_PIN_STATUS
-/*!
- * brief Get the pwm dutycycle value.
- *
- * param base          FlexIO peripheral base address
- * param timerChannel  FlexIO timer channel
- * param channel       FlexIO as pwm output channel number
- *
- * return Current channel dutycycle value.
- */
-static uint8_t PWM_GetPwmOutputState(FLEXIO_Type *base, uint8_t timerChannel, uint8_t channel)
+static void DEMO_ScheduleDone(app_sched_event_t *event, status_t status, void *userData)
+{
+    s_scheduleStatus = status;
+    s_scheduleDone   = true;
+}
+#endif
+
+#if (defined(DEMO_PATTERN) && DEMO_PATTERN)
+static void DEMO_PatternMain(void)
 {
-    if ((base->PIN & (1U << channel)) ^ (base->TIMCTL[timerChannel] & FLEXIO_TIMCTL_PINPOL_MASK))
+    app_pattern_config_t config;
+    app_pattern_status_t status;
+    uint32_t nextReport = DEMO_PATTERN_REPORT_REFILLS;
+
+    APP_PATTERN_GetDefaultConfig(&config);
+    config.srcClock_Hz   = DEMO_FLEXIO_CLOCK_FREQUENCY;
+    config.sampleRate_Hz = DEMO_PATTERN_RATE_HZ;
+    config.buffer        = s_patternBuffer;
+    config.halfWords     = DEMO_PATTERN_HALF_WORDS;
+    config.pattern       = s_patternCounter;
+    config.patternWords  = ARRAY_SIZE(s_patternCounter);
+
+    if (kStatus_Success != APP_PATTERN_Init(DEMO_FLEXIO_BASEADDR, &config))
     {
-        return kFLEXIO_PwmHigh;
+        PRINTF("Pattern not started.\r\n");
+        return;
     }
-    else
+    APP_PATTERN_GetStatus(&status);
+    PRINTF("Pattern at %u samples/s in place of the PWM.\r\n", status.sampleRate_Hz);
+
+    /* A half lasts DEMO_PATTERN_HALF_WORDS * 8 samples, no low power mode in between. */
+    while (1)
     {
-        return kFLEXIO_PwmLow;
+        (void)APP_PATTERN_Poll();
+        APP_PATTERN_GetStatus(&status);
+        if (status.refills >= nextReport)
+        {
+            nextReport += DEMO_PATTERN_REPORT_REFILLS;
+            PRINTF("Pattern %u refills, %u late, %u underruns.\r\n", status.refills, status.late, status.underruns);
+        }
+    }
+}
+#endif
+
+#if (defined(DEMO_CAPTURE) && DEMO_CAPTURE)
+static void DEMO_CaptureDump(void)
+{
+    app_capture_config_t config;
+    app_capture_result_t result;
+    uint32_t polls = 0U;
+    uint32_t i;
+
+    /* FXIO_D24 is the channel 0 output, trigger when it goes high. */
+    APP_CAPTURE_GetDefaultConfig(&config);
+    config.srcClock_Hz      = DEMO_FLEXIO_CLOCK_FREQUENCY;
+    config.sampleRate_Hz    = DEMO_CAPTURE_RATE_HZ;
+    config.triggerEdge      = true;
+    config.triggerMask      = 0x01U;
+    config.triggerValue     = 0x01U;
+    config.buffer           = s_captureBuffer;
+    config.bufferWords      = DEMO_CAPTURE_WORDS;
+    config.postTriggerWords = DEMO_CAPTURE_POST_TRIGGER_WORDS;
+
+    if (kStatus_Success != APP_CAPTURE_Init(DEMO_FLEXIO_BASEADDR, &config))
+    {
+        PRINTF("Capture not started.\r\n");
+        return;
+    }
+
+    while (kStatus_APP_CaptureBusy == APP_CAPTURE_GetResult(&result))
+    {
+        (void)APP_CAPTURE_Poll();
+        if (++polls == DEMO_CAPTURE_MAX_POLLS)
+        {
+            APP_CAPTURE_Deinit();
+            PRINTF("Capture not triggered.\r\n");
+            return;
+        }
+    }
+
+    /* Header, 8 words per line, end marker: the format tools/capture_vcd.py reads. */
+    PRINTF("capture rate=%u pins=%u:%u trigger=%u words=%u late=%u overruns=%u\r\n", result.sampleRate_Hz,
+           result.firstPin, result.pinCount, result.triggerSample, result.wordCount, result.late, result.overruns);
+    for (i = 0U; i < result.wordCount; i++)
+    {
+        PRINTF("%08x%s", result.words[i], ((i % 8U) == 7U) ? "\r\n" : " ");
+    }
+    PRINTF("%scapture end\r\n", ((result.wordCount % 8U) != 0U) ? "\r\n" : "");
+}
+#endif
+
+#if (defined(DEMO_SHADOW_CHECK) && DEMO_SHADOW_CHECK)
+static void DEMO_ShadowCheck(void)
+{
+    flexio_cpwm_shadow_t shadow;
+    uint32_t faults;
+
+    (void)FLEXIO_CPWM_CheckShadow(&s_cpwmHandle, &faults);
+    if ((faults != 0U) && (faults != s_shadowFaults))
+    {
+        FLEXIO_CPWM_GetShadow(&s_cpwmHandle, 0U, &shadow);
+        PRINTF("PWM registers differ from the shadow, faults 0x%x, ch0 %u/%u ticks, write %u.\r\n", faults,
+               shadow.onTicks, shadow.periodTicks, shadow.generation);
+    }
+    s_shadowFaults = faults;
+}
+#endif
+
+#if (defined(APP_LOG_ENABLE) && APP_LOG_ENABLE)
+static void DEMO_LogWrite(const uint8_t *data, size_t size)
+{
+    size_t i;
+
+    /* Raw bytes between the text lines, tools/app_log_decode.py picks the records out. */
+    for (i = 0U; i < size; i++)
+    {
+        (void)PUTCHAR((int)data[i]);
     }
 }
 #endif
@@ -212,28 +726,146 @@ static uint8_t PWM_GetPwmOutputState(FLEXIO_Type *base, uint8_t timerChannel, ui
  */
 int main(void)
 {
-    uint8_t duty            = 0;
-    uint8_t idleState       = 0;
-    uint32_t dutyCycleValue = 0;
-    uint32_t idleStateValue = 0;
-    flexio_config_t fxioUserConfig;
+    flexio_cpwm_config_t cpwmConfig;
+    flexio_cpwm_ramp_config_t rampConfig;
+#if (defined(DEMO_COMMAND) && DEMO_COMMAND)
+    app_command_config_t commandConfig;
+#endif
+
+#if (defined(DEMO_DUAL_CORE) && DEMO_DUAL_CORE)
+    DEMO_DualCoreMain();
+#endif
+
+    /* PWM first, everything else can wait */
+    DEMO_FastBootPwm();
+
+    /* FlexIO interrupts vector straight to the RAM resident dispatcher. */
+    APP_PLACEMENT_RelocateVectors();
 
     /* Init board hardware */
     /* attach FRO 12M to FLEXCOMM4 (debug console) */
     CLOCK_SetClkDiv(kCLOCK_DivFlexcom4Clk, 1u);
     CLOCK_AttachClk(BOARD_DEBUG_UART_CLK_ATTACH);
 
-    /* attach FRO HF to FLEXIO */
-    CLOCK_SetClkDiv(kCLOCK_DivFlexioClk, 4u);
-    CLOCK_AttachClk(kFRO_HF_to_FLEXIO);
-
     BOARD_InitPins();
     BOARD_InitBootClocks();
     BOARD_InitDebugConsole();
-    BOARD_InitBootPeripherals();
-    while(1)
+#if (defined(APP_LOG_ENABLE) && APP_LOG_ENABLE)
+    APP_LOG_Init();
+#endif
+
+    /* Retime the running PWM on the final FlexIO clock, the duty ratios are kept. */
+    FLEXIO_CPWM_GetDefaultConfig(&cpwmConfig);
+    cpwmConfig.srcClock_Hz = DEMO_FLEXIO_CLOCK_FREQUENCY;
+    cpwmConfig.freq_Hz     = DEMO_CPWM_FREQUENCY;
+    if (kStatus_Success != FLEXIO_CPWM_Init(&s_cpwmHandle, DEMO_FLEXIO_BASEADDR, &cpwmConfig))
+    {
+        PRINTF("FLEXIO_CPWM init failed.\r\n");
+    }
+
+    PRINTF("PWM up %u cycles (%u us) after main() entry.\r\n", s_fastBootCycles,
+           (uint32_t)(((uint64_t)s_fastBootCycles * 1000000U) / s_fastBootCoreClock));
+
+    /* Soft start: the ramp is streamed by eDMA, no per-period CPU work */
+    rampConfig.channel     = DEMO_CPWM_SOFT_START_CHANNEL;
+    rampConfig.startDuty   = 0U;
+    rampConfig.targetDuty  = DEMO_CPWM_SOFT_START_DUTY;
+    rampConfig.profile     = kFLEXIO_CPWM_RampSCurve;
+    rampConfig.periods     = DEMO_CPWM_SOFT_START_PERIODS;
+    rampConfig.duration_us = 0U;
+    if (kStatus_Success == FLEXIO_CPWM_PrepareRamp(&s_cpwmHandle, &rampConfig, s_softStartSteps,
+                                                   ARRAY_SIZE(s_softStartSteps)))
+    {
+        (void)FLEXIO_CPWM_StartRamp(&s_cpwmHandle);
+        while (kStatus_FLEXIO_CPWM_RampBusy == FLEXIO_CPWM_GetRampStatus(&s_cpwmHandle))
+        {
+            /* The PWM is up, zero the lazy .bss in the background. */
+            (void)lazy_bss_init_step(DEMO_LAZY_BSS_STEP);
+        }
+    }
+
+    /* Lazy .bss objects are valid from here. */
+    while (0U != lazy_bss_init_step(DEMO_LAZY_BSS_STEP))
+    {
+    }
+
+    /* Light load: drop the FlexIO clock, the PWM keeps its frequency and duty. */
+    APP_CLOCK_AddListener(&s_cpwmClockListener, DEMO_PwmClockNotify, &s_cpwmHandle);
+    if (kStatus_Success != APP_CLOCK_SetFlexioClock(DEMO_LIGHT_LOAD_FLEXIO_CLOCK, DEMO_LIGHT_LOAD_FLEXIO_DIVIDER))
+    {
+        PRINTF("FlexIO clock change refused.\r\n");
+    }
+
+#if (defined(DEMO_PLACEMENT_BENCHMARK) && DEMO_PLACEMENT_BENCHMARK)
+    DEMO_PlacementBenchmark();
+#endif
+
+#if (defined(DEMO_TIMING_BENCHMARK) && DEMO_TIMING_BENCHMARK)
+    DEMO_TimingBenchmark();
+#endif
+
+#if (defined(DEMO_MEMORY_BENCHMARK) && DEMO_MEMORY_BENCHMARK)
+    DEMO_MemoryBenchmark();
+#endif
+
+    /* Bounded update interrupt latency from here on. */
+    if (kStatus_Success != APP_TIMING_ApplyPreset(DEMO_TIMING_PRESET, DEMO_TimingWarmup, &s_cpwmHandle))
+    {
+        PRINTF("Timing preset not applied.\r\n");
+    }
+
+    if (kStatus_Success != APP_LOWPOWER_Init(DEMO_FLEXIO_BASEADDR, DEMO_LOWPOWER_MODE))
     {
+        PRINTF("Deep sleep not available, using sleep.\r\n");
+    }
+
+#if (defined(DEMO_CAPTURE) && DEMO_CAPTURE)
+    DEMO_CaptureDump();
+#endif
+
+#if (defined(DEMO_TELEMETRY) && DEMO_TELEMETRY)
+    DEMO_TelemetryMain();
+#endif
+
+#if (defined(DEMO_PATTERN) && DEMO_PATTERN)
+    DEMO_PatternMain();
+#endif
+
+#if (defined(DEMO_COMMAND) && DEMO_COMMAND)
+    APP_COMMAND_GetDefaultConfig(&commandConfig);
+    commandConfig.uart       = (LPUART_Type *)BOARD_DEBUG_UART_BASEADDR;
+    commandConfig.dmaRequest = (uint32_t)DEMO_COMMAND_DMA_REQUEST;
+    commandConfig.callback   = DEMO_CommandResult;
+    (void)APP_COMMAND_Init(&s_cpwmHandle, &commandConfig);
+    PRINTF("Commands: d <ch> <%%>, t <ch> <ticks>, f <hz>, p <ch> <deg>, a (arm), x (disarm).\r\n");
+#endif
+
+#if (defined(DEMO_SCHEDULE) && DEMO_SCHEDULE)
+    DEMO_ScheduleStart();
+#endif
 
+    while (1)
+    {
+        /* The eDMA does not run in deep sleep, stay in sleep while a ramp streams or commands arrive. */
+        APP_LOWPOWER_Idle((DEMO_COMMAND == 0) &&
+                          (kStatus_FLEXIO_CPWM_RampBusy != FLEXIO_CPWM_GetRampStatus(&s_cpwmHandle)));
+#if (defined(DEMO_COMMAND) && DEMO_COMMAND)
+        (void)APP_COMMAND_Poll();
+#endif
+#if (defined(DEMO_SCHEDULE) && DEMO_SCHEDULE)
+        if (s_scheduleDone)
+        {
+            s_scheduleDone = false;
+            PRINTF("Schedule profile done at period %u, status %d.\r\n", APP_SCHED_GetPeriod(), s_scheduleStatus);
+        }
+#endif
+#if (defined(DEMO_SHADOW_CHECK) && DEMO_SHADOW_CHECK)
+        DEMO_ShadowCheck();
+#endif
+#if (defined(APP_LOG_ENABLE) && APP_LOG_ENABLE)
+        /* Records of the interrupts which woke the core up. */
+        (void)APP_LOG_Drain(DEMO_LogWrite);
+#endif
     }
 
 }
@@ -0,0 +1,194 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Core1 side of the dual-core mode. Built into the core1 image only (DEMO_CORE1 defined), the core0
+ * image compiles this file to nothing.
+ *
+ * Template: this tree holds no core1 project. Create the slave project described in doc/readme.md
+ * ("Dual-core mode") to build this file.
+ */
+#if defined(DEMO_CORE1)
+
+#include "fsl_device_registers.h"
+#include "fsl_flexio.h"
+#include "flexio_cpwm.h"
+#include "app_mailbox.h"
+#include "pin_mux.h"
+#include "peripherals.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define DEMO_FLEXIO_BASEADDR FLEXIO0
+
+/* Center aligned PWM produced by the state machine of BOARD_InitPeripherals() */
+#define DEMO_CPWM_FREQUENCY 120000U
+
+/* Control loop rate, and loop iterations between two telemetry snapshots */
+#define DEMO_CORE1_LOOP_FREQUENCY    100000U
+#define DEMO_CORE1_TELEMETRY_DIVIDER 1000U
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/*!
+ * @brief Applies one command from core0.
+ */
+static void DEMO_Core1ApplyCommand(const app_mailbox_command_t *command);
+
+/*!
+ * @brief Posts a snapshot of the loop and of the PWM state.
+ */
+static void DEMO_Core1PostTelemetry(void);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static flexio_cpwm_handle_t s_cpwmHandle;
+static app_mailbox_t *s_mailbox;
+static app_mailbox_telemetry_t s_telemetry;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void DEMO_Core1ApplyCommand(const app_mailbox_command_t *command)
+{
+    switch (command->type)
+    {
+        case (uint8_t)kAPP_MailboxSetDuty:
+            if (command->channel < s_cpwmHandle.channelCount)
+            {
+                (void)FLEXIO_CPWM_SetDuty(&s_cpwmHandle, command->channel, (uint8_t)command->value);
+            }
+            break;
+        case (uint8_t)kAPP_MailboxSetDutyTicks:
+            if (command->channel < s_cpwmHandle.channelCount)
+            {
+                (void)FLEXIO_CPWM_SetDutyTicks(&s_cpwmHandle, command->channel, command->value);
+            }
+            break;
+        case (uint8_t)kAPP_MailboxSetFrequency:
+            /* Retimes the live engine, the duty ratios are kept. */
+            (void)FLEXIO_CPWM_SetFrequency(&s_cpwmHandle, command->value);
+            break;
+        default:
+            /* Unknown commands are counted but ignored. */
+            break;
+    }
+
+    s_telemetry.commandCount++;
+}
+
+static void DEMO_Core1PostTelemetry(void)
+{
+    uint8_t i;
+
+    s_telemetry.periodTicks = s_cpwmHandle.periodTicks;
+    for (i = 0U; i < FLEXIO_CPWM_MAX_CHANNELS; i++)
+    {
+        s_telemetry.onTicks[i] = (i < s_cpwmHandle.channelCount) ? FLEXIO_CPWM_GetDutyTicks(&s_cpwmHandle, i) : 0U;
+    }
+
+    (void)APP_MAILBOX_PostTelemetry(s_mailbox, &s_telemetry);
+    s_telemetry.maxLoopCycles = 0U;
+}
+
+/*!
+ * @brief Core1 main function: owns FLEXIO0, runs the PWM update loop, takes no interrupt but the
+ * FlexIO one.
+ */
+int main(void)
+{
+    flexio_cpwm_config_t cpwmConfig;
+    app_mailbox_command_t command;
+    uint32_t loopReload;
+    uint32_t ctrl;
+    uint32_t start;
+    uint32_t end;
+    uint32_t cycles;
+    uint32_t divider = 0U;
+
+    do
+    {
+        s_mailbox = APP_MAILBOX_Attach();
+    } while (s_mailbox == NULL);
+
+    SystemCoreClock = s_mailbox->coreClock_Hz;
+
+    /*
+     * Core0 set up the clocks, its BOARD_InitPins() already muxed FXIO_D24..D28 but FLEXIO0 itself
+     * is left unprogrammed. The PWM pin routing is applied again once the engine runs.
+     */
+    BOARD_InitBootPeripherals();
+    FLEXIO_CPWM_GetDefaultConfig(&cpwmConfig);
+    cpwmConfig.srcClock_Hz = s_mailbox->flexioClock_Hz;
+    cpwmConfig.freq_Hz     = DEMO_CPWM_FREQUENCY;
+    if (kStatus_Success != FLEXIO_CPWM_Init(&s_cpwmHandle, DEMO_FLEXIO_BASEADDR, &cpwmConfig))
+    {
+        while (1)
+        {
+        }
+    }
+    BOARD_InitFlexioPwmPins();
+
+    /* The loop is paced by polling SysTick, the SysTick interrupt stays off. */
+    loopReload    = (SystemCoreClock / DEMO_CORE1_LOOP_FREQUENCY) - 1U;
+    SysTick->LOAD = loopReload;
+    SysTick->VAL  = 0U;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+
+    s_mailbox->core1Ready = 1U;
+
+    /* Reading CTRL clears COUNTFLAG, CTRL is read once per pass and its flag kept in ctrl. */
+    ctrl = 0U;
+    while (1)
+    {
+        /* An overrun pass has already seen the tick, it starts at once. */
+        while (0U == (ctrl & SysTick_CTRL_COUNTFLAG_Msk))
+        {
+            ctrl = SysTick->CTRL;
+        }
+        start = SysTick->VAL;
+
+        while (kStatus_Success == APP_MAILBOX_GetCommand(s_mailbox, &command))
+        {
+            DEMO_Core1ApplyCommand(&command);
+        }
+        /* The staged channels are written at the next period edge. */
+        FLEXIO_CPWM_Update(&s_cpwmHandle);
+
+        if (++divider >= DEMO_CORE1_TELEMETRY_DIVIDER)
+        {
+            divider = 0U;
+            DEMO_Core1PostTelemetry();
+        }
+
+        s_telemetry.loopCount++;
+        /*
+         * SysTick counts down. COUNTFLAG set, or VAL above the start when the wrap came between the two
+         * reads: the work did not fit in one tick. The flag of the latter is still set for the wait.
+         */
+        ctrl = SysTick->CTRL;
+        end  = SysTick->VAL;
+        if ((0U != (ctrl & SysTick_CTRL_COUNTFLAG_Msk)) || (end > start))
+        {
+            s_telemetry.overrunCount++;
+            cycles = start + (loopReload + 1U) - end;
+        }
+        else
+        {
+            cycles = start - end;
+        }
+        if (cycles > s_telemetry.maxLoopCycles)
+        {
+            s_telemetry.maxLoopCycles = cycles;
+        }
+    }
+}
+
+#endif /* DEMO_CORE1 */
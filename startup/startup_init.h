@@ -0,0 +1,39 @@
+//*****************************************************************************
+// startup_init.h
+//
+// Header for the C runtime initialization options of the startup code
+//*****************************************************************************
+//
+// Copyright 2024 NXP
+// All rights reserved.
+//
+// SPDX-License-Identifier: BSD-3-Clause
+//*****************************************************************************
+
+#ifndef STARTUP_INIT_H_
+#define STARTUP_INIT_H_
+
+//*****************************************************************************
+// Large zero initialized objects which are not needed before the application
+// is up can be placed in the lazy .bss region. ResetISR() does not touch it,
+// the application zeroes it in the background with lazy_bss_init_step(),
+// e.g. while the PWM soft start runs. Such an object must not be read before
+// lazy_bss_init_step() has returned 0.
+//
+//   __LAZY_BSS uint8_t s_telemetryBuffer[32768];
+//*****************************************************************************
+#define __LAZY_BSS __attribute__ ((section(".noinit.$LAZY_BSS")))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Zeroes at most maxLen bytes (rounded up to a 32 bytes burst) of the lazy
+// .bss region, returns the number of bytes left to zero.
+unsigned int lazy_bss_init_step(unsigned int maxLen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STARTUP_INIT_H_ */
@@ -34,6 +34,8 @@ extern "C" {
 #define WEAK_AV __attribute__ ((weak, section(".after_vectors")))
 #define ALIAS(f) __attribute__ ((weak, alias (#f)))
 
+#include "startup_init.h"
+
 //*****************************************************************************
 #if defined (__cplusplus)
 extern "C" {
@@ -604,6 +606,29 @@ void (* const g_pfnVectors[])(void) = {
     CTI0_IRQHandler,                   // 171: Cross Trigger Interface interrupt
 }; /* End of g_pfnVectors */
 
+//*****************************************************************************
+// Options of the RW and BSS data initialization:
+// - STARTUP_BURST_INIT: copy and zero 32 bytes per loop iteration with
+//   LDM/STM bursts instead of one word per iteration.
+// - STARTUP_EDMA_INIT_THRESHOLD: a section of at least this many bytes is
+//   handed to eDMA channel STARTUP_EDMA_CHANNEL, the core carries on with the
+//   other sections and waits for the transfer before calling main(). One
+//   transfer is in flight at a time. 0 disables the eDMA path.
+//*****************************************************************************
+#ifndef STARTUP_BURST_INIT
+#define STARTUP_BURST_INIT 1
+#endif
+#ifndef STARTUP_EDMA_INIT_THRESHOLD
+#define STARTUP_EDMA_INIT_THRESHOLD 0
+#endif
+#ifndef STARTUP_EDMA_CHANNEL
+#define STARTUP_EDMA_CHANNEL 15
+#endif
+
+#if (STARTUP_EDMA_INIT_THRESHOLD > 0)
+#include "fsl_device_registers.h"
+#endif
+
 //*****************************************************************************
 // Functions to carry out the initialization of RW and BSS data sections. These
 // are written as separate functions rather than being inlined within the
@@ -615,6 +640,21 @@ void data_init(unsigned int romstart, unsigned int start, unsigned int len) {
     unsigned int *pulDest = (unsigned int*) start;
     unsigned int *pulSrc = (unsigned int*) romstart;
     unsigned int loop;
+#if (STARTUP_BURST_INIT)
+    // 32 bytes per iteration, the remaining words are copied one by one
+    loop = len >> 5;
+    if (loop != 0) {
+        __asm volatile ("1:                                  \n"
+                        "LDMIA %1!, {r2-r6, r8, r9, r12}     \n"
+                        "STMIA %0!, {r2-r6, r8, r9, r12}     \n"
+                        "SUBS  %2, %2, #1                    \n"
+                        "BNE   1b                            \n"
+                        : "+r"(pulDest), "+r"(pulSrc), "+r"(loop)
+                        :
+                        : "r2", "r3", "r4", "r5", "r6", "r8", "r9", "r12", "cc", "memory");
+    }
+    len &= 31;
+#endif // (STARTUP_BURST_INIT)
     for (loop = 0; loop < len; loop = loop + 4)
         *pulDest++ = *pulSrc++;
 }
@@ -623,10 +663,102 @@ __attribute__ ((section(".after_vectors.init_bss")))
 void bss_init(unsigned int start, unsigned int len) {
     unsigned int *pulDest = (unsigned int*) start;
     unsigned int loop;
+#if (STARTUP_BURST_INIT)
+    // 32 bytes per iteration, the remaining words are zeroed one by one
+    loop = len >> 5;
+    if (loop != 0) {
+        __asm volatile ("MOVS  r2, #0                        \n"
+                        "MOVS  r3, #0                        \n"
+                        "MOVS  r4, #0                        \n"
+                        "MOVS  r5, #0                        \n"
+                        "1:                                  \n"
+                        "STMIA %0!, {r2-r5}                  \n"
+                        "STMIA %0!, {r2-r5}                  \n"
+                        "SUBS  %1, %1, #1                    \n"
+                        "BNE   1b                            \n"
+                        : "+r"(pulDest), "+r"(loop)
+                        :
+                        : "r2", "r3", "r4", "r5", "cc", "memory");
+    }
+    len &= 31;
+#endif // (STARTUP_BURST_INIT)
     for (loop = 0; loop < len; loop = loop + 4)
         *pulDest++ = 0;
 }
 
+#if (STARTUP_EDMA_INIT_THRESHOLD > 0)
+//*****************************************************************************
+// eDMA assisted initialization. The whole section is moved in a single minor
+// loop started by software, with the widest transfer size the alignment of
+// the addresses and the length allows. For a BSS section the source is a
+// zero block which the source offset of 0 reads over and over.
+//*****************************************************************************
+static const unsigned int edma_init_zero[8] __attribute__ ((aligned(32))) = {0};
+
+__attribute__ ((section(".after_vectors.init_data")))
+static void edma_init_start(unsigned int romstart, unsigned int start, unsigned int len) {
+    DMA_Type *dma = DMA0;
+    unsigned int align = start | len | romstart;
+    unsigned int size;
+
+    // 32, 16 or 4 bytes per read and write
+    size = ((align & 31) == 0) ? 5 : (((align & 15) == 0) ? 4 : 2);
+
+    SYSCON0->AHBCLKCTRL0 |= SYSCON_AHBCLKCTRL0_DMA0_MASK;
+    SYSCON0->PRESETCTRL0 &= ~SYSCON_PRESETCTRL0_DMA0_RST_MASK;
+
+    dma->CH[STARTUP_EDMA_CHANNEL].CH_CSR = DMA_CH_CSR_DONE_MASK;
+    dma->CH[STARTUP_EDMA_CHANNEL].TCD_SADDR = (romstart != 0) ? romstart : (unsigned int)edma_init_zero;
+    dma->CH[STARTUP_EDMA_CHANNEL].TCD_SOFF = (romstart != 0) ? (uint16_t)(1U << size) : 0U;
+    dma->CH[STARTUP_EDMA_CHANNEL].TCD_ATTR = DMA_TCD_ATTR_SSIZE(size) | DMA_TCD_ATTR_DSIZE(size);
+    dma->CH[STARTUP_EDMA_CHANNEL].TCD_NBYTES_MLOFFNO = len;
+    dma->CH[STARTUP_EDMA_CHANNEL].TCD_SLAST_SDA = 0;
+    dma->CH[STARTUP_EDMA_CHANNEL].TCD_DADDR = start;
+    dma->CH[STARTUP_EDMA_CHANNEL].TCD_DOFF = (uint16_t)(1U << size);
+    dma->CH[STARTUP_EDMA_CHANNEL].TCD_CITER_ELINKNO = 1;
+    dma->CH[STARTUP_EDMA_CHANNEL].TCD_DLAST_SGA = 0;
+    dma->CH[STARTUP_EDMA_CHANNEL].TCD_BITER_ELINKNO = 1;
+    dma->CH[STARTUP_EDMA_CHANNEL].TCD_CSR = DMA_TCD_CSR_START_MASK;
+}
+
+__attribute__ ((section(".after_vectors.init_data")))
+static void edma_init_wait(void) {
+    DMA_Type *dma = DMA0;
+
+    while ((dma->CH[STARTUP_EDMA_CHANNEL].CH_CSR & DMA_CH_CSR_DONE_MASK) == 0) {
+        ;
+    }
+    // Leave the channel as found out of reset for the application
+    dma->CH[STARTUP_EDMA_CHANNEL].CH_CSR = DMA_CH_CSR_DONE_MASK;
+    dma->CH[STARTUP_EDMA_CHANNEL].TCD_CSR = 0;
+}
+#endif // (STARTUP_EDMA_INIT_THRESHOLD > 0)
+
+//*****************************************************************************
+// Lazy BSS region, see startup_init.h. It is placed in the default NOINIT
+// section between __start_lazy_bss and __end_lazy_bss. The progress pointer
+// is RW data, so it is valid as soon as main() runs.
+//*****************************************************************************
+extern unsigned int __start_lazy_bss;
+extern unsigned int __end_lazy_bss;
+
+static unsigned int *lazy_bss_next = &__start_lazy_bss;
+
+unsigned int lazy_bss_init_step(unsigned int maxLen) {
+    unsigned int left = (unsigned int)&__end_lazy_bss - (unsigned int)lazy_bss_next;
+    unsigned int len = (maxLen + 31) & ~31U;
+
+    if (len > left) {
+        len = left;
+    }
+    if (len != 0) {
+        bss_init((unsigned int)lazy_bss_next, len);
+        lazy_bss_next += len >> 2;
+        left -= len;
+    }
+    return left;
+}
+
 //*****************************************************************************
 // The following symbols are constructs generated by the linker, indicating
 // the location of various points in the "Global Section Table". This table is
@@ -669,6 +801,9 @@ void ResetISR(void) {
     //
     unsigned int LoadAddr, ExeAddr, SectionLen;
     unsigned int *SectionTableAddr;
+#if (STARTUP_EDMA_INIT_THRESHOLD > 0)
+    unsigned int DmaPending = 0;
+#endif
 
     // Load base address of Global Section Table
     SectionTableAddr = &__data_section_table;
@@ -678,6 +813,13 @@ void ResetISR(void) {
         LoadAddr = *SectionTableAddr++;
         ExeAddr = *SectionTableAddr++;
         SectionLen = *SectionTableAddr++;
+#if (STARTUP_EDMA_INIT_THRESHOLD > 0)
+        if ((DmaPending == 0) && (SectionLen >= STARTUP_EDMA_INIT_THRESHOLD)) {
+            edma_init_start(LoadAddr, ExeAddr, SectionLen);
+            DmaPending = 1;
+            continue;
+        }
+#endif
         data_init(LoadAddr, ExeAddr, SectionLen);
     }
 
@@ -686,9 +828,22 @@ void ResetISR(void) {
     while (SectionTableAddr < &__bss_section_table_end) {
         ExeAddr = *SectionTableAddr++;
         SectionLen = *SectionTableAddr++;
+#if (STARTUP_EDMA_INIT_THRESHOLD > 0)
+        if ((DmaPending == 0) && (SectionLen >= STARTUP_EDMA_INIT_THRESHOLD)) {
+            edma_init_start(0, ExeAddr, SectionLen);
+            DmaPending = 1;
+            continue;
+        }
+#endif
         bss_init(ExeAddr, SectionLen);
     }
 
+#if (STARTUP_EDMA_INIT_THRESHOLD > 0)
+    if (DmaPending != 0) {
+        edma_init_wait();
+    }
+#endif
+
 #if !defined (__USE_CMSIS)
 // Assume that if __USE_CMSIS defined, then CMSIS SystemInit code
 // will setup the VTOR register
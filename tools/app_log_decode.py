@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 NXP
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Decodes the deferred log records of source/app_log.h.
+
+The format strings are read from the ".app_log_fmt" section of the ELF file, the records from a
+capture of the debug UART (a file, a serial device or stdin). Bytes which are not part of a record,
+e.g. PRINTF text, are skipped, or printed with --text.
+
+    stty -F /dev/ttyACM0 115200 raw
+    tools/app_log_decode.py Debug/frdmmcxn947_flexio_pwm.axf /dev/ttyACM0 --clock 150000000
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+LOG_SYNC = 0xA5
+LOG_HEADER_WORDS = 3
+LOG_MAX_ARGS = 6
+LOG_FMT_SECTION = ".app_log_fmt"
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+# printf conversion: flags, width, precision, length (dropped), conversion.
+CONVERSION = re.compile(r"%([-+ #0]*)(\d*)(\.\d+)?(hh|h|ll|l|j|z|t)?([diouxXcsp%])")
+
+
+class Elf:
+    """Just enough of ELF32/ELF64 little endian to read the sections by address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[5] != 1:
+            raise ValueError("%s: not a little endian ELF file" % path)
+        is64 = self.data[4] == 2
+        if is64:
+            shoff, = struct.unpack_from("<Q", self.data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from("<HHH", self.data, 0x3A)
+            layout = "<IIQQQQIIQQ"
+        else:
+            shoff, = struct.unpack_from("<I", self.data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from("<HHH", self.data, 0x2E)
+            layout = "<IIIIIIIIII"
+        headers = [struct.unpack_from(layout, self.data, shoff + i * shentsize) for i in range(shnum)]
+        names = headers[shstrndx][4]
+        self.sections = []
+        for h in headers:
+            name = self.data[names + h[0]:self.data.index(b"\0", names + h[0])].decode()
+            # name, type, flags, addr, offset, size
+            self.sections.append((name, h[1], h[2], h[3], h[4], h[5]))
+
+    def section(self, name):
+        for s in self.sections:
+            if s[0] == name:
+                return s
+        return None
+
+    def string_at(self, section, addr):
+        name, kind, flags, base, offset, size = section
+        if kind == SHT_NOBITS or not (base <= addr < base + size):
+            return None
+        start = offset + addr - base
+        end = self.data.find(b"\0", start, offset + size)
+        if end < 0:
+            return None
+        return self.data[start:end].decode("latin-1")
+
+    def loaded_string(self, addr):
+        for s in self.sections:
+            if s[2] & SHF_ALLOC:
+                text = self.string_at(s, addr)
+                if text is not None:
+                    return text
+        return None
+
+
+def load_formats(elf):
+    """Maps every format string ID to (format, argument count)."""
+    section = elf.section(LOG_FMT_SECTION)
+    if section is None:
+        raise ValueError("no %s section, build with APP_LOG_ENABLE=1" % LOG_FMT_SECTION)
+    name, kind, flags, base, offset, size = section
+    formats = {}
+    pos = 0
+    while pos < size:
+        end = elf.data.find(b"\0", offset + pos, offset + size)
+        if end < 0:
+            break
+        fmt = elf.data[offset + pos:end].decode("latin-1")
+        if fmt:
+            count = sum(1 for m in CONVERSION.finditer(fmt) if m.group(5) != "%")
+            formats[base + pos] = (fmt, count)
+        # Strings are padded to their alignment.
+        pos = end - offset + 1
+        while pos < size and elf.data[offset + pos] == 0:
+            pos += 1
+    return formats
+
+
+def render(elf, fmt, args):
+    """Applies the arguments the way DbgConsole_Printf() would."""
+    values = iter(args)
+
+    def convert(m):
+        flags, width, precision, _, conv = m.groups()
+        spec = "%" + flags + width + (precision or "")
+        if conv == "%":
+            return "%"
+        value = next(values)
+        if conv in "di":
+            value = value - (1 << 32) if value & 0x80000000 else value
+            return (spec + "d") % value
+        if conv == "u":
+            return (spec + "d") % value
+        if conv == "c":
+            return (spec + "c") % chr(value & 0xFF)
+        if conv == "s":
+            text = elf.loaded_string(value)
+            return (spec + "s") % (text if text is not None else "<0x%08x>" % value)
+        if conv == "p":
+            return "0x%08x" % value
+        return (spec + conv) % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def decode(elf, formats, stream, out, clock, show_text):
+    buf = b""
+    text = b""
+    sequence = None
+    lost = 0
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            break
+        buf += chunk
+        pos = 0
+        while pos + LOG_HEADER_WORDS * 4 <= len(buf):
+            header, fmt_id, stamp = struct.unpack_from("<III", buf, pos)
+            count = (header >> 8) & 0xFF
+            entry = formats.get(fmt_id)
+            if (header & 0xFF) != LOG_SYNC or count > LOG_MAX_ARGS or entry is None or entry[1] != count:
+                text += buf[pos:pos + 1]
+                pos += 1
+                continue
+            end = pos + (LOG_HEADER_WORDS + count) * 4
+            if end > len(buf):
+                break
+            args = struct.unpack_from("<%dI" % count, buf, pos + LOG_HEADER_WORDS * 4)
+            pos = end
+
+            if show_text and text:
+                out.write(text.decode("latin-1"))
+            text = b""
+
+            seq = header >> 16
+            if sequence is not None and seq != ((sequence + 1) & 0xFFFF):
+                missed = (seq - sequence - 1) & 0xFFFF
+                lost += missed
+                out.write("... %u records lost\n" % missed)
+            sequence = seq
+
+            stamp_text = "%.3f us" % (stamp * 1e6 / clock) if clock else "%u" % stamp
+            line = render(elf, entry[0], args)
+            out.write("[%5u %12s] %s%s" % (seq, stamp_text, line, "" if line.endswith("\n") else "\n"))
+        buf = buf[pos:]
+        out.flush()
+    if show_text and (text or buf):
+        out.write((text + buf).decode("latin-1"))
+    return lost
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="image built with APP_LOG_ENABLE=1 (.axf/.elf)")
+    parser.add_argument("capture", nargs="?", default="-", help="UART capture or serial device, - for stdin")
+    parser.add_argument("--clock", type=float, default=0.0, help="core clock in Hz, prints microseconds")
+    parser.add_argument("--text", action="store_true", help="also print the bytes which are not records")
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    formats = load_formats(elf)
+    stream = sys.stdin.buffer if args.capture == "-" else open(args.capture, "rb", buffering=0)
+    try:
+        lost = decode(elf, formats, stream, sys.stdout, args.clock, args.text)
+    except KeyboardInterrupt:
+        lost = 0
+    if lost:
+        sys.stderr.write("%u records lost in total\n" % lost)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 NXP
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Converts the logic capture dumps of source/app_capture.h into VCD.
+
+The dump is text on the debug console (a file, a serial device or stdin): a header line
+
+    capture rate=<Hz> pins=<first>:<count> trigger=<sample> words=<n> late=<n> overruns=<n>
+
+then the capture words in hex, 8 per line, then "capture end". Each word holds 32 / count samples,
+the first one in its lowest bits. Other console text is skipped. Every pin becomes a wire named
+FXIO_D<n>, or as given with --name, and a "trigger" wire pulses at the trigger sample. With several
+dumps in the input, the last complete one is converted, or the one selected with --index.
+
+    tools/capture_vcd.py console.log -o pwm.vcd --name 24=ch0 --name 26=ch1
+"""
+
+import argparse
+import re
+import sys
+
+NO_TRIGGER = 0xFFFFFFFF
+
+HEADER = re.compile(r"capture rate=(\d+) pins=(\d+):(\d+) trigger=(\d+) words=(\d+)(?: late=(\d+) overruns=(\d+))?")
+END = "capture end"
+
+
+class Dump:
+    def __init__(self, match):
+        self.rate = int(match.group(1))
+        self.first_pin = int(match.group(2))
+        self.pin_count = int(match.group(3))
+        self.trigger = int(match.group(4))
+        self.word_count = int(match.group(5))
+        self.late = int(match.group(6) or 0)
+        self.overruns = int(match.group(7) or 0)
+        self.words = []
+
+    def samples(self):
+        width = self.pin_count
+        lane = (1 << width) - 1
+        for word in self.words:
+            for shift in range(0, 32, width):
+                yield (word >> shift) & lane
+
+
+def parse(lines):
+    """Yields the complete dumps of the console text."""
+    dump = None
+    for line in lines:
+        line = line.strip()
+        match = HEADER.search(line)
+        if match:
+            dump = Dump(match)
+        elif dump is None:
+            continue
+        elif line.endswith(END):
+            if len(dump.words) == dump.word_count:
+                yield dump
+            else:
+                sys.stderr.write("dump with %u of %u words skipped\n" % (len(dump.words), dump.word_count))
+            dump = None
+        else:
+            try:
+                dump.words += [int(word, 16) for word in line.split()]
+            except ValueError:
+                dump = None  # Console text in the middle, the dump is broken
+
+
+def identifier(index):
+    """VCD identifier codes, printable ASCII from '!'."""
+    code = ""
+    index += 1
+    while index:
+        index -= 1
+        code = chr(33 + index % 94) + code
+        index //= 94
+    return code
+
+
+def write_vcd(dump, out, names):
+    # Sample period rounded to a picosecond.
+    period_ps = round(1e12 / dump.rate)
+    pins = [dump.first_pin + n for n in range(dump.pin_count)]
+    ids = [identifier(n) for n in range(len(pins) + 1)]
+    trigger_id = ids[-1]
+
+    out.write("$comment FlexIO logic capture, %u samples/s, %u late, %u overruns $end\n"
+              % (dump.rate, dump.late, dump.overruns))
+    out.write("$timescale 1 ps $end\n$scope module flexio $end\n")
+    for pin, code in zip(pins, ids):
+        out.write("$var wire 1 %s %s $end\n" % (code, names.get(pin, "FXIO_D%u" % pin)))
+    out.write("$var wire 1 %s trigger $end\n$upscope $end\n$enddefinitions $end\n" % trigger_id)
+
+    previous = None
+    for index, sample in enumerate(dump.samples()):
+        changes = []
+        for bit, code in enumerate(ids[:-1]):
+            level = (sample >> bit) & 1
+            if previous is None or level != ((previous >> bit) & 1):
+                changes.append("%u%s" % (level, code))
+        if previous is None:
+            changes.append("0%s" % trigger_id)
+        if index == dump.trigger:
+            changes.append("1%s" % trigger_id)
+        elif index == dump.trigger + 1:
+            changes.append("0%s" % trigger_id)
+        if changes:
+            out.write("#%u\n%s\n" % (index * period_ps, "\n".join(changes)))
+        previous = sample
+    out.write("#%u\n" % (dump.word_count * (32 // dump.pin_count) * period_ps))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("capture", nargs="?", default="-", help="console capture or serial device, - for stdin")
+    parser.add_argument("--output", "-o", help="VCD file, stdout if omitted")
+    parser.add_argument("--index", type=int, default=-1, help="dump to convert, 0 for the first, the last by default")
+    parser.add_argument("--name", action="append", default=[], metavar="PIN=NAME",
+                        help="wire name of a FlexIO pin, may be repeated")
+    args = parser.parse_args()
+
+    names = {}
+    for item in args.name:
+        pin, _, name = item.partition("=")
+        if not pin.isdigit() or not name:
+            parser.error("--name expects PIN=NAME, got %s" % item)
+        names[int(pin)] = name
+
+    stream = sys.stdin if args.capture == "-" else open(args.capture, "r", errors="replace")
+    dumps = list(parse(stream))
+    if not dumps:
+        sys.exit("no complete capture dump found")
+    try:
+        dump = dumps[args.index]
+    except IndexError:
+        sys.exit("%u dumps found, no dump %d" % (len(dumps), args.index))
+    if dump.pin_count not in (1, 2, 4, 8):
+        sys.exit("unsupported pin count %u" % dump.pin_count)
+
+    out = open(args.output, "w") if args.output else sys.stdout
+    write_vcd(dump, out, names)
+    if args.output:
+        out.close()
+
+    samples = dump.word_count * (32 // dump.pin_count)
+    trigger = "none" if dump.trigger == NO_TRIGGER else "sample %u" % dump.trigger
+    sys.stderr.write("%u samples at %u samples/s, trigger %s, %u late, %u overruns\n"
+                     % (samples, dump.rate, trigger, dump.late, dump.overruns))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+/*
+ * Host stand-in for the SDK fsl_common.h, just what component/lists/fsl_component_lockfree_list.c
+ * needs, with its exclusive access hooks on C11 atomics.
+ */
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int32_t status_t;
+
+#define MAKE_STATUS(group, code) ((((group)*100) + (code)))
+#define kStatusGroup_LIST        (53)
+#define kStatus_Success          (0)
+
+/*
+ * LDREX/STREX as a compare and swap against the value loaded last by the thread. Unlike the
+ * monitor, the store succeeds if the pointer changed and changed back in between: the queues do not
+ * rely on that, a producer push and the consumer swap are both correct whatever happened before.
+ * StressPreempt() sometimes yields the CPU after the load and at the barriers, where an interrupt
+ * would hurt most on the target.
+ */
+typedef _Atomic(void *) volatile list_atomic_pointer_t;
+extern _Thread_local void *g_exclusiveValue;
+void StressPreempt(void);
+
+#define LIST_LOAD_EXCLUSIVE(addr)                                                  \
+    ((list_element_handle_t)(g_exclusiveValue = atomic_load_explicit(              \
+                                 (list_atomic_pointer_t *)(volatile void *)(addr), \
+                                 memory_order_acquire),                            \
+                             StressPreempt(), g_exclusiveValue))
+#define LIST_STORE_EXCLUSIVE(value, addr)                                                              \
+    (atomic_compare_exchange_strong_explicit((list_atomic_pointer_t *)(volatile void *)(addr),         \
+                                             &g_exclusiveValue, (void *)(value), memory_order_acq_rel, \
+                                             memory_order_relaxed) ?                                   \
+         0U :                                                                                          \
+         1U)
+#define LIST_CLEAR_EXCLUSIVE() ((void)0)
+#define LIST_MEMORY_BARRIER()  (StressPreempt(), atomic_thread_fence(memory_order_seq_cst))
+
+#endif /* _FSL_COMMON_H_ */
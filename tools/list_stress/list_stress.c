@@ -0,0 +1,230 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host stress test of the lock-free queues of component/lists/fsl_component_lockfree_list.c.
+ *
+ * The file includes the component source, with the exclusive access hooks of the local
+ * fsl_common.h mapped on C11 atomics. Producer and consumer threads hammer the queues with
+ * recycled elements, the consumer checks that every element comes out once, in the order of its
+ * producer, and that nothing is left when all are done. On a single CPU host the threads are
+ * preempted in the middle of pushes and swaps, the way interrupts preempt them on the target. Build
+ * and run from the repository root:
+ *
+ *   gcc -O2 -pthread -Itools/list_stress -Icomponent/lists tools/list_stress/list_stress.c \
+ *       -o list_stress && ./list_stress
+ *
+ * A queue with the exclusive store of LIST_MpscAddTail() made plain loses elements within a few
+ * thousand.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fsl_component_lockfree_list.c"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#ifndef STRESS_ELEMENTS
+#define STRESS_ELEMENTS (1000000U) /* Per producer */
+#endif
+#define STRESS_PRODUCERS    (4U)
+#define STRESS_POOL         (64U) /* Elements per producer, recycled */
+#define STRESS_RING         (16U) /* SPSC ring entries, fewer than the pool to hit the full queue */
+#define STRESS_PREEMPT_ODDS (16U)     /* Yields per call of the hooks, 1 in this many */
+#define STRESS_STALL        (100000U) /* Empty polls in a row taken for lost elements */
+
+typedef struct _stress_element
+{
+    list_element_t link; /* First member, the element handle is the element address */
+    uint32_t producer;
+    uint32_t sequence;
+    atomic_uint busy; /* Set by the producer while queued, cleared by the consumer */
+} stress_element_t;
+
+typedef struct _stress_producer
+{
+    uint32_t index;
+    bool mpsc;
+    stress_element_t pool[STRESS_POOL];
+} stress_producer_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+_Thread_local void *g_exclusiveValue;
+static _Thread_local uint32_t s_random = 0x2545F491U;
+
+static list_spsc_label_t s_spsc;
+static list_element_handle_t s_spscRing[STRESS_RING];
+static list_mpsc_label_t s_mpsc;
+static stress_producer_t s_producers[STRESS_PRODUCERS];
+static atomic_uint s_fullRetries;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Yields once in STRESS_PREEMPT_ODDS calls, a cheap xorshift decides. */
+void StressPreempt(void)
+{
+    s_random ^= s_random << 13;
+    s_random ^= s_random >> 17;
+    s_random ^= s_random << 5;
+    if ((s_random % STRESS_PREEMPT_ODDS) == 0U)
+    {
+        (void)sched_yield();
+    }
+}
+
+static void *StressProducer(void *arg)
+{
+    stress_producer_t *producer = (stress_producer_t *)arg;
+    stress_element_t *element;
+    uint32_t sequence;
+
+    s_random += producer->index * 0x9E3779B9U;
+
+    for (sequence = 0U; sequence < STRESS_ELEMENTS; sequence++)
+    {
+        element = &producer->pool[sequence % STRESS_POOL];
+        while (0U != atomic_load_explicit(&element->busy, memory_order_acquire))
+        {
+            (void)sched_yield(); /* Still queued, wait for the consumer */
+        }
+
+        element->producer = producer->index;
+        element->sequence = sequence;
+        atomic_store_explicit(&element->busy, 1U, memory_order_relaxed);
+
+        if (producer->mpsc)
+        {
+            (void)LIST_MpscAddTail(&s_mpsc, &element->link);
+        }
+        else
+        {
+            while (kLIST_Full == LIST_SpscAddTail(&s_spsc, &element->link))
+            {
+                atomic_fetch_add_explicit(&s_fullRetries, 1U, memory_order_relaxed);
+                (void)sched_yield();
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/* Consumes the elements of the producers, returns the number of errors. */
+static uint32_t StressConsume(bool mpsc, uint32_t producers)
+{
+    uint32_t expected[STRESS_PRODUCERS] = {0U};
+    uint32_t total                      = producers * STRESS_ELEMENTS;
+    uint32_t count                      = 0U;
+    uint32_t empty                      = 0U;
+    uint32_t stall                      = 0U;
+    uint32_t errors                     = 0U;
+    stress_element_t *element;
+
+    while (count < total)
+    {
+        element = (stress_element_t *)(void *)(mpsc ? LIST_MpscRemoveHead(&s_mpsc) : LIST_SpscRemoveHead(&s_spsc));
+        if (element == NULL)
+        {
+            empty++;
+            if (++stall == STRESS_STALL)
+            {
+                /* The producers wait for the lost elements forever. */
+                (void)printf("  stalled, %u elements lost\n  FAILED\n", total - count);
+                exit(1);
+            }
+            (void)sched_yield();
+            continue;
+        }
+        stall = 0U;
+
+        if ((element->producer >= producers) || (element->sequence != expected[element->producer]) ||
+            (0U == atomic_load_explicit(&element->busy, memory_order_relaxed)))
+        {
+            if (errors < 10U)
+            {
+                (void)printf("  element %u of producer %u out of order, expected %u\n", element->sequence,
+                             element->producer, (element->producer < producers) ? expected[element->producer] : 0U);
+            }
+            errors++;
+        }
+        else
+        {
+            expected[element->producer]++;
+        }
+
+        atomic_store_explicit(&element->busy, 0U, memory_order_release);
+        count++;
+    }
+
+    if ((mpsc ? (void *)LIST_MpscRemoveHead(&s_mpsc) : (void *)LIST_SpscRemoveHead(&s_spsc)) != NULL)
+    {
+        (void)printf("  queue not empty after the last element\n");
+        errors++;
+    }
+
+    (void)printf("  %u elements, %u empty polls, %u full retries\n", count, empty,
+                 atomic_load(&s_fullRetries));
+    return errors;
+}
+
+static uint32_t StressRun(bool mpsc, uint32_t producers)
+{
+    pthread_t threads[STRESS_PRODUCERS];
+    uint32_t errors;
+    uint32_t i;
+
+    atomic_store(&s_fullRetries, 0U);
+    for (i = 0U; i < producers; i++)
+    {
+        s_producers[i].index = i;
+        s_producers[i].mpsc  = mpsc;
+        if (0 != pthread_create(&threads[i], NULL, StressProducer, &s_producers[i]))
+        {
+            (void)printf("  thread creation failed\n");
+            exit(2);
+        }
+    }
+
+    errors = StressConsume(mpsc, producers);
+
+    for (i = 0U; i < producers; i++)
+    {
+        (void)pthread_join(threads[i], NULL);
+    }
+
+    return errors;
+}
+
+int main(void)
+{
+    uint32_t errors;
+    uint32_t failures = 0U;
+
+    (void)printf("SPSC, 1 producer:\n");
+    LIST_SpscInit(&s_spsc, s_spscRing, STRESS_RING);
+    errors = StressRun(false, 1U);
+    (void)printf("  %s\n", (errors == 0U) ? "ok" : "FAILED");
+    failures += errors;
+
+    (void)printf("MPSC, %u producers:\n", STRESS_PRODUCERS);
+    LIST_MpscInit(&s_mpsc);
+    errors = StressRun(true, STRESS_PRODUCERS);
+    (void)printf("  %s\n", (errors == 0U) ? "ok" : "FAILED");
+    failures += errors;
+
+    return (failures == 0U) ? 0 : 1;
+}
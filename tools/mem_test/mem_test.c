@@ -0,0 +1,621 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host correctness test of the memcpy, memset, memmove and memcmp of utilities/fsl_mem*.S.
+ *
+ * The functions below are the C sources given in the comment of each assembly file, the assembly
+ * follows them step by step. Every size up to TEST_MAX_SIZE is run at every source and destination
+ * offset in a double word, memmove at every overlap in both directions, memcmp with the first
+ * difference at every position. The whole buffer is checked against a byte loop, so a write
+ * outside the destination is found as well. Build and run from the repository root:
+ *
+ *   gcc -O2 -fno-builtin -fno-tree-loop-distribute-patterns -fno-strict-aliasing \
+ *       -fsanitize=address,undefined -fno-sanitize-recover tools/mem_test/mem_test.c -o mem_test && ./mem_test
+ *
+ * The undefined behaviour sanitizer stops at the first unaligned word or half word access, which
+ * would fault in device memory on the target.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Sizes 0..TEST_MAX_SIZE are run, past the 16 byte loops several times. */
+#define TEST_MAX_SIZE (80U)
+
+/* Source and destination offsets from a double word boundary. */
+#define TEST_OFFSETS (8U)
+
+/* memmove displacements -TEST_MAX_SHIFT..TEST_MAX_SHIFT between source and destination. */
+#define TEST_MAX_SHIFT (24U)
+
+/* Guard bytes around every destination. */
+#define TEST_GUARD (32U)
+
+#define TEST_AREA_SIZE (TEST_GUARD + TEST_OFFSETS + TEST_MAX_SHIFT + TEST_MAX_SIZE + TEST_MAX_SHIFT + TEST_GUARD)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint8_t s_area[TEST_AREA_SIZE] __attribute__((aligned(8)));
+static uint8_t s_expect[TEST_AREA_SIZE] __attribute__((aligned(8)));
+static uint8_t s_source[TEST_AREA_SIZE] __attribute__((aligned(8)));
+static uint8_t s_other[TEST_AREA_SIZE] __attribute__((aligned(8)));
+static uint32_t s_random = 0x12345678U;
+static uint32_t s_cases;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+#define __CPY_WORD(dst, src)                    \
+    *(uint32_t *)(dst) = *(uint32_t *)(src);    \
+    (dst)              = ((uint32_t *)dst) + 1; \
+    (src)              = ((uint32_t *)src) + 1
+
+#define __CPY_HWORD(dst, src)                   \
+    *(uint16_t *)(dst) = *(uint16_t *)(src);    \
+    (dst)              = ((uint16_t *)dst) + 1; \
+    (src)              = ((uint16_t *)src) + 1
+
+#define __CPY_BYTE(dst, src)                  \
+    *(uint8_t *)(dst) = *(uint8_t *)(src);    \
+    (dst)             = ((uint8_t *)dst) + 1; \
+    (src)             = ((uint8_t *)src) + 1
+
+/* utilities/fsl_memcpy.S */
+static void *MemCopy(void *restrict dst, const void *restrict src, size_t n)
+{
+    void *ret = dst;
+    uint32_t tmp;
+
+    if (0 == n)
+        return ret;
+
+    while (((uintptr_t)src & 0x03UL) != 0UL)
+    {
+        __CPY_BYTE(dst, src);
+        n--;
+
+        if (0 == n)
+            return ret;
+    }
+
+    if (((uintptr_t)dst & 0x03UL) == 0UL)
+    {
+        while (n >= 16UL)
+        {
+            __CPY_WORD(dst, src);
+            __CPY_WORD(dst, src);
+            __CPY_WORD(dst, src);
+            __CPY_WORD(dst, src);
+            n -= 16UL;
+        }
+
+        if ((n & 0x08UL) != 0UL)
+        {
+            __CPY_WORD(dst, src);
+            __CPY_WORD(dst, src);
+        }
+
+        if ((n & 0x04UL) != 0UL)
+        {
+            __CPY_WORD(dst, src);
+        }
+
+        if ((n & 0x02UL) != 0UL)
+        {
+            __CPY_HWORD(dst, src);
+        }
+
+        if ((n & 0x01UL) != 0UL)
+        {
+            __CPY_BYTE(dst, src);
+        }
+    }
+    else
+    {
+        if (((uintptr_t)dst & 1UL) == 0UL)
+        {
+            while (n >= 4)
+            {
+                tmp = *(uint32_t *)src;
+                src = ((uint32_t *)src) + 1;
+
+                *(volatile uint16_t *)dst = (uint16_t)tmp;
+                dst                       = ((uint16_t *)dst) + 1;
+                *(volatile uint16_t *)dst = (uint16_t)(tmp >> 16U);
+                dst                       = ((uint16_t *)dst) + 1;
+
+                n -= 4;
+            }
+        }
+        else
+        {
+            while (n >= 4)
+            {
+                tmp = *(uint32_t *)src;
+                src = ((uint32_t *)src) + 1;
+
+                *(volatile uint8_t *)dst  = (uint8_t)tmp;
+                dst                       = ((uint8_t *)dst) + 1;
+                *(volatile uint16_t *)dst = (uint16_t)(tmp >> 8U);
+                dst                       = ((uint16_t *)dst) + 1;
+                *(volatile uint8_t *)dst  = (uint8_t)(tmp >> 24U);
+                dst                       = ((uint8_t *)dst) + 1;
+                n -= 4;
+            }
+        }
+
+        while (n > 0)
+        {
+            __CPY_BYTE(dst, src);
+            n--;
+        }
+    }
+
+    return ret;
+}
+
+/* utilities/fsl_memset.S */
+static void *MemSet(void *s, int c, size_t n)
+{
+    uint8_t *dst = (uint8_t *)s;
+    uint32_t val = (uint32_t)(uint8_t)c * 0x01010101UL;
+
+    if (0 == n)
+        return s;
+
+    while (((uintptr_t)dst & 0x03UL) != 0UL)
+    {
+        *dst++ = (uint8_t)val;
+        n--;
+
+        if (0 == n)
+            return s;
+    }
+
+    while (n >= 16UL)
+    {
+        ((uint32_t *)dst)[0] = val;
+        ((uint32_t *)dst)[1] = val;
+        ((uint32_t *)dst)[2] = val;
+        ((uint32_t *)dst)[3] = val;
+        dst += 16;
+        n -= 16UL;
+    }
+
+    if ((n & 0x08UL) != 0UL)
+    {
+        ((uint32_t *)dst)[0] = val;
+        ((uint32_t *)dst)[1] = val;
+        dst += 8;
+    }
+
+    if ((n & 0x04UL) != 0UL)
+    {
+        *(uint32_t *)dst = val;
+        dst += 4;
+    }
+
+    if ((n & 0x02UL) != 0UL)
+    {
+        *(uint16_t *)dst = (uint16_t)val;
+        dst += 2;
+    }
+
+    if ((n & 0x01UL) != 0UL)
+    {
+        *dst = (uint8_t)val;
+    }
+
+    return s;
+}
+
+/* utilities/fsl_memmove.S */
+static void *MemMove(void *dst, const void *src, size_t n)
+{
+    uint8_t *d;
+    const uint8_t *s;
+    uint32_t tmp;
+
+    if (dst == src)
+        return dst;
+
+    if (((uintptr_t)dst - (uintptr_t)src) >= n)
+        return MemCopy(dst, src, n);
+
+    d = (uint8_t *)dst + n;
+    s = (const uint8_t *)src + n;
+
+    while (((uintptr_t)s & 0x03UL) != 0UL)
+    {
+        *--d = *--s;
+        n--;
+
+        if (0 == n)
+            return dst;
+    }
+
+    if (((uintptr_t)d & 0x03UL) == 0UL)
+    {
+        while (n >= 16UL)
+        {
+            d -= 16;
+            s -= 16;
+            ((uint32_t *)d)[3] = ((const uint32_t *)s)[3];
+            ((uint32_t *)d)[2] = ((const uint32_t *)s)[2];
+            ((uint32_t *)d)[1] = ((const uint32_t *)s)[1];
+            ((uint32_t *)d)[0] = ((const uint32_t *)s)[0];
+            n -= 16UL;
+        }
+
+        if ((n & 0x08UL) != 0UL)
+        {
+            d -= 8;
+            s -= 8;
+            ((uint32_t *)d)[1] = ((const uint32_t *)s)[1];
+            ((uint32_t *)d)[0] = ((const uint32_t *)s)[0];
+        }
+
+        if ((n & 0x04UL) != 0UL)
+        {
+            d -= 4;
+            s -= 4;
+            *(uint32_t *)d = *(const uint32_t *)s;
+        }
+
+        if ((n & 0x02UL) != 0UL)
+        {
+            d -= 2;
+            s -= 2;
+            *(uint16_t *)d = *(const uint16_t *)s;
+        }
+
+        if ((n & 0x01UL) != 0UL)
+        {
+            *--d = *--s;
+        }
+    }
+    else
+    {
+        if (((uintptr_t)d & 1UL) == 0UL)
+        {
+            while (n >= 4)
+            {
+                s -= 4;
+                tmp = *(const uint32_t *)s;
+
+                d -= 2;
+                *(volatile uint16_t *)d = (uint16_t)(tmp >> 16U);
+                d -= 2;
+                *(volatile uint16_t *)d = (uint16_t)tmp;
+
+                n -= 4;
+            }
+        }
+        else
+        {
+            while (n >= 4)
+            {
+                s -= 4;
+                tmp = *(const uint32_t *)s;
+
+                d -= 1;
+                *(volatile uint8_t *)d = (uint8_t)(tmp >> 24U);
+                d -= 2;
+                *(volatile uint16_t *)d = (uint16_t)(tmp >> 8U);
+                d -= 1;
+                *(volatile uint8_t *)d = (uint8_t)tmp;
+
+                n -= 4;
+            }
+        }
+
+        while (n > 0)
+        {
+            *--d = *--s;
+            n--;
+        }
+    }
+
+    return dst;
+}
+
+/* utilities/fsl_memcmp.S */
+static int MemCompare(const void *s1, const void *s2, size_t n)
+{
+    const uint8_t *p1 = (const uint8_t *)s1;
+    const uint8_t *p2 = (const uint8_t *)s2;
+    uint32_t w1;
+    uint32_t w2;
+    uint32_t shift;
+
+    if ((((uintptr_t)p1 ^ (uintptr_t)p2) & 0x03UL) == 0UL)
+    {
+        while (((uintptr_t)p1 & 0x03UL) != 0UL)
+        {
+            if (0 == n)
+                return 0;
+            if (*p1 != *p2)
+                return (int)*p1 - (int)*p2;
+            p1++;
+            p2++;
+            n--;
+        }
+
+        while (n >= 4UL)
+        {
+            w1 = *(const uint32_t *)p1;
+            w2 = *(const uint32_t *)p2;
+            if (w1 != w2)
+            {
+                shift = (uint32_t)__builtin_ctz(w1 ^ w2) & ~0x07UL;
+                return (int)((w1 >> shift) & 0xFFUL) - (int)((w2 >> shift) & 0xFFUL);
+            }
+            p1 += 4;
+            p2 += 4;
+            n -= 4UL;
+        }
+    }
+
+    while (n > 0UL)
+    {
+        if (*p1 != *p2)
+            return (int)*p1 - (int)*p2;
+        p1++;
+        p2++;
+        n--;
+    }
+
+    return 0;
+}
+
+static uint8_t TestRandom(void)
+{
+    s_random = (s_random * 1664525U) + 1013904223U;
+
+    return (uint8_t)(s_random >> 24U);
+}
+
+static void TestFill(uint8_t *buffer, size_t size)
+{
+    size_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        buffer[i] = TestRandom();
+    }
+}
+
+static bool TestArea(const char *name, size_t size, uint32_t dstOffset, int32_t shift, bool retOk)
+{
+    size_t i;
+
+    s_cases++;
+    if (!retOk)
+    {
+        printf("%s: wrong return value, size %zu offset %u shift %d\n", name, size, dstOffset, shift);
+        return false;
+    }
+    for (i = 0U; i < TEST_AREA_SIZE; i++)
+    {
+        if (s_area[i] != s_expect[i])
+        {
+            printf("%s: byte %zu is 0x%02x, not 0x%02x, size %zu offset %u shift %d\n", name, i, s_area[i],
+                   s_expect[i], size, dstOffset, shift);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool TestCopy(void)
+{
+    uint8_t *dst;
+    const uint8_t *src;
+    uint32_t dstOffset;
+    uint32_t srcOffset;
+    size_t size;
+    size_t i;
+
+    for (size = 0U; size <= TEST_MAX_SIZE; size++)
+    {
+        for (dstOffset = 0U; dstOffset < TEST_OFFSETS; dstOffset++)
+        {
+            for (srcOffset = 0U; srcOffset < TEST_OFFSETS; srcOffset++)
+            {
+                TestFill(s_area, TEST_AREA_SIZE);
+                TestFill(s_source, TEST_AREA_SIZE);
+                (void)memcpy(s_expect, s_area, TEST_AREA_SIZE);
+                dst = &s_area[TEST_GUARD + dstOffset];
+                src = &s_source[TEST_GUARD + srcOffset];
+                for (i = 0U; i < size; i++)
+                {
+                    s_expect[TEST_GUARD + dstOffset + i] = src[i];
+                }
+                if (!TestArea("memcpy", size, dstOffset, (int32_t)srcOffset, MemCopy(dst, src, size) == dst))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static bool TestSet(void)
+{
+    static const int values[] = {0x00, 0xA5, 0xFF, 0x1234, -1};
+    uint8_t *dst;
+    uint32_t dstOffset;
+    uint32_t v;
+    size_t size;
+    size_t i;
+
+    for (size = 0U; size <= TEST_MAX_SIZE; size++)
+    {
+        for (dstOffset = 0U; dstOffset < TEST_OFFSETS; dstOffset++)
+        {
+            for (v = 0U; v < (sizeof(values) / sizeof(values[0])); v++)
+            {
+                TestFill(s_area, TEST_AREA_SIZE);
+                (void)memcpy(s_expect, s_area, TEST_AREA_SIZE);
+                dst = &s_area[TEST_GUARD + dstOffset];
+                for (i = 0U; i < size; i++)
+                {
+                    s_expect[TEST_GUARD + dstOffset + i] = (uint8_t)values[v];
+                }
+                if (!TestArea("memset", size, dstOffset, values[v], MemSet(dst, values[v], size) == dst))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static bool TestMove(void)
+{
+    uint8_t *dst;
+    const uint8_t *src;
+    uint32_t dstOffset;
+    int32_t shift;
+    size_t size;
+    size_t i;
+
+    for (size = 0U; size <= TEST_MAX_SIZE; size++)
+    {
+        for (dstOffset = 0U; dstOffset < TEST_OFFSETS; dstOffset++)
+        {
+            for (shift = -(int32_t)TEST_MAX_SHIFT; shift <= (int32_t)TEST_MAX_SHIFT; shift++)
+            {
+                TestFill(s_area, TEST_AREA_SIZE);
+                (void)memcpy(s_expect, s_area, TEST_AREA_SIZE);
+                dst = &s_area[TEST_GUARD + TEST_MAX_SHIFT + dstOffset];
+                src = dst - shift;
+                for (i = 0U; i < size; i++)
+                {
+                    s_other[i] = src[i];
+                }
+                for (i = 0U; i < size; i++)
+                {
+                    s_expect[TEST_GUARD + TEST_MAX_SHIFT + dstOffset + i] = s_other[i];
+                }
+                if (!TestArea("memmove", size, dstOffset, shift, MemMove(dst, src, size) == dst))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static int TestCompareBytes(const uint8_t *p1, const uint8_t *p2, size_t n)
+{
+    size_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        if (p1[i] != p2[i])
+        {
+            return (int)p1[i] - (int)p2[i];
+        }
+    }
+
+    return 0;
+}
+
+static bool TestCompareOne(const uint8_t *p1, const uint8_t *p2, size_t size, uint32_t offset1, uint32_t offset2)
+{
+    int expect = TestCompareBytes(p1, p2, size);
+    int result = MemCompare(p1, p2, size);
+    int libc   = memcmp(p1, p2, size);
+
+    s_cases++;
+    if ((result != expect) || ((libc < 0) != (result < 0)) || ((libc > 0) != (result > 0)))
+    {
+        printf("memcmp: returned %d, not %d (libc %d), size %zu offsets %u/%u\n", result, expect, libc, size, offset1,
+               offset2);
+        return false;
+    }
+
+    return true;
+}
+
+static bool TestCompare(void)
+{
+    uint8_t *p1;
+    uint8_t *p2;
+    uint32_t offset1;
+    uint32_t offset2;
+    size_t size;
+    size_t pos;
+    size_t i;
+
+    for (size = 0U; size <= TEST_MAX_SIZE; size++)
+    {
+        for (offset1 = 0U; offset1 < TEST_OFFSETS; offset1++)
+        {
+            for (offset2 = 0U; offset2 < TEST_OFFSETS; offset2++)
+            {
+                p1 = &s_area[TEST_GUARD + offset1];
+                p2 = &s_other[TEST_GUARD + offset2];
+                TestFill(p1, size);
+                (void)memcpy(p2, p1, size);
+                if (!TestCompareOne(p1, p2, size, offset1, offset2))
+                {
+                    return false;
+                }
+
+                /* First difference at every position, either sign, later bytes scrambled. */
+                for (pos = 0U; pos < size; pos++)
+                {
+                    (void)memcpy(p2, p1, size);
+                    p2[pos] = (uint8_t)(p1[pos] + 1U + (TestRandom() % 255U));
+                    for (i = pos + 1U; i < size; i++)
+                    {
+                        p2[i] = ((TestRandom() & 1U) != 0U) ? TestRandom() : p1[i];
+                    }
+                    if (!TestCompareOne(p1, p2, size, offset1, offset2) ||
+                        !TestCompareOne(p2, p1, size, offset2, offset1))
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+int main(void)
+{
+    if (!TestCopy() || !TestSet() || !TestMove() || !TestCompare())
+    {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("memcpy, memset, memmove, memcmp: %u cases passed, sizes 0..%u, offsets 0..%u.\n", s_cases,
+           TEST_MAX_SIZE, TEST_OFFSETS - 1U);
+
+    return 0;
+}
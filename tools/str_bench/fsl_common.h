@@ -0,0 +1,19 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+/* Host stand-in for the SDK fsl_common.h, just what utilities/fsl_str.c needs. */
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef int32_t status_t;
+
+#endif /* _FSL_COMMON_H_ */
@@ -0,0 +1,260 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host benchmark of the integer conversion shared by StrFormatPrintf() and PRINTF.
+ *
+ * The file includes utilities/fsl_str.c to reach its static kernel, and compares it with the
+ * divide/modulo per digit conversion it replaced: same output for every radix, then the time per
+ * formatted field on value sets typical of the telemetry lines. Build and run from the repository
+ * root, once per printf flavour:
+ *
+ *   gcc -O2 -Itools/str_bench -Iutilities -w tools/str_bench/str_bench.c -o str_bench && ./str_bench
+ *   gcc -O2 -Itools/str_bench -Iutilities -w -DPRINTF_ADVANCED_ENABLE=1 tools/str_bench/str_bench.c \
+ *       -o str_bench && ./str_bench
+ *
+ * On x86 the figures are TSC ticks, elsewhere nanoseconds. The ratio is what carries over to the
+ * Cortex-M33, where the divide per digit costs more than on the host.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "fsl_str.c"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_VALUES  (4096U)
+#define BENCH_ROUNDS  (200U)
+#define BENCH_RANDOMS (2000000U)
+
+typedef int32_t (*bench_convert_t)(char *numstr, void *nump, unsigned int neg, unsigned int radix, bool use_caps);
+
+typedef struct _bench_set
+{
+    const char *name;
+    unsigned int radix;
+    unsigned int neg;
+    STR_FORMAT_PRINTF_UVAL_TYPE mask;
+} bench_set_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static STR_FORMAT_PRINTF_UVAL_TYPE s_values[BENCH_VALUES];
+static volatile int32_t s_sink;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* The conversion before the shared core: one division and one modulo per digit. */
+static int32_t RefConvertRadixNumToString(char *numstr, void *nump, unsigned int neg, unsigned int radix, bool use_caps)
+{
+    STR_FORMAT_PRINTF_UVAL_TYPE ua;
+    STR_FORMAT_PRINTF_UVAL_TYPE ub;
+    STR_FORMAT_PRINTF_UVAL_TYPE uc;
+    int32_t nlen = 0;
+    char *nstrp  = numstr;
+
+    *nstrp++ = '\0';
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+    if (0U != neg)
+    {
+        STR_FORMAT_PRINTF_IVAL_TYPE a = *(STR_FORMAT_PRINTF_IVAL_TYPE *)nump;
+        STR_FORMAT_PRINTF_IVAL_TYPE b;
+        STR_FORMAT_PRINTF_IVAL_TYPE c;
+
+        if (a == 0)
+        {
+            *nstrp = '0';
+            return 1;
+        }
+        while (a != 0)
+        {
+            b = a / (STR_FORMAT_PRINTF_IVAL_TYPE)radix;
+            c = a - (b * (STR_FORMAT_PRINTF_IVAL_TYPE)radix);
+            *nstrp++ = (char)(((c < 0) ? -c : c) + '0');
+            a        = b;
+            nlen++;
+        }
+        return nlen;
+    }
+#else
+    (void)neg;
+#endif
+    ua = *(STR_FORMAT_PRINTF_UVAL_TYPE *)nump;
+    if (ua == 0U)
+    {
+        *nstrp = '0';
+        return 1;
+    }
+    while (ua != 0U)
+    {
+        ub = ua / radix;
+        uc = ua - (ub * radix);
+        *nstrp++ = (char)((uc < 10U) ? (uc + '0') : (uc - 10U + (use_caps ? 'A' : 'a')));
+        ua       = ub;
+        nlen++;
+    }
+    return nlen;
+}
+
+static uint64_t BenchNow(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static STR_FORMAT_PRINTF_UVAL_TYPE BenchRandom(void)
+{
+    static uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+    /* xorshift64*, reproducible between runs. */
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return (STR_FORMAT_PRINTF_UVAL_TYPE)(state * 0x2545F4914F6CDD1DULL);
+}
+
+/* Compares both conversions on one value, returns false on a mismatch. */
+static bool BenchCheck(STR_FORMAT_PRINTF_UVAL_TYPE value, unsigned int radix, unsigned int neg, bool use_caps)
+{
+    char expected[80];
+    char actual[80];
+    int32_t expectedLen = RefConvertRadixNumToString(expected, &value, neg, radix, use_caps);
+    int32_t actualLen   = ConvertRadixNumToString(actual, &value, neg, radix, use_caps);
+
+    if ((expectedLen != actualLen) || (memcmp(expected, actual, (size_t)actualLen + 1U) != 0))
+    {
+        printf("Mismatch: value 0x%llx radix %u neg %u: %.*s / %.*s (reversed)\n", (unsigned long long)value, radix,
+               neg, (int)expectedLen, &expected[1], (int)actualLen, &actual[1]);
+        return false;
+    }
+    return true;
+}
+
+static bool BenchCheckAll(void)
+{
+    static const unsigned int radixes[] = {2U, 8U, 10U, 16U};
+    STR_FORMAT_PRINTF_UVAL_TYPE value;
+    STR_FORMAT_PRINTF_UVAL_TYPE power;
+    unsigned int r;
+    unsigned int neg;
+    uint32_t i;
+    bool ok = true;
+
+    for (r = 0U; r < (sizeof(radixes) / sizeof(radixes[0])); r++)
+    {
+        /* Signed conversions only exist in decimal, %d and %i. */
+        for (neg = 0U; neg < ((radixes[r] == 10U) ? 2U : 1U); neg++)
+        {
+            /* Around every power of the radix, then random values. */
+            for (power = 1U; power != 0U; power = (power > ((STR_FORMAT_PRINTF_UVAL_TYPE)-1 / radixes[r])) ?
+                                                      0U :
+                                                      power * radixes[r])
+            {
+                for (value = power - 2U; value != power + 2U; value++)
+                {
+                    ok = ok && BenchCheck(value, radixes[r], neg, (neg != 0U));
+                }
+            }
+            for (i = 0U; i < BENCH_RANDOMS; i++)
+            {
+                value = BenchRandom() >> (BenchRandom() & 63U);
+                ok    = ok && BenchCheck(value, radixes[r], neg, (i & 1U) != 0U);
+            }
+            ok = ok && BenchCheck((STR_FORMAT_PRINTF_UVAL_TYPE)-1, radixes[r], neg, false);
+        }
+    }
+
+    return ok;
+}
+
+static double BenchRun(bench_convert_t convert, const bench_set_t *set)
+{
+    char vstr[80];
+    uint64_t start;
+    uint64_t best = UINT64_MAX;
+    uint64_t elapsed;
+    uint32_t round;
+    uint32_t i;
+    int32_t len = 0;
+
+    for (round = 0U; round < BENCH_ROUNDS; round++)
+    {
+        start = BenchNow();
+        for (i = 0U; i < BENCH_VALUES; i++)
+        {
+            len += convert(vstr, &s_values[i], set->neg, set->radix, false);
+        }
+        elapsed = BenchNow() - start;
+        best    = (elapsed < best) ? elapsed : best;
+    }
+    s_sink = len;
+
+    return (double)best / (double)BENCH_VALUES;
+}
+
+int main(void)
+{
+    static const bench_set_t sets[] = {
+        {"%u, 0..99", 10U, 0U, 127U},
+        {"%u, PWM ticks 0..65535", 10U, 0U, 0xFFFFU},
+        {"%d, full range", 10U, 1U, (STR_FORMAT_PRINTF_UVAL_TYPE)-1},
+        {"%x, full range", 16U, 0U, (STR_FORMAT_PRINTF_UVAL_TYPE)-1},
+        {"%o, full range", 8U, 0U, (STR_FORMAT_PRINTF_UVAL_TYPE)-1},
+    };
+    double reference;
+    double shared;
+    uint32_t s;
+    uint32_t i;
+
+    printf("Integer conversion, %u-bit values.\n", (unsigned int)(sizeof(STR_FORMAT_PRINTF_UVAL_TYPE) * 8U));
+    if (!BenchCheckAll())
+    {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("Output identical to the reference for radix 2, 8, 10 and 16.\n\n");
+    printf("%-24s %12s %12s %8s\n", "Field", "reference", "shared", "speedup");
+
+    for (s = 0U; s < (sizeof(sets) / sizeof(sets[0])); s++)
+    {
+        for (i = 0U; i < BENCH_VALUES; i++)
+        {
+            s_values[i] = BenchRandom() & sets[s].mask;
+            if (sets[s].mask == 127U)
+            {
+                s_values[i] %= 100U;
+            }
+        }
+        reference = BenchRun(RefConvertRadixNumToString, &sets[s]);
+        shared    = BenchRun(ConvertRadixNumToString, &sets[s]);
+        printf("%-24s %12.1f %12.1f %7.2fx\n", sets[s].name, reference, shared, reference / shared);
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    printf("\nTime per field in TSC ticks, best of %u rounds.\n", BENCH_ROUNDS);
+#else
+    printf("\nTime per field in ns, best of %u rounds.\n", BENCH_ROUNDS);
+#endif
+
+    return 0;
+}
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 NXP
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Decodes the binary PWM telemetry of source/app_telemetry.h into CSV.
+
+The capture is a file, a serial device or stdin. Frames are COBS encoded and end with a zero byte,
+frames with a bad CRC and bytes before the first delimiter (e.g. the console text) are skipped.
+
+Without --output the duty samples go to stdout, one row per sample. With --output PREFIX every
+frame type gets its own file: PREFIX_duty.csv, PREFIX_state.csv, PREFIX_fault.csv and
+PREFIX_timing.csv.
+
+    stty -F /dev/ttyACM0 3000000 raw
+    tools/telemetry_decode.py /dev/ttyACM0 --output run1
+"""
+
+import argparse
+import csv
+import struct
+import sys
+
+FRAME_DUTY = 1
+FRAME_STATE = 2
+FRAME_FAULT = 3
+FRAME_TIMING = 4
+
+DUTY_HIGH = 0xFFFF
+
+STATE_FLAGS = ((1, "ramp"), (2, "burst"), (4, "clock_change"))
+FAULT_FLAGS = ((1, "sample_overflow"), (2, "tx_overflow"), (4, "sample_late"), (8, "dma_error"))
+
+# Channels of the state frame columns, FLEXIO_CPWM_MAX_CHANNELS.
+MAX_CHANNELS = 4
+
+STATE_COLUMNS = ["sample", "timestamp", "flexio_clock_hz", "core_clock_hz", "period_ticks", "divider",
+                 "flags", "staged_mask"] + ["ch%u_%s" % (ch, kind) for ch in range(MAX_CHANNELS)
+                                            for kind in ("on_ticks", "staged_ticks")]
+FAULT_COLUMNS = ["sample", "faults", "sample_drops", "frame_drops", "late_samples", "dma_errors"]
+TIMING_COLUMNS = ["sample", "count", "interval_min", "interval_mean", "interval_max", "handler_mean",
+                  "handler_max", "poll_min", "poll_mean", "poll_max"]
+
+
+def cobs_decode(data):
+    out = bytearray()
+    pos = 0
+    while pos < len(data):
+        code = data[pos]
+        if code == 0 or pos + code > len(data):
+            return None
+        out += data[pos + 1:pos + code]
+        pos += code
+        if code < 0xFF and pos < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE."""
+    crc = 0xFFFF
+    for b in data:
+        x = ((crc >> 8) ^ b) & 0xFF
+        x ^= x >> 4
+        crc = ((crc << 8) ^ (x << 12) ^ (x << 5) ^ x) & 0xFFFF
+    return crc
+
+
+def flag_names(value, names):
+    return "|".join(name for bit, name in names if value & bit)
+
+
+class Decoder:
+    def __init__(self, writers):
+        self.writers = writers
+        self.state = None
+        self.sequence = None
+        self.frames = 0
+        self.bad = 0
+        self.lost = 0
+        self.duty_header = False
+
+    def frame(self, encoded, synced=True):
+        payload = cobs_decode(encoded)
+        if payload is None or len(payload) < 4 or crc16(payload[:-2]) != (payload[-2] | (payload[-1] << 8)):
+            self.bad += 1 if synced else 0
+            return
+        kind, seq = payload[0], payload[1]
+        body = payload[2:-2]
+        if self.sequence is not None and seq != ((self.sequence + 1) & 0xFF):
+            self.lost += (seq - self.sequence - 1) & 0xFF
+        self.sequence = seq
+        self.frames += 1
+
+        handler = {FRAME_DUTY: self.duty, FRAME_STATE: self.state_frame, FRAME_FAULT: self.fault,
+                   FRAME_TIMING: self.timing}.get(kind)
+        if handler is not None:
+            try:
+                handler(body)
+            except struct.error:
+                self.bad += 1
+
+    def duty(self, body):
+        first, channels, count, divider = struct.unpack_from("<IBBH", body, 0)
+        values = struct.unpack_from("<%dH" % (channels * count), body, 8)
+        writer = self.writers.get(FRAME_DUTY)
+        if writer is None:
+            return
+        if not self.duty_header:
+            columns = ["sample", "period", "time_us"]
+            for ch in range(channels):
+                columns += ["ch%u_ticks" % ch, "ch%u_duty" % ch]
+            writer.writerow(columns)
+            self.duty_header = True
+
+        period_ticks = self.state["period_ticks"] if self.state else 0
+        pwm_hz = self.state["flexio_clock_hz"] / period_ticks if period_ticks else 0.0
+        for n in range(count):
+            sample = first + n
+            period = sample * divider
+            row = [sample, period, "%.3f" % (period * 1e6 / pwm_hz) if pwm_hz else ""]
+            for ch in range(channels):
+                half = values[n * channels + ch]
+                if half == DUTY_HIGH:
+                    ticks = period_ticks if period_ticks else ""
+                    duty = "100.000"
+                else:
+                    ticks = 2 * half
+                    duty = "%.3f" % (100.0 * ticks / period_ticks) if period_ticks else ""
+                row += [ticks, duty]
+            writer.writerow(row)
+
+    def state_frame(self, body):
+        sample, stamp, flexio_hz, core_hz, period_ticks, divider, channels, flags, staged = struct.unpack_from(
+            "<IIIIIHBBI", body, 0)
+        ticks = struct.unpack_from("<%dI" % (2 * channels), body, 28)
+        self.state = {"period_ticks": period_ticks, "flexio_clock_hz": flexio_hz}
+        writer = self.writers.get(FRAME_STATE)
+        if writer is not None:
+            writer.writerow([sample, stamp, flexio_hz, core_hz, period_ticks, divider, flag_names(flags, STATE_FLAGS),
+                             "0x%x" % staged] + list(ticks) + [""] * (2 * (MAX_CHANNELS - channels)))
+
+    def fault(self, body):
+        sample, faults, drops, frame_drops, late, dma = struct.unpack_from("<6I", body, 0)
+        if faults:
+            sys.stderr.write("sample %u: %s\n" % (sample, flag_names(faults, FAULT_FLAGS) or "0x%x" % faults))
+        writer = self.writers.get(FRAME_FAULT)
+        if writer is not None:
+            writer.writerow([sample, flag_names(faults, FAULT_FLAGS) or ("0x%x" % faults if faults else ""), drops,
+                             frame_drops, late, dma])
+
+    def timing(self, body):
+        writer = self.writers.get(FRAME_TIMING)
+        if writer is not None:
+            writer.writerow(struct.unpack_from("<10I", body, 0))
+
+
+def decode(stream, decoder):
+    buf = b""
+    synced = False
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            break
+        buf += chunk
+        frames = buf.split(b"\0")
+        buf = frames.pop()
+        for encoded in frames:
+            # Whatever came before the first delimiter may be a partial frame or console text.
+            if encoded:
+                decoder.frame(encoded, synced)
+            synced = True
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("capture", nargs="?", default="-", help="UART capture or serial device, - for stdin")
+    parser.add_argument("--output", "-o", help="prefix of the CSV files, duty samples to stdout if omitted")
+    args = parser.parse_args()
+
+    files = []
+    if args.output:
+        writers = {}
+        for kind, name, columns in ((FRAME_DUTY, "duty", None), (FRAME_STATE, "state", STATE_COLUMNS),
+                                    (FRAME_FAULT, "fault", FAULT_COLUMNS), (FRAME_TIMING, "timing", TIMING_COLUMNS)):
+            f = open("%s_%s.csv" % (args.output, name), "w", newline="")
+            files.append(f)
+            writers[kind] = csv.writer(f)
+            if columns:
+                writers[kind].writerow(columns)
+    else:
+        writers = {FRAME_DUTY: csv.writer(sys.stdout)}
+
+    decoder = Decoder(writers)
+    stream = sys.stdin.buffer if args.capture == "-" else open(args.capture, "rb", buffering=0)
+    try:
+        decode(stream, decoder)
+    except KeyboardInterrupt:
+        pass
+    for f in files:
+        f.close()
+    sys.stderr.write("%u frames, %u bad, %u lost\n" % (decoder.frames, decoder.bad, decoder.lost))
+
+
+if __name__ == "__main__":
+    main()
@@ -12,7 +12,6 @@
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 #include <stdio.h>
 #endif
-#include <math.h>
 #include "fsl_debug_console.h"
 #include "fsl_adapter_uart.h"
 #include "fsl_str.h"
@@ -29,11 +28,6 @@
 /*! @brief This definition is maximum line that debugconsole can scanf each time.*/
 #define IO_MAXLINE 20U
 
-/*! @brief The overflow value.*/
-#ifndef HUGE_VAL
-#define HUGE_VAL (99.e99)
-#endif /* HUGE_VAL */
-
 /*! @brief State structure storing debug console. */
 typedef struct DebugConsoleState
 {
@@ -47,8 +41,42 @@ typedef struct DebugConsoleState
     serial_port_type_t serial_port_type;         /*!< The initialized port of the debug console. */
 } debug_console_state_t;
 
-/*! @brief Type of KSDK printf function pointer. */
-typedef int (*PUTCHAR_FUNC)(int a);
+/*! @brief PRINTF and PUTCHAR go through the TX ring, drained by the UART adapter interrupt. */
+#if (defined(SDK_DEBUGCONSOLE) && (SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK)) && \
+    defined(DEBUG_CONSOLE_TRANSFER_NON_BLOCKING)
+#define DEBUG_CONSOLE_TX_RING_ENABLE 1U
+#else
+#define DEBUG_CONSOLE_TX_RING_ENABLE 0U
+#endif
+
+#if (DEBUG_CONSOLE_TX_RING_ENABLE > 0U)
+#if (defined(HAL_UART_TRANSFER_MODE) && (HAL_UART_TRANSFER_MODE > 0U))
+#error "The debug console TX ring uses the functional non-blocking API, set HAL_UART_TRANSFER_MODE to 0."
+#endif
+#if ((DEBUG_CONSOLE_TX_RING_SIZE & (DEBUG_CONSOLE_TX_RING_SIZE - 1U)) != 0U)
+#error "DEBUG_CONSOLE_TX_RING_SIZE must be a power of two."
+#endif
+
+/*! @brief Ring index mask. */
+#define DEBUG_CONSOLE_TX_RING_MASK (DEBUG_CONSOLE_TX_RING_SIZE - 1U)
+
+/*!
+ * @brief TX ring state.
+ *
+ * The indexes are free running. head is claimed with interrupts masked, so a PRINTF from an
+ * interrupt cannot move it under a preempted one. The UART interrupt (through the adapter
+ * callback) is the only writer of tail. The bytes [tail, tail + inFlight) are owned by the adapter
+ * until it reports kStatus_HAL_UartTxIdle.
+ */
+typedef struct DebugConsoleTxRing
+{
+    uint8_t buffer[DEBUG_CONSOLE_TX_RING_SIZE];
+    volatile uint32_t head;         /*!< Next byte to write, written with interrupts masked. */
+    volatile uint32_t tail;         /*!< Oldest byte not sent yet, owned by the drain. */
+    volatile uint32_t inFlight;     /*!< Bytes handed to the adapter, 0 when the UART is idle. */
+    debug_console_tx_stats_t stats; /*!< Counters, written with interrupts masked. */
+} debug_console_tx_ring_t;
+#endif /* DEBUG_CONSOLE_TX_RING_ENABLE */
 
 /*******************************************************************************
  * Variables
@@ -58,12 +86,22 @@ typedef int (*PUTCHAR_FUNC)(int a);
 static debug_console_state_t s_debugConsole;
 #endif
 
+#if (DEBUG_CONSOLE_TX_RING_ENABLE > 0U)
+/*! @brief Debug console TX ring. */
+static debug_console_tx_ring_t s_debugConsoleTxRing;
+#endif /* DEBUG_CONSOLE_TX_RING_ENABLE */
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
 #if (defined(SDK_DEBUGCONSOLE) && (SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK))
-static int DbgConsole_PrintfFormattedData(PUTCHAR_FUNC func_ptr, const char *fmt, va_list ap);
+static void DbgConsole_PrintCallback(char *buf, int32_t *indicator, char dbgVal, int len);
 #endif /* SDK_DEBUGCONSOLE */
+#if (DEBUG_CONSOLE_TX_RING_ENABLE > 0U)
+static void DbgConsole_TxRingKick(void);
+static void DbgConsole_TxRingCallback(hal_uart_handle_t handle, hal_uart_status_t status, void *callbackParam);
+static int DbgConsole_TxRingPut(int dbgConsoleCh);
+#endif /* DEBUG_CONSOLE_TX_RING_ENABLE */
 
 /*******************************************************************************
  * Code
@@ -103,6 +141,13 @@ status_t DbgConsole_Init(uint8_t instance, uint32_t baudRate, serial_port_type_t
     /* Set the function pointer for send and receive for this kind of device. */
     s_debugConsole.putChar = HAL_UartSendBlocking;
     s_debugConsole.getChar = HAL_UartReceiveBlocking;
+#if (DEBUG_CONSOLE_TX_RING_ENABLE > 0U)
+    s_debugConsoleTxRing.head     = 0U;
+    s_debugConsoleTxRing.tail     = 0U;
+    s_debugConsoleTxRing.inFlight = 0U;
+    (void)HAL_UartInstallCallback((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0], DbgConsole_TxRingCallback,
+                                  NULL);
+#endif /* DEBUG_CONSOLE_TX_RING_ENABLE */
 
     return kStatus_Success;
 }
@@ -115,6 +160,9 @@ status_t DbgConsole_Deinit(void)
         return kStatus_Success;
     }
 
+#if (DEBUG_CONSOLE_TX_RING_ENABLE > 0U)
+    (void)DbgConsole_Flush();
+#endif /* DEBUG_CONSOLE_TX_RING_ENABLE */
     (void)HAL_UartDeinit((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0]);
 
     s_debugConsole.serial_port_type = kSerialPort_None;
@@ -127,6 +175,9 @@ status_t DbgConsole_EnterLowpower(void)
     hal_uart_status_t DbgConsoleUartStatus = kStatus_HAL_UartError;
     if (kSerialPort_Uart == s_debugConsole.serial_port_type)
     {
+#if (DEBUG_CONSOLE_TX_RING_ENABLE > 0U)
+        (void)DbgConsole_Flush();
+#endif /* DEBUG_CONSOLE_TX_RING_ENABLE */
         DbgConsoleUartStatus = HAL_UartEnterLowpower((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0]);
     }
     return (status_t)DbgConsoleUartStatus;
@@ -170,7 +221,12 @@ int DbgConsole_Vprintf(const char *fmt_s, va_list formatStringArg)
         return -1;
     }
 
-    result = DbgConsole_PrintfFormattedData(DbgConsole_Putchar, fmt_s, formatStringArg);
+    /* Same formatting engine as the string formatter of fsl_str.c. */
+    result = StrFormatPrintf(fmt_s, formatStringArg, NULL, DbgConsole_PrintCallback);
+#if (DEBUG_CONSOLE_TX_RING_ENABLE > 0U)
+    /* The string is in the ring, start the UART once for all of it. */
+    DbgConsole_TxRingKick();
+#endif /* DEBUG_CONSOLE_TX_RING_ENABLE */
 
     return result;
 }
@@ -183,7 +239,12 @@ int DbgConsole_Putchar(int dbgConsoleCh)
     {
         return -1;
     }
+#if (DEBUG_CONSOLE_TX_RING_ENABLE > 0U)
+    (void)DbgConsole_TxRingPut(dbgConsoleCh);
+    DbgConsole_TxRingKick();
+#else
     (void)s_debugConsole.putChar((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0], (uint8_t *)(&dbgConsoleCh), 1);
+#endif /* DEBUG_CONSOLE_TX_RING_ENABLE */
 
     return 1;
 }
@@ -265,894 +326,180 @@ int DbgConsole_Getchar(void)
     return (int)dbgConsoleCh;
 }
 
-/*************Code for process formatted data*******************************/
-/*!
- * @brief This function puts padding character.
- *
- * @param[in] c         Padding character.
- * @param[in] curlen    Length of current formatted string .
- * @param[in] width     Width of expected formatted string.
- * @param[in] count     Number of characters.
- * @param[in] func_ptr  Function to put character out.
- */
-static void DbgConsole_PrintfPaddingCharacter(
-    char c, int32_t curlen, int32_t width, int32_t *count, PUTCHAR_FUNC func_ptr)
+#if (DEBUG_CONSOLE_TX_RING_ENABLE > 0U)
+/*************Code for the non-blocking TX ring*******************************/
+/* Hands the oldest contiguous run of queued bytes to the adapter if the UART is idle. */
+static void DbgConsole_TxRingKick(void)
 {
-    int32_t i;
+    uint32_t regPrimask;
+    uint32_t tail;
+    uint32_t length;
 
-    for (i = curlen; i < width; i++)
+    regPrimask = DisableGlobalIRQ();
+    if (0U == s_debugConsoleTxRing.inFlight)
     {
-        (void)func_ptr(c);
-        (*count)++;
-    }
-}
-
-/*!
- * @brief Converts a radix number to a string and return its length.
- *
- * @param[in] numstr    Converted string of the number.
- * @param[in] nump      Pointer to the number.
- * @param[in] neg       Polarity of the number.
- * @param[in] radix     The radix to be converted to.
- * @param[in] use_caps  Used to identify %x/X output format.
-
- * @return Length of the converted string.
- */
-static int32_t DbgConsole_ConvertRadixNumToString(char *numstr, void *nump, int32_t neg, int32_t radix, bool use_caps)
-{
-#if PRINTF_ADVANCED_ENABLE
-    long long int a;
-    long long int b;
-    long long int c;
-
-    unsigned long long int ua;
-    unsigned long long int ub;
-    unsigned long long int uc;
-    unsigned long long int uc_param;
-#else
-    int a;
-    int b;
-    int c;
-
-    unsigned int ua;
-    unsigned int ub;
-    unsigned int uc;
-    unsigned int uc_param;
-#endif /* PRINTF_ADVANCED_ENABLE */
-
-    int32_t nlen;
-    char *nstrp;
-
-    nlen     = 0;
-    nstrp    = numstr;
-    *nstrp++ = '\0';
-
-#if !(PRINTF_ADVANCED_ENABLE > 0)
-    neg = 0;
-#endif
-
-#if PRINTF_ADVANCED_ENABLE
-    a        = 0;
-    b        = 0;
-    c        = 0;
-    ua       = 0ULL;
-    ub       = 0ULL;
-    uc       = 0ULL;
-    uc_param = 0ULL;
-#else
-    a        = 0;
-    b        = 0;
-    c        = 0;
-    ua       = 0U;
-    ub       = 0U;
-    uc       = 0U;
-    uc_param = 0U;
-#endif /* PRINTF_ADVANCED_ENABLE */
-
-    (void)a;
-    (void)b;
-    (void)c;
-    (void)ua;
-    (void)ub;
-    (void)uc;
-    (void)uc_param;
-    (void)neg;
-    /*
-     * Fix MISRA issue: CID 15985711 (#15 of 15): MISRA C-2012 Control Flow Expressions (MISRA C-2012 Rule 14.3)
-     * misra_c_2012_rule_14_3_violation: Execution cannot reach this statement: a = *((int *)nump);
-     */
-#if PRINTF_ADVANCED_ENABLE
-    if (0 != neg)
-    {
-#if PRINTF_ADVANCED_ENABLE
-        a = *(long long int *)nump;
-#else
-        a = *(int *)nump;
-#endif /* PRINTF_ADVANCED_ENABLE */
-        if (a == 0)
-        {
-            *nstrp = '0';
-            ++nlen;
-            return nlen;
-        }
-        while (a != 0)
+        tail   = s_debugConsoleTxRing.tail;
+        length = s_debugConsoleTxRing.head - tail;
+        if (0U != length)
         {
-#if PRINTF_ADVANCED_ENABLE
-            b = (long long int)a / (long long int)radix;
-            c = (long long int)a - ((long long int)b * (long long int)radix);
-            if (c < 0)
+            /* Stop at the end of the buffer, the wrapped part goes with the next chunk. */
+            if (length > (DEBUG_CONSOLE_TX_RING_SIZE - (tail & DEBUG_CONSOLE_TX_RING_MASK)))
             {
-                uc       = (unsigned long long int)c;
-                uc_param = ~uc;
-                c        = (long long int)uc_param + 1 + (long long int)'0';
+                length = DEBUG_CONSOLE_TX_RING_SIZE - (tail & DEBUG_CONSOLE_TX_RING_MASK);
             }
-#else
-            b = (int)a / (int)radix;
-            c = (int)a - ((int)b * (int)radix);
-            if (c < 0)
-            {
-                uc       = (unsigned int)c;
-                uc_param = ~uc;
-                c        = (int)uc_param + 1 + (int)'0';
-            }
-#endif /* PRINTF_ADVANCED_ENABLE */
-            else
+            s_debugConsoleTxRing.inFlight = length;
+            if (kStatus_HAL_UartSuccess !=
+                HAL_UartSendNonBlocking((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0],
+                                        &s_debugConsoleTxRing.buffer[tail & DEBUG_CONSOLE_TX_RING_MASK], length))
             {
-                c = c + (int)'0';
+                s_debugConsoleTxRing.inFlight = 0U;
             }
-            a        = b;
-            *nstrp++ = (char)c;
-            ++nlen;
         }
     }
-    else
-#endif /* PRINTF_ADVANCED_ENABLE */
-    {
-#if PRINTF_ADVANCED_ENABLE
-        ua = *(unsigned long long int *)nump;
-#else
-        ua = *(unsigned int *)nump;
-#endif /* PRINTF_ADVANCED_ENABLE */
-        if (ua == 0U)
-        {
-            *nstrp = '0';
-            ++nlen;
-            return nlen;
-        }
-        while (ua != 0U)
-        {
-#if PRINTF_ADVANCED_ENABLE
-            ub = (unsigned long long int)ua / (unsigned long long int)radix;
-            uc = (unsigned long long int)ua - ((unsigned long long int)ub * (unsigned long long int)radix);
-#else
-            ub = ua / (unsigned int)radix;
-            uc = ua - (ub * (unsigned int)radix);
-#endif /* PRINTF_ADVANCED_ENABLE */
+    EnableGlobalIRQ(regPrimask);
+}
 
-            if (uc < 10U)
-            {
-                uc = uc + (unsigned int)'0';
-            }
-            else
-            {
-                uc = uc - 10U + (unsigned int)(use_caps ? 'A' : 'a');
-            }
-            ua       = ub;
-            *nstrp++ = (char)uc;
-            ++nlen;
-        }
+/* Called from the UART interrupt once the adapter has written the whole chunk to the FIFO. */
+static void DbgConsole_TxRingCallback(hal_uart_handle_t handle, hal_uart_status_t status, void *callbackParam)
+{
+    if (kStatus_HAL_UartTxIdle == status)
+    {
+        s_debugConsoleTxRing.tail += s_debugConsoleTxRing.inFlight;
+        s_debugConsoleTxRing.inFlight = 0U;
+        DbgConsole_TxRingKick();
     }
-    return nlen;
 }
 
-#if PRINTF_FLOAT_ENABLE
-/*!
- * @brief Converts a floating radix number to a string and return its length.
- *
- * @param[in] numstr            Converted string of the number.
- * @param[in] nump              Pointer to the number.
- * @param[in] radix             The radix to be converted to.
- * @param[in] precision_width   Specify the precision width.
+/* The UART interrupt can preempt the caller, so waiting for the ring to drain terminates. */
+static bool DbgConsole_TxRingCanWait(void)
+{
+    return (0U == __get_IPSR()) && (0U == __get_PRIMASK());
+}
 
- * @return Length of the converted string.
+/*
+ * Applies the overflow policy to a full ring, called with interrupts enabled again. Returns false
+ * when the new character is dropped: the queued bytes are never given up for it.
  */
-static int32_t DbgConsole_ConvertFloatRadixNumToString(char *numstr,
-                                                       void *nump,
-                                                       int32_t radix,
-                                                       uint32_t precision_width)
+static bool DbgConsole_TxRingMakeRoom(void)
 {
-    int32_t a;
-    int32_t b;
-    int32_t c;
-    uint32_t i;
-    double fa;
-    double dc;
-    double fb;
-    double r;
-    double fractpart;
-    double intpart;
-
-    int32_t nlen;
-    char *nstrp;
-    nlen     = 0;
-    nstrp    = numstr;
-    *nstrp++ = '\0';
-    r        = *(double *)nump;
-    if (0.0 == r)
+#if (DEBUG_CONSOLE_TX_OVERFLOW_POLICY == DEBUG_CONSOLE_TX_OVERFLOW_BLOCK)
+    uint32_t regPrimask;
+
+    if (!DbgConsole_TxRingCanWait())
     {
-        *nstrp = '0';
-        ++nlen;
-        return nlen;
+        return false;
     }
-    fractpart = modf((double)r, (double *)&intpart);
-    /* Process fractional part. */
-    for (i = 0; i < precision_width; i++)
+
+    regPrimask = DisableGlobalIRQ();
+    s_debugConsoleTxRing.stats.blocked++;
+    EnableGlobalIRQ(regPrimask);
+    while ((s_debugConsoleTxRing.head - s_debugConsoleTxRing.tail) >= DEBUG_CONSOLE_TX_RING_SIZE)
     {
-        fractpart *= (double)radix;
     }
-    if (r >= 0.0)
+    return true;
+#else
+    return false;
+#endif /* DEBUG_CONSOLE_TX_OVERFLOW_POLICY */
+}
+
+/* Producer side, the slot is claimed with interrupts masked so PRINTF can be called from any context. */
+static int DbgConsole_TxRingPut(int dbgConsoleCh)
+{
+    uint32_t regPrimask;
+    uint32_t head;
+    uint32_t used;
+
+    regPrimask = DisableGlobalIRQ();
+    head       = s_debugConsoleTxRing.head;
+    used       = head - s_debugConsoleTxRing.tail;
+
+    while (used >= DEBUG_CONSOLE_TX_RING_SIZE)
     {
-        fa = fractpart + (double)0.5;
-        if (fa >= pow((double)10, (double)precision_width))
+        EnableGlobalIRQ(regPrimask);
+        /* A full ring left idle, while a string is formatted, is started before applying the policy. */
+        DbgConsole_TxRingKick();
+        if (!DbgConsole_TxRingMakeRoom())
         {
-            intpart++;
+            regPrimask = DisableGlobalIRQ();
+            s_debugConsoleTxRing.stats.dropped++;
+            EnableGlobalIRQ(regPrimask);
+            return -1;
         }
+        /* An interrupt may have filled the room again. */
+        regPrimask = DisableGlobalIRQ();
+        head       = s_debugConsoleTxRing.head;
+        used       = head - s_debugConsoleTxRing.tail;
     }
-    else
+
+    s_debugConsoleTxRing.buffer[head & DEBUG_CONSOLE_TX_RING_MASK] = (uint8_t)dbgConsoleCh;
+    /* The byte is stored before the drain can see it. */
+    __DMB();
+    s_debugConsoleTxRing.head = head + 1U;
+
+    s_debugConsoleTxRing.stats.queued++;
+    if (used >= s_debugConsoleTxRing.stats.highWatermark)
     {
-        fa = fractpart - (double)0.5;
-        if (fa <= -pow((double)10, (double)precision_width))
-        {
-            intpart--;
-        }
+        s_debugConsoleTxRing.stats.highWatermark = used + 1U;
     }
-    for (i = 0; i < precision_width; i++)
+    EnableGlobalIRQ(regPrimask);
+
+    return dbgConsoleCh;
+}
+
+/* See fsl_debug_console.h for documentation of this function. */
+status_t DbgConsole_Flush(void)
+{
+    /* Do nothing if the debug UART is not initialized. */
+    if (kSerialPort_None == s_debugConsole.serial_port_type)
     {
-        fb = fa / (double)radix;
-        dc = (fa - (double)(long long int)fb * (double)radix);
-        c  = (int32_t)dc;
-        if (c < 0)
-        {
-            c = (int32_t)'0' - c;
-        }
-        else
-        {
-            c = c + '0';
-        }
-        fa       = fb;
-        *nstrp++ = (char)c;
-        ++nlen;
+        return kStatus_Success;
     }
-    *nstrp++ = (char)'.';
-    ++nlen;
-    a = (int32_t)intpart;
-    if (a == 0)
+
+    DbgConsole_TxRingKick();
+    if ((s_debugConsoleTxRing.head != s_debugConsoleTxRing.tail) && !DbgConsole_TxRingCanWait())
     {
-        *nstrp++ = '0';
-        ++nlen;
+        return kStatus_Fail;
     }
-    else
+
+    while (s_debugConsoleTxRing.head != s_debugConsoleTxRing.tail)
     {
-        while (a != 0)
-        {
-            b = (int32_t)a / (int32_t)radix;
-            c = (int32_t)a - ((int32_t)b * (int32_t)radix);
-            if (c < 0)
-            {
-                c = (int32_t)'0' - c;
-            }
-            else
-            {
-                c = c + '0';
-            }
-            a        = b;
-            *nstrp++ = (char)c;
-            ++nlen;
-        }
     }
-    return nlen;
+
+    return kStatus_Success;
+}
+
+/* See fsl_debug_console.h for documentation of this function. */
+void DbgConsole_GetTxStats(debug_console_tx_stats_t *stats)
+{
+    assert(NULL != stats);
+
+    *stats = s_debugConsoleTxRing.stats;
 }
-#endif /* PRINTF_FLOAT_ENABLE */
+#endif /* DEBUG_CONSOLE_TX_RING_ENABLE */
 
+/*************Code for process formatted data*******************************/
 /*!
- * @brief This function outputs its parameters according to a formatted string.
- *
- * @note I/O is performed by calling given function pointer using following
- * (*func_ptr)(c);
+ * @brief Output callback of StrFormatPrintf(), writes a character len times to the console.
  *
- * @param[in] func_ptr  Function to put character out.
- * @param[in] fmt       Format string for printf.
- * @param[in] ap        Arguments to printf.
- *
- * @return Number of characters
+ * @param[in] buf       Unused, the characters go to the UART or to the TX ring.
+ * @param[in] indicator Number of characters written.
+ * @param[in] dbgVal    Character to write.
+ * @param[in] len       Number of copies, nothing is written when it is not positive.
  */
-static int DbgConsole_PrintfFormattedData(PUTCHAR_FUNC func_ptr, const char *fmt, va_list ap)
+static void DbgConsole_PrintCallback(char *buf, int32_t *indicator, char dbgVal, int len)
 {
-    /* va_list ap; */
-    const char *p;
-    char c;
-
-    char vstr[33];
-    char *vstrp  = NULL;
-    int32_t vlen = 0;
-
-    bool done;
-    int32_t count = 0;
-
-    uint32_t field_width;
-    uint32_t precision_width;
-    char *sval;
-    int32_t cval;
-    bool use_caps;
-    uint8_t radix = 0;
-
-#if PRINTF_ADVANCED_ENABLE
-    uint32_t flags_used;
-    char schar;
-    bool dschar;
-    long long int ival;
-    unsigned long long int uval = 0;
-    bool valid_precision_width;
-#else
-    int ival;
-    unsigned int uval = 0;
-#endif /* PRINTF_ADVANCED_ENABLE */
+    int i;
 
-#if PRINTF_FLOAT_ENABLE
-    double fval;
-#endif /* PRINTF_FLOAT_ENABLE */
-
-    /* Start parsing apart the format string and display appropriate formats and data. */
-    p = fmt;
-    while (true)
+    (void)buf;
+    for (i = 0; i < len; i++)
     {
-        if ('\0' == *p)
-        {
-            break;
-        }
-        c = *p;
-        /*
-         * All formats begin with a '%' marker.  Special chars like
-         * '\n' or '\t' are normally converted to the appropriate
-         * character by the __compiler__.  Thus, no need for this
-         * routine to account for the '\' character.
-         */
-        if (c != '%')
-        {
-            (void)func_ptr(c);
-            count++;
-            p++;
-            /* By using 'continue', the next iteration of the loop is used, skipping the code that follows. */
-            continue;
-        }
-
-        use_caps = true;
-
-#if PRINTF_ADVANCED_ENABLE
-        /* First check for specification modifier flags. */
-        flags_used = 0;
-        done       = false;
-        while (!done)
-        {
-            switch (*++p)
-            {
-                case '-':
-                    flags_used |= (uint32_t)kPRINTF_Minus;
-                    break;
-                case '+':
-                    flags_used |= (uint32_t)kPRINTF_Plus;
-                    break;
-                case ' ':
-                    flags_used |= (uint32_t)kPRINTF_Space;
-                    break;
-                case '0':
-                    flags_used |= (uint32_t)kPRINTF_Zero;
-                    break;
-                case '#':
-                    flags_used |= (uint32_t)kPRINTF_Pound;
-                    break;
-                default:
-                    /* We've gone one char too far. */
-                    --p;
-                    done = true;
-                    break;
-            }
-        }
-#endif /* PRINTF_ADVANCED_ENABLE */
-
-        /* Next check for minimum field width. */
-        field_width = 0;
-        done        = false;
-        while (!done)
-        {
-            c = *++p;
-            if ((c >= '0') && (c <= '9'))
-            {
-                field_width = (field_width * 10U) + ((uint32_t)c - (uint32_t)'0');
-            }
-#if PRINTF_ADVANCED_ENABLE
-            else if (c == '*')
-            {
-                field_width = (uint32_t)va_arg(ap, unsigned int);
-            }
-#endif /* PRINTF_ADVANCED_ENABLE */
-            else
-            {
-                /* We've gone one char too far. */
-                --p;
-                done = true;
-            }
-        }
-        /* Next check for the width and precision field separator. */
-#if (PRINTF_ADVANCED_ENABLE || PRINTF_FLOAT_ENABLE)
-        precision_width = 6U; /* MISRA C-2012 Rule 2.2 */
-#endif
-#if PRINTF_ADVANCED_ENABLE
-        valid_precision_width = false;
-#endif /* PRINTF_ADVANCED_ENABLE */
-        if (*++p == '.')
-        {
-            /* Must get precision field width, if present. */
-            precision_width = 0U;
-            done            = false;
-            while (!done)
-            {
-                c = *++p;
-                if ((c >= '0') && (c <= '9'))
-                {
-                    precision_width = (precision_width * 10U) + ((uint32_t)c - (uint32_t)'0');
-#if PRINTF_ADVANCED_ENABLE
-                    valid_precision_width = true;
-#endif /* PRINTF_ADVANCED_ENABLE */
-                }
-#if PRINTF_ADVANCED_ENABLE
-                else if (c == '*')
-                {
-                    precision_width       = (uint32_t)va_arg(ap, unsigned int);
-                    valid_precision_width = true;
-                }
-#endif /* PRINTF_ADVANCED_ENABLE */
-                else
-                {
-                    /* We've gone one char too far. */
-                    --p;
-                    done = true;
-                }
-            }
-        }
-        else
-        {
-            /* We've gone one char too far. */
-            --p;
-        }
-#if PRINTF_ADVANCED_ENABLE
-        /*
-         * Check for the length modifier.
-         */
-        switch (/* c = */ *++p)
-        {
-            case 'h':
-                if (*++p != 'h')
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthShortInt;
-                    --p;
-                }
-                else
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthChar;
-                }
-                break;
-            case 'l':
-                if (*++p != 'l')
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthLongInt;
-                    --p;
-                }
-                else
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthLongLongInt;
-                }
-                break;
-            case 'z':
-                if (sizeof(size_t) == sizeof(uint32_t))
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthLongInt;
-                }
-                else if (sizeof(size_t) == (2U * sizeof(uint32_t)))
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthLongLongInt;
-                }
-                else if (sizeof(size_t) == sizeof(uint16_t))
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthShortInt;
-                }
-                else
-                {
-                    /* MISRA C-2012 Rule 15.7 */
-                }
-                break;
-            default:
-                /* we've gone one char too far */
-                --p;
-                break;
-        }
-#endif /* PRINTF_ADVANCED_ENABLE */
-        /* Now we're ready to examine the format. */
-        c = *++p;
-        {
-            if ((c == 'd') || (c == 'i') || (c == 'f') || (c == 'F') || (c == 'x') || (c == 'X') || (c == 'o') ||
-                (c == 'b') || (c == 'p') || (c == 'u'))
-            {
-                if ((c == 'd') || (c == 'i'))
-                {
-#if PRINTF_ADVANCED_ENABLE
-                    if (0U != (flags_used & (uint32_t)kPRINTF_LengthLongLongInt))
-                    {
-                        ival = (long long int)va_arg(ap, long long int);
-                    }
-                    else if (0U != (flags_used & (uint32_t)kPRINTF_LengthLongInt))
-                    {
-                        ival = (long int)va_arg(ap, long int);
-                    }
-                    else
-#endif /* PRINTF_ADVANCED_ENABLE */
-                    {
-                        ival = (int)va_arg(ap, int);
-                    }
-                    vlen  = DbgConsole_ConvertRadixNumToString(vstr, &ival, 1, 10, use_caps);
-                    vstrp = &vstr[vlen];
-#if PRINTF_ADVANCED_ENABLE
-                    if (ival < 0)
-                    {
-                        schar = '-';
-                        ++vlen;
-                    }
-                    else
-                    {
-                        if (0U != (flags_used & (uint32_t)kPRINTF_Plus))
-                        {
-                            schar = '+';
-                            ++vlen;
-                        }
-                        else
-                        {
-                            if (0U != (flags_used & (uint32_t)kPRINTF_Space))
-                            {
-                                schar = ' ';
-                                ++vlen;
-                            }
-                            else
-                            {
-                                schar = '\0';
-                            }
-                        }
-                    }
-                    dschar = false;
-                    /* Do the ZERO pad. */
-                    if (0U != (flags_used & (uint32_t)kPRINTF_Zero))
-                    {
-                        if ('\0' != schar)
-                        {
-                            (void)func_ptr(schar);
-                            count++;
-                        }
-                        dschar = true;
-
-                        DbgConsole_PrintfPaddingCharacter('0', vlen, (int32_t)field_width, &count, func_ptr);
-                        vlen = (int32_t)field_width;
-                    }
-                    else
-                    {
-                        if (0U == (flags_used & (uint32_t)kPRINTF_Minus))
-                        {
-                            DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                            if ('\0' != schar)
-                            {
-                                (void)func_ptr(schar);
-                                count++;
-                            }
-                            dschar = true;
-                        }
-                    }
-                    /* The string was built in reverse order, now display in correct order. */
-                    if ((!dschar) && ('\0' != schar))
-                    {
-                        (void)func_ptr(schar);
-                        count++;
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
-                }
-
-#if PRINTF_FLOAT_ENABLE
-                if ((c == 'f') || (c == 'F'))
-                {
-                    fval  = (double)va_arg(ap, double);
-                    vlen  = DbgConsole_ConvertFloatRadixNumToString(vstr, &fval, 10, precision_width);
-                    vstrp = &vstr[vlen];
-
-#if PRINTF_ADVANCED_ENABLE
-                    if (fval < 0.0)
-                    {
-                        schar = '-';
-                        ++vlen;
-                    }
-                    else
-                    {
-                        if (0U != (flags_used & (uint32_t)kPRINTF_Plus))
-                        {
-                            schar = '+';
-                            ++vlen;
-                        }
-                        else
-                        {
-                            if (0U != (flags_used & (uint32_t)kPRINTF_Space))
-                            {
-                                schar = ' ';
-                                ++vlen;
-                            }
-                            else
-                            {
-                                schar = '\0';
-                            }
-                        }
-                    }
-                    dschar = false;
-                    if (0U != (flags_used & (uint32_t)kPRINTF_Zero))
-                    {
-                        if ('\0' != schar)
-                        {
-                            (void)func_ptr(schar);
-                            count++;
-                        }
-                        dschar = true;
-                        DbgConsole_PrintfPaddingCharacter('0', vlen, (int32_t)field_width, &count, func_ptr);
-                        vlen = (int32_t)field_width;
-                    }
-                    else
-                    {
-                        if (0U == (flags_used & (uint32_t)kPRINTF_Minus))
-                        {
-                            DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                            if ('\0' != schar)
-                            {
-                                (void)func_ptr(schar);
-                                count++;
-                            }
-                            dschar = true;
-                        }
-                    }
-                    if ((!dschar) && ('\0' != schar))
-                    {
-                        (void)func_ptr(schar);
-                        count++;
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
-                }
-#endif /* PRINTF_FLOAT_ENABLE */
-                if ((c == 'X') || (c == 'x'))
-                {
-                    if (c == 'x')
-                    {
-                        use_caps = false;
-                    }
-#if PRINTF_ADVANCED_ENABLE
-                    if (0U != (flags_used & (uint32_t)kPRINTF_LengthLongLongInt))
-                    {
-                        uval = (unsigned long long int)va_arg(ap, unsigned long long int);
-                    }
-                    else if (0U != (flags_used & (uint32_t)kPRINTF_LengthLongInt))
-                    {
-                        uval = (unsigned long int)va_arg(ap, unsigned long int);
-                    }
-                    else
-#endif /* PRINTF_ADVANCED_ENABLE */
-                    {
-                        uval = (unsigned int)va_arg(ap, unsigned int);
-                    }
-                    vlen  = DbgConsole_ConvertRadixNumToString(vstr, &uval, 0, 16, use_caps);
-                    vstrp = &vstr[vlen];
-
-#if PRINTF_ADVANCED_ENABLE
-                    dschar = false;
-                    if (0U != (flags_used & (uint32_t)kPRINTF_Zero))
-                    {
-                        if (0U != (flags_used & (uint32_t)kPRINTF_Pound))
-                        {
-                            (void)func_ptr('0');
-                            (void)func_ptr((use_caps ? 'X' : 'x'));
-                            count += 2;
-                            /*vlen += 2;*/
-                            dschar = true;
-                        }
-                        DbgConsole_PrintfPaddingCharacter('0', vlen, (int32_t)field_width, &count, func_ptr);
-                        vlen = (int32_t)field_width;
-                    }
-                    else
-                    {
-                        if (0U == (flags_used & (uint32_t)kPRINTF_Minus))
-                        {
-                            if (0U != (flags_used & (uint32_t)kPRINTF_Pound))
-                            {
-                                vlen += 2;
-                            }
-                            DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                            if (0U != (flags_used & (uint32_t)kPRINTF_Pound))
-                            {
-                                (void)func_ptr('0');
-                                (void)func_ptr(use_caps ? 'X' : 'x');
-                                count += 2;
-
-                                dschar = true;
-                            }
-                        }
-                    }
-
-                    if ((0U != (flags_used & (uint32_t)kPRINTF_Pound)) && (!dschar))
-                    {
-                        (void)func_ptr('0');
-                        (void)func_ptr(use_caps ? 'X' : 'x');
-                        count += 2;
-                        vlen += 2;
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
-                }
-                if ((c == 'o') || (c == 'b') || (c == 'p') || (c == 'u'))
-                {
-                    if ('p' == c)
-                    {
-                        /*
-                         * Fix MISRA issue: CID 16209727 (#15 of 15): MISRA C-2012 Pointer Type Conversions (MISRA
-                         * C-2012 Rule 11.6)
-                         * 1. misra_c_2012_rule_11_6_violation: The expression va_arg (ap, void *) of type void * is
-                         * cast to type unsigned int.
-                         *
-                         * Orignal code: uval = (unsigned int)va_arg(ap, void *);
-                         */
-                        void *pval;
-                        pval = (void *)va_arg(ap, void *);
-                        (void)memcpy((void *)&uval, (void *)&pval, sizeof(void *));
-                    }
-                    else
-                    {
-#if PRINTF_ADVANCED_ENABLE
-                        if (0U != (flags_used & (uint32_t)kPRINTF_LengthLongLongInt))
-                        {
-                            uval = (unsigned long long int)va_arg(ap, unsigned long long int);
-                        }
-                        else if (0U != (flags_used & (uint32_t)kPRINTF_LengthLongInt))
-                        {
-                            uval = (unsigned long int)va_arg(ap, unsigned long int);
-                        }
-                        else
-#endif /* PRINTF_ADVANCED_ENABLE */
-                        {
-                            uval = (unsigned int)va_arg(ap, unsigned int);
-                        }
-                    }
-                    switch (c)
-                    {
-                        case 'o':
-                            radix = 8;
-                            break;
-                        case 'b':
-                            radix = 2;
-                            break;
-                        case 'p':
-                            radix = 16;
-                            break;
-                        case 'u':
-                            radix = 10;
-                            break;
-                        default:
-                            /* MISRA C-2012 Rule 16.4 */
-                            break;
-                    }
-                    vlen  = DbgConsole_ConvertRadixNumToString(vstr, &uval, 0, (int32_t)radix, use_caps);
-                    vstrp = &vstr[vlen];
-#if PRINTF_ADVANCED_ENABLE
-                    if (0U != (flags_used & (uint32_t)kPRINTF_Zero))
-                    {
-                        DbgConsole_PrintfPaddingCharacter('0', vlen, (int32_t)field_width, &count, func_ptr);
-                        vlen = (int32_t)field_width;
-                    }
-                    else
-                    {
-                        if (0U == (flags_used & (uint32_t)kPRINTF_Minus))
-                        {
-                            DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                        }
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
-                }
-#if !PRINTF_ADVANCED_ENABLE
-                DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-#endif /* !PRINTF_ADVANCED_ENABLE */
-                if (vstrp != NULL)
-                {
-                    while ('\0' != *vstrp)
-                    {
-                        (void)func_ptr(*vstrp--);
-                        count++;
-                    }
-                }
-#if PRINTF_ADVANCED_ENABLE
-                if (0U != (flags_used & (uint32_t)kPRINTF_Minus))
-                {
-                    DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                }
-#endif /* PRINTF_ADVANCED_ENABLE */
-            }
-            else if (c == 'c')
-            {
-                cval = (int32_t)va_arg(ap, unsigned int);
-                (void)func_ptr(cval);
-                count++;
-            }
-            else if (c == 's')
-            {
-                sval = (char *)va_arg(ap, char *);
-                if (NULL != sval)
-                {
-#if PRINTF_ADVANCED_ENABLE
-                    if (valid_precision_width)
-                    {
-                        vlen = (int32_t)precision_width;
-                    }
-                    else
-                    {
-                        vlen = (int32_t)strlen(sval);
-                    }
+#if (DEBUG_CONSOLE_TX_RING_ENABLE > 0U)
+        (void)DbgConsole_TxRingPut((int)dbgVal);
 #else
-                    vlen = (int32_t)strlen(sval);
-#endif /* PRINTF_ADVANCED_ENABLE */
-#if PRINTF_ADVANCED_ENABLE
-                    if (0U == (flags_used & (uint32_t)kPRINTF_Minus))
-#endif /* PRINTF_ADVANCED_ENABLE */
-                    {
-                        DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                    }
-
-#if PRINTF_ADVANCED_ENABLE
-                    if (valid_precision_width)
-                    {
-                        while (('\0' != *sval) && (vlen > 0))
-                        {
-                            (void)func_ptr(*sval++);
-                            count++;
-                            vlen--;
-                        }
-                        /* In case that vlen sval is shorter than vlen */
-                        vlen = (int32_t)precision_width - vlen;
-                    }
-                    else
-                    {
-#endif /* PRINTF_ADVANCED_ENABLE */
-                        while ('\0' != *sval)
-                        {
-                            (void)func_ptr(*sval++);
-                            count++;
-                        }
-#if PRINTF_ADVANCED_ENABLE
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
-
-#if PRINTF_ADVANCED_ENABLE
-                    if (0U != (flags_used & (uint32_t)kPRINTF_Minus))
-                    {
-                        DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
-                }
-            }
-            else
-            {
-                (void)func_ptr(c);
-                count++;
-            }
-        }
-        p++;
+        (void)s_debugConsole.putChar((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0], (uint8_t *)(&dbgVal), 1);
+#endif /* DEBUG_CONSOLE_TX_RING_ENABLE */
+        (*indicator)++;
     }
-    return count;
 }
 
 #endif /* SDK_DEBUGCONSOLE */
@@ -69,6 +69,25 @@
 #define SCANF_ADVANCED_ENABLE 0U
 #endif /* SCANF_ADVANCED_ENABLE */
 
+/*! @brief Overflow policies of the non-blocking TX ring. */
+#define DEBUG_CONSOLE_TX_OVERFLOW_DROP      0U /*!< Drop the new characters. */
+#define DEBUG_CONSOLE_TX_OVERFLOW_OVERWRITE 1U /*!< Same as DEBUG_CONSOLE_TX_OVERFLOW_DROP, kept for compatibility. */
+#define DEBUG_CONSOLE_TX_OVERFLOW_BLOCK     2U /*!< Wait for room, drop from interrupt context. */
+
+/*! @brief Size of the non-blocking TX ring in bytes, a power of two.
+ *
+ *  Used when DEBUG_CONSOLE_TRANSFER_NON_BLOCKING is defined: PRINTF and PUTCHAR then format into the ring
+ *  and the UART adapter drains it from its interrupt.
+ */
+#ifndef DEBUG_CONSOLE_TX_RING_SIZE
+#define DEBUG_CONSOLE_TX_RING_SIZE 1024U
+#endif /* DEBUG_CONSOLE_TX_RING_SIZE */
+
+/*! @brief Overflow policy of the non-blocking TX ring. */
+#ifndef DEBUG_CONSOLE_TX_OVERFLOW_POLICY
+#define DEBUG_CONSOLE_TX_OVERFLOW_POLICY DEBUG_CONSOLE_TX_OVERFLOW_DROP
+#endif /* DEBUG_CONSOLE_TX_OVERFLOW_POLICY */
+
 /*! @brief Definition to select redirect toolchain printf, scanf to uart or not.
  *
  *  if SDK_DEBUGCONSOLE defined to 0,it represents select toolchain printf, scanf.
@@ -119,6 +138,15 @@ typedef enum _serial_port_type
 } serial_port_type_t;
 #endif
 
+/*! @brief Counters of the non-blocking TX ring, in bytes unless noted. */
+typedef struct _debug_console_tx_stats
+{
+    uint32_t queued;        /*!< Characters written into the ring. */
+    uint32_t dropped;       /*!< New characters lost on a full ring. */
+    uint32_t blocked;       /*!< Times the block policy waited for room. */
+    uint32_t highWatermark; /*!< Highest ring occupancy. */
+} debug_console_tx_stats_t;
+
 /*!
  * @addtogroup debugconsolelite
  * @{
@@ -283,6 +311,25 @@ int DbgConsole_Scanf(char *fmt_s, ...);
  */
 int DbgConsole_Getchar(void);
 
+#if defined(DEBUG_CONSOLE_TRANSFER_NON_BLOCKING)
+/*!
+ * @brief Waits until the TX ring is handed to the UART.
+ *
+ * Call this function before a reset or a clock change to get the pending output out.
+ *
+ * @retval kStatus_Success The ring is empty.
+ * @retval kStatus_Fail Called from interrupt context or with interrupts masked, the ring can not drain.
+ */
+status_t DbgConsole_Flush(void);
+
+/*!
+ * @brief Gets the counters of the TX ring.
+ *
+ * @param stats Destination of the counters.
+ */
+void DbgConsole_GetTxStats(debug_console_tx_stats_t *stats);
+#endif /* DEBUG_CONSOLE_TRANSFER_NON_BLOCKING */
+
 #endif /* SDK_DEBUGCONSOLE */
 
 /*! @} */
@@ -507,28 +507,78 @@ static uint32_t ScanIgnoreWhiteSpace(const char **s)
     return count;
 }
 
+/* Digits of the power of two radixes. */
+static const char s_strDigitsLower[] = "0123456789abcdef";
+static const char s_strDigitsUpper[] = "0123456789ABCDEF";
+
+/* Decimal digit pairs, the tens of n at [2n] and the units at [2n + 1]. */
+static const char s_strDecimalPairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/*
+ * Writes the decimal digits of a 32-bit value backwards, at least minDigits of them, and returns their
+ * count. Two digits per step and no division: value / 100 is a multiplication by the reciprocal,
+ * exact for every 32-bit value.
+ */
+static int32_t ConvertDecimal32ToString(char *nstrp, uint32_t value, int32_t minDigits)
+{
+    int32_t nlen = 0;
+    uint32_t quotient;
+    uint32_t pair;
+
+    while (value >= 100U)
+    {
+        quotient = (uint32_t)(((uint64_t)value * 0x51EB851FULL) >> 37U);
+        pair     = (value - (quotient * 100U)) * 2U;
+        *nstrp++ = s_strDecimalPairs[pair + 1U];
+        *nstrp++ = s_strDecimalPairs[pair];
+        nlen += 2;
+        value = quotient;
+    }
+    if (value >= 10U)
+    {
+        pair     = value * 2U;
+        *nstrp++ = s_strDecimalPairs[pair + 1U];
+        *nstrp++ = s_strDecimalPairs[pair];
+        nlen += 2;
+    }
+    else if ((value != 0U) || (nlen == 0))
+    {
+        *nstrp++ = (char)((uint32_t)'0' + value);
+        nlen++;
+    }
+    else
+    {
+        /* Nothing left. */
+    }
+    while (nlen < minDigits)
+    {
+        *nstrp++ = '0';
+        nlen++;
+    }
+
+    return nlen;
+}
+
+/*
+ * Shared integer conversion of the printf engine, used by StrFormatPrintf() and through it by
+ * PRINTF. The digits are stored backwards after a leading '\0', the callers print them from the end.
+ * Radix 2, 8 and 16 take digits from the low bits, radix 10 goes through ConvertDecimal32ToString(),
+ * a 64-bit value costs one 64-bit division per 9 digits.
+ */
 static int32_t ConvertRadixNumToString(char *numstr, void *nump, unsigned int neg, unsigned int radix, bool use_caps)
 {
+    const char *digits = use_caps ? s_strDigitsUpper : s_strDigitsLower;
+    STR_FORMAT_PRINTF_UVAL_TYPE ua;
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-    long long int a;
-    long long int b;
-    long long int c;
-
-    unsigned long long int ua;
-    unsigned long long int ub;
-    unsigned long long int uc;
-    unsigned long long int uc_param;
-#else
-    int a;
-    int b;
-    int c;
-
-    unsigned int ua;
-    unsigned int ub;
-    unsigned int uc;
-    unsigned int uc_param;
+    STR_FORMAT_PRINTF_IVAL_TYPE a;
+    STR_FORMAT_PRINTF_UVAL_TYPE uq;
 #endif /* PRINTF_ADVANCED_ENABLE */
-
+    uint32_t shift;
     int32_t nlen;
     char *nstrp;
 
@@ -536,121 +586,52 @@ static int32_t ConvertRadixNumToString(char *numstr, void *nump, unsigned int ne
     nstrp    = numstr;
     *nstrp++ = '\0';
 
-#if !(defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0u))
-    neg = 0U;
-#endif
-
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-    a        = 0;
-    b        = 0;
-    c        = 0;
-    ua       = 0ULL;
-    ub       = 0ULL;
-    uc       = 0ULL;
-    uc_param = 0ULL;
+    if (0U != neg)
+    {
+        /* The caller prints the sign, only the magnitude is converted. */
+        a  = *(STR_FORMAT_PRINTF_IVAL_TYPE *)nump;
+        ua = (a < 0) ? ((STR_FORMAT_PRINTF_UVAL_TYPE)0U - (STR_FORMAT_PRINTF_UVAL_TYPE)a) :
+                       (STR_FORMAT_PRINTF_UVAL_TYPE)a;
+    }
+    else
 #else
-    a        = 0;
-    b        = 0;
-    c        = 0;
-    ua       = 0U;
-    ub       = 0U;
-    uc       = 0U;
-    uc_param = 0U;
+    (void)neg;
 #endif /* PRINTF_ADVANCED_ENABLE */
+    {
+        ua = *(STR_FORMAT_PRINTF_UVAL_TYPE *)nump;
+    }
 
-    (void)a;
-    (void)b;
-    (void)c;
-    (void)ua;
-    (void)ub;
-    (void)uc;
-    (void)uc_param;
-    (void)neg;
-    /*
-     * Fix MISRA issue: CID 15972928 (#15 of 15): MISRA C-2012 Control Flow Expressions (MISRA C-2012 Rule 14.3)
-     * misra_c_2012_rule_14_3_violation: Execution cannot reach this statement: a = *((int *)nump);
-     */
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-    if (0U != neg)
+    if (radix == 10U)
     {
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-        a = *(long long int *)nump;
-#else
-        a = *(int *)nump;
-#endif /* PRINTF_ADVANCED_ENABLE */
-        if (a == 0)
+        while (ua > 0xFFFFFFFFULL)
         {
-            *nstrp = '0';
-            ++nlen;
-            return nlen;
+            uq = ua / 1000000000ULL;
+            nlen += ConvertDecimal32ToString(&nstrp[nlen], (uint32_t)(ua - (uq * 1000000000ULL)), 9);
+            ua = uq;
         }
-        while (a != 0)
-        {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-            b = (long long int)a / (long long int)radix;
-            c = (long long int)a - ((long long int)b * (long long int)radix);
-            if (c < 0)
-            {
-                uc       = (unsigned long long int)c;
-                uc_param = ~uc;
-                c        = (long long int)uc_param + 1 + (long long int)'0';
-            }
-#else
-            b = (int)a / (int)radix;
-            c = (int)a - ((int)b * (int)radix);
-            if (c < 0)
-            {
-                uc       = (unsigned int)c;
-                uc_param = ~uc;
-                c        = (int)uc_param + 1 + (int)'0';
-            }
 #endif /* PRINTF_ADVANCED_ENABLE */
-            else
-            {
-                c = c + (int)'0';
-            }
-            a        = b;
-            *nstrp++ = (char)c;
-            ++nlen;
-        }
+        nlen += ConvertDecimal32ToString(&nstrp[nlen], (uint32_t)ua, 0);
     }
-    else
-#endif /* PRINTF_ADVANCED_ENABLE */
+    else if ((radix == 2U) || (radix == 8U) || (radix == 16U))
     {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-        ua = *(unsigned long long int *)nump;
-#else
-        ua = *(unsigned int *)nump;
-#endif /* PRINTF_ADVANCED_ENABLE */
-        if (ua == 0U)
+        shift = (radix == 16U) ? 4U : ((radix == 8U) ? 3U : 1U);
+        do
         {
-            *nstrp = '0';
-            ++nlen;
-            return nlen;
-        }
-        while (ua != 0U)
+            nstrp[nlen++] = digits[(uint32_t)ua & (radix - 1U)];
+            ua >>= shift;
+        } while (ua != 0U);
+    }
+    else
+    {
+        do
         {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-            ub = (unsigned long long int)ua / (unsigned long long int)radix;
-            uc = (unsigned long long int)ua - ((unsigned long long int)ub * (unsigned long long int)radix);
-#else
-            ub = ua / (unsigned int)radix;
-            uc = ua - (ub * (unsigned int)radix);
-#endif /* PRINTF_ADVANCED_ENABLE */
-
-            if (uc < 10U)
-            {
-                uc = uc + (unsigned int)'0';
-            }
-            else
-            {
-                uc = uc - 10U + (unsigned int)(use_caps ? 'A' : 'a');
-            }
-            ua       = ub;
-            *nstrp++ = (char)uc;
-            ++nlen;
-        }
+            nstrp[nlen++] = digits[(uint32_t)(ua % radix)];
+            ua /= radix;
+        } while (ua != 0U);
     }
+
     return nlen;
 }
 